@@ -34,7 +34,10 @@ VST3_PLUGIN_SOURCES = \
 VST3_MODULE_INFO_TOOL = $(BUILD_DIR)$(DIR_SEP)vst3_module_info_tool
 VST3_MODULE_INFO_LFLAGS = -pthread -Wl,--no-as-needed -ldl
 
-DEV_PLATFORM_CLEAN = $(TEX_ARTIFACTS) $(VST3_MODULE_INFO_TOOL)
+BRIDGE = $(BUILD_DIR)$(DIR_SEP)mpe-emulator-bridge
+BRIDGE_LFLAGS = -pthread
+
+DEV_PLATFORM_CLEAN = $(TEX_ARTIFACTS) $(VST3_MODULE_INFO_TOOL) $(BRIDGE)
 
 .PHONY: vst3moduleinfo
 
@@ -87,6 +90,9 @@ $(LIB_PATH)/libxcb-render.so: $(SYS_LIB_PATH)/libxcb-render.so.0 | $(LIB_PATH)
 # DEBUG_LOG ?= /tmp/debug.txt
 DEBUG_LOG ?=
 
+# TRACE_LOG ?= /tmp/trace.bin
+TRACE_LOG ?=
+
 EXE =
 
 CPP_TARGET_PLATFORM ?= /usr/bin/g++
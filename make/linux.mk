@@ -27,6 +27,12 @@ VALGRIND ?= /usr/bin/valgrind
 
 LINK_DEV_EXE = $(CPP_DEV_PLATFORM) -Wall
 
+UPGRADE_SETTINGS_LFLAGS = -pthread
+TRACE_LFLAGS = -pthread
+RT_SAFETY_LFLAGS = -pthread -ldl
+
+DEV_PLATFORM_TESTS = test_bridge test_rt_safety
+
 DEV_EXE =
 
 CPPCHECK_FLAGS = \
@@ -22,6 +22,9 @@ TARGET_OS = windows
 # DEBUG_LOG ?= C:\\\\debug.txt
 DEBUG_LOG ?=
 
+# TRACE_LOG ?= C:\\\\trace.bin
+TRACE_LOG ?=
+
 FST = $(FST_DIR)/mpe-emulator.dll
 FST_MAIN_SOURCES = src/plugin/fst/dll.cpp
 FST_EXTRA = src/plugin/fst/plugin.def
@@ -48,4 +48,9 @@ VALGRIND_FLAGS =
 
 LINK_DEV_EXE = $(CPP_DEV_PLATFORM) -Wall -static
 
+UPGRADE_SETTINGS_LFLAGS =
+TRACE_LFLAGS =
+
+DEV_PLATFORM_TESTS =
+
 include make/mingw.mk
@@ -0,0 +1,173 @@
+###############################################################################
+# This file is part of MPE Emulator.
+# Copyright (C) 2025  Attila M. Magyar
+#
+# MPE Emulator is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# MPE Emulator is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+###############################################################################
+
+import os.path
+import sys
+
+from math import log, tanh
+
+
+TABLE_SIZE = 0x0800
+MAX_INDEX = TABLE_SIZE - 1
+VALUES_PER_LINE = 4
+
+
+def dist_smooth_smooth(x):
+    return (tanh(8.0 * (2.0 * x - 1.0)) + 1.0) / 2.0
+
+
+def dist_smooth_sharp(x):
+    return x ** 5.0
+
+
+def dist_sharp_smooth(x):
+    return (x * (1.0 - log(x + 0.001)) / (1.0 - log(1.001))) ** (1.0 / 3.0)
+
+
+def dist_sharp_sharp(x):
+    # Antiderivative of ((2 * x - 1) ^ 2) ^ 5.
+    #
+    # Construction: the idea is to map [0, 1] to itself with a smooth function
+    # f for which all of the following properties hold:
+    #
+    #  1. f(0) = 0.
+    #
+    #  2. f(1) = 1.
+    #
+    #  3. f'(0) = 1 and f'(1) = 1 (ie. connect sharply to the constant 0 and 1
+    #     functions on the respective ends).
+    #
+    #  4. f'(x) >= 0 for all x where 0 < x < 1.
+    #
+    #  5. f'(x) = f'(1 - x) for all x where 0 < x < 1.
+    #
+    #  6. f'(1 / 2) = 0.
+    #
+    #  7. f''(1 / 2) = 0.
+    #
+    #  7. f''(x) < 0 for all x where 0 <= x < 1 / 2.
+    #
+    #  8. f''(x) > 0 for all x where 1 / 2 < x <= 1.
+    #
+    # The (2 * x - 1) ^ 2 function fits the bill nicely, and raising it to the
+    # 5th power exaggerates its properties.
+    #
+    # See also: https://en.wikipedia.org/wiki/Horner%27s_method
+    a = 1024.0
+    b = 5632.0
+    c = 14080.0
+    d = 21120.0
+    e = 21120.0
+    f = 14784.0
+    g = 7392.0
+    h = 2640.0
+    i = 660.0
+    j = 110.0
+    k = 11.0
+
+    return ((((((((((a * x - b) * x + c) * x - d) * x + e) * x - f) * x + g) * x - h) * x + i) * x - j) * x + k) * x
+
+
+DISTORTIONS = (
+    ("DIST_CURVE_SMOOTH_SMOOTH", dist_smooth_smooth),
+    ("DIST_CURVE_SMOOTH_SHARP", dist_smooth_sharp),
+    ("DIST_CURVE_SHARP_SMOOTH", dist_sharp_smooth),
+    ("DIST_CURVE_SHARP_SHARP", dist_sharp_sharp),
+)
+
+
+HEADER = """\
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+This file is generated by scripts/gen_distortion_tables.py, do not edit.
+*/
+
+#ifndef MPE_EMULATOR__MATH_TABLES_CPP
+#define MPE_EMULATOR__MATH_TABLES_CPP
+
+#include "math.hpp"
+
+
+namespace MpeEmulator
+{
+
+double const Math::distortions[Math::DISTORTIONS][Math::DISTORTION_TABLE_SIZE] = {
+"""
+
+
+FOOTER = """\
+};
+
+}
+
+#endif
+"""
+
+
+def main(argv):
+    out_file = os.path.join(os.path.dirname(argv[0]), "../src/math_tables.cpp")
+
+    with open(out_file, "w") as f:
+        f.write(HEADER)
+
+        for name, func in DISTORTIONS:
+            f.write(f"    [Math::DistortionCurve::{name}] = {{\n")
+
+            values = [format_value(func(i / MAX_INDEX)) for i in range(TABLE_SIZE)]
+
+            for i in range(0, TABLE_SIZE, VALUES_PER_LINE):
+                line = ", ".join(values[i:i + VALUES_PER_LINE])
+                f.write(f"        {line},\n")
+
+            f.write("    },\n")
+
+        f.write(FOOTER)
+
+    return 0
+
+
+def format_value(value):
+    # repr() gives the shortest representation which converts back to the
+    # exact same double precision value.
+    text = repr(float(value))
+
+    if "e" not in text and "." not in text:
+        text += ".0"
+
+    return text
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,202 @@
+###############################################################################
+# This file is part of MPE Emulator.
+# Copyright (C) 2023, 2024, 2025  Attila M. Magyar
+#
+# MPE Emulator is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# MPE Emulator is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+###############################################################################
+
+
+import os.path
+import random
+import re
+import sys
+
+
+# Inspiration from https://orlp.net/blog/worlds-smallest-hash-table/
+#
+# Parameter names are at most 8 bytes long, so each of them can be packed into
+# a 64 bit integer, and a multiplicative hash of that integer can be used for
+# finding a slot in a small, flat table. This script searches for a multiplier
+# with which none of the names collide, so that a single probe and a single
+# integer comparison is enough for looking up a name at run-time.
+#
+# The parameter names and their IDs are read from the Proxy::ParamId enum in
+# src/proxy.hpp, and the tables are written to src/param_id_hash_table.cpp,
+# along with the reverse table which maps IDs to names.
+
+
+NAME_SIZE = 8
+HASH_BITS = 9
+ENTRIES = 1 << HASH_BITS
+SHIFT = 64 - HASH_BITS
+MASK_64 = (1 << 64) - 1
+SEED = 42
+MAX_TRIES = 10000000
+KEYS_PER_LINE = 4
+IDS_PER_LINE = 4
+NAMES_PER_LINE = 8
+
+
+HEADER = """\
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+This file is generated by scripts/gen_param_id_hash_table.py, do not edit.
+*/
+
+#ifndef MPE_EMULATOR__PARAM_ID_HASH_TABLE_CPP
+#define MPE_EMULATOR__PARAM_ID_HASH_TABLE_CPP
+
+#include <cstdint>
+
+#include "proxy.hpp"
+
+
+namespace MpeEmulator
+{
+
+"""
+
+
+FOOTER = """\
+}
+
+#endif
+"""
+
+
+def main(argv):
+    base_dir = os.path.join(os.path.dirname(argv[0]), "..")
+    params = read_params(os.path.join(base_dir, "src", "proxy.hpp"))
+    keys = [(encode(name), param_id) for name, param_id in params]
+    multiplier = find_multiplier([key for key, param_id in keys])
+
+    if multiplier is None:
+        print(
+            f"Unable to find a perfect hash multiplier for {len(keys)} parameters",
+            file=sys.stderr
+        )
+
+        return 1
+
+    table = [(0, "INVALID_PARAM_ID")] * ENTRIES
+
+    for (key, param_id), (name, _) in zip(keys, params):
+        table[compute_hash(key, multiplier)] = (key, name)
+
+    with open(os.path.join(base_dir, "src", "param_id_hash_table.cpp"), "w") as f:
+        f.write(HEADER)
+        f.write(
+            "uint64_t const Proxy::ParamIdHashTable::MULTIPLIER = "
+            f"0x{multiplier:016x};\n\n\n"
+        )
+
+        f.write("uint64_t const Proxy::ParamIdHashTable::KEYS[ENTRIES] = {\n")
+
+        for i in range(0, ENTRIES, KEYS_PER_LINE):
+            line = ", ".join(
+                f"0x{key:016x}" for key, name in table[i:i + KEYS_PER_LINE]
+            )
+            f.write(f"    {line},\n")
+
+        f.write("};\n\n\n")
+
+        f.write("Proxy::ParamId const Proxy::ParamIdHashTable::PARAM_IDS[ENTRIES] = {\n")
+
+        for i in range(0, ENTRIES, IDS_PER_LINE):
+            line = ", ".join(
+                f"ParamId::{name}" for key, name in table[i:i + IDS_PER_LINE]
+            )
+            f.write(f"    {line},\n")
+
+        f.write("};\n\n\n")
+
+        f.write(
+            "char const* const Proxy::PARAM_NAMES[ParamId::PARAM_ID_COUNT] = {\n"
+        )
+
+        for i in range(0, len(params), NAMES_PER_LINE):
+            line = ", ".join(
+                f'"{name}"' for name, param_id in params[i:i + NAMES_PER_LINE]
+            )
+            f.write(f"    {line},\n")
+
+        f.write("};\n\n")
+        f.write(FOOTER)
+
+    return 0
+
+
+def read_params(proxy_hpp):
+    with open(proxy_hpp, "r") as f:
+        source = f.read()
+
+    begin = source.index("enum ParamId {")
+    end = source.index("PARAM_ID_COUNT", begin)
+    params = [
+        (name, int(param_id))
+        for name, param_id in re.findall(
+            r"^\s+(\w+)\s*=\s*(\d+),", source[begin:end], re.MULTILINE
+        )
+    ]
+
+    for i, (name, param_id) in enumerate(params):
+        if len(name) > NAME_SIZE:
+            raise ValueError(f"Parameter name is too long: {name}")
+
+        if param_id != i:
+            raise ValueError(f"Parameter IDs must be consecutive: {name}")
+
+    return params
+
+
+def encode(name: str) -> int:
+    return int.from_bytes(name.encode("ascii"), "little")
+
+
+def find_multiplier(keys):
+    rng = random.Random(SEED)
+
+    for i in range(MAX_TRIES):
+        multiplier = rng.getrandbits(64) | 1
+        hashes = set(compute_hash(key, multiplier) for key in keys)
+
+        if len(hashes) == len(keys):
+            return multiplier
+
+    return None
+
+
+def compute_hash(key: int, multiplier: int) -> int:
+    return ((key * multiplier) & MASK_64) >> SHIFT
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
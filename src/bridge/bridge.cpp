@@ -0,0 +1,419 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPE_EMULATOR__BRIDGE__BRIDGE_CPP
+#define MPE_EMULATOR__BRIDGE__BRIDGE_CPP
+
+#include <algorithm>
+#include <cerrno>
+#include <ctime>
+#include <limits>
+
+#include <poll.h>
+#include <unistd.h>
+
+#include "bridge/bridge.hpp"
+
+
+namespace MpeEmulator
+{
+
+size_t Bridge::find_complete_messages(
+        Midi::Byte const* const buffer,
+        size_t const size,
+        Midi::Byte running_status
+) noexcept {
+    size_t data_length = get_data_length(running_status);
+    size_t received_data_bytes = 0;
+    size_t complete = 0;
+
+    for (size_t i = 0; i != size; ++i) {
+        Midi::Byte const byte = buffer[i];
+
+        if ((byte & 0x80) != 0) {
+            data_length = get_data_length(byte);
+            received_data_bytes = 0;
+
+            if (data_length == 0) {
+                complete = i + 1;
+            }
+        } else if (data_length == 0) {
+            complete = i + 1;
+        } else if (++received_data_bytes == data_length) {
+            received_data_bytes = 0;
+            complete = i + 1;
+        }
+    }
+
+    return complete;
+}
+
+
+size_t Bridge::get_data_length(Midi::Byte const status) noexcept
+{
+    switch (status & 0xf0) {
+        case Midi::NOTE_OFF:
+        case Midi::NOTE_ON:
+        case Midi::AFTERTOUCH:
+        case Midi::CONTROL_CHANGE:
+        case Midi::PITCH_BEND_CHANGE:
+            return 2;
+
+        case Midi::PROGRAM_CHANGE:
+        case Midi::CHANNEL_PRESSURE:
+            return 1;
+
+        default:
+            return 0;
+    }
+}
+
+
+size_t Bridge::remove_real_time_messages(
+        Midi::Byte* const buffer,
+        size_t const size
+) noexcept {
+    Midi::Byte* const end = std::remove_if(
+        buffer,
+        buffer + size,
+        [](Midi::Byte const byte) { return byte >= 0xf8; }
+    );
+
+    return (size_t)(end - buffer);
+}
+
+
+size_t Bridge::encode(
+        Midi::Event const& event,
+        Midi::Byte& running_status,
+        Midi::Byte* const buffer
+) noexcept {
+    size_t const data_length = get_data_length(event.status);
+    size_t size = 0;
+
+    if (data_length == 0) {
+        return 0;
+    }
+
+    if (event.status != running_status) {
+        buffer[size++] = event.status;
+        running_status = event.status;
+    }
+
+    buffer[size++] = event.data_1;
+
+    if (data_length == 2) {
+        buffer[size++] = event.data_2;
+    }
+
+    return size;
+}
+
+
+Bridge::Bridge(Proxy& proxy, int const input_fd, int const output_fd) noexcept
+    : proxy(proxy),
+    input_fd(input_fd),
+    output_fd(output_fd),
+    clock_start_ns(0),
+    clock_samples(0),
+    input_size(0),
+    output_running_status(0)
+{
+}
+
+
+bool Bridge::start() noexcept
+{
+    /*
+    Every message takes at least one byte, so a batch of input can contain
+    at most as many events as a block of INPUT_BUFFER_SIZE samples with an
+    event on every sample.
+    */
+    proxy.reserve_out_events(INPUT_BUFFER_SIZE);
+    proxy.set_sample_rate(SAMPLE_RATE);
+    proxy.resume();
+    proxy.begin_processing();
+
+    bool const success = write_out_events();
+
+    proxy.begin_processing();
+
+    clock_start_ns = now_ns();
+    clock_samples = 0;
+
+    return success;
+}
+
+
+Bridge::Status Bridge::process(int const timeout_ms) noexcept
+{
+    pollfd input_poll;
+
+    input_poll.fd = input_fd;
+    input_poll.events = POLLIN;
+    input_poll.revents = 0;
+
+    int const ready = poll(
+        &input_poll,
+        1,
+        proxy.has_held_controller_values()
+            ? std::min(timeout_ms, HELD_VALUES_POLL_TIMEOUT_MS)
+            : timeout_ms
+    );
+
+    if (ready < 0 && errno != EINTR) {
+        return Status::FAILED;
+    }
+
+    uint64_t const start = now_ns();
+
+    if (!advance_clock()) {
+        return Status::FAILED;
+    }
+
+    if (ready <= 0) {
+        return Status::IDLE;
+    }
+
+    Status const status = read_input();
+
+    if (status != Status::PROCESSED) {
+        return status;
+    }
+
+    size_t const complete = find_complete_messages(
+        input, input_size, proxy.running_status
+    );
+
+    if (complete == 0) {
+        return Status::IDLE;
+    }
+
+    Midi::EventDispatcher<Proxy>::dispatch_events(proxy, 0.0, input, complete);
+
+    input_size -= complete;
+    std::copy(input + complete, input + complete + input_size, input);
+
+    proxy.process_messages();
+
+    if (proxy.out_events.empty()) {
+        proxy.begin_processing();
+
+        return Status::PROCESSED;
+    }
+
+    bool const success = write_out_events();
+
+    latency_stats.add(now_ns() - start);
+    proxy.begin_processing();
+
+    return success ? Status::PROCESSED : Status::FAILED;
+}
+
+
+bool Bridge::stop() noexcept
+{
+    /*
+    Resetting the proxy releases the notes which are still held, so that
+    nothing keeps ringing on the synthesizers after the bridge is gone.
+    */
+    if (!advance_clock()) {
+        return false;
+    }
+
+    proxy.resume();
+    proxy.begin_processing();
+
+    bool const success = write_out_events();
+
+    proxy.begin_processing();
+
+    return success;
+}
+
+
+Bridge::LatencyStats const& Bridge::get_latency_stats() const noexcept
+{
+    return latency_stats;
+}
+
+
+uint64_t Bridge::now_ns() noexcept
+{
+    timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+
+/*
+Everything that was dispatched since the previous call is considered to be a
+block which ends now, so that incoming events are timestamped with the current
+time, and the held controller values which have become due in the meantime are
+sent before them.
+*/
+bool Bridge::advance_clock() noexcept
+{
+    constexpr double samples_per_ns = SAMPLE_RATE / 1000000000.0;
+    constexpr uint64_t max_sample_count = std::numeric_limits<Midi::SampleOffset>::max();
+
+    uint64_t const now_samples = (uint64_t)(
+        (double)(now_ns() - clock_start_ns) * samples_per_ns
+    );
+    uint64_t const sample_count = std::min(now_samples - clock_samples, max_sample_count);
+
+    clock_samples += sample_count;
+    proxy.end_processing((Midi::SampleOffset)sample_count);
+
+    if (proxy.out_events.empty()) {
+        return true;
+    }
+
+    bool const success = write_out_events();
+
+    proxy.begin_processing();
+
+    return success;
+}
+
+
+Bridge::Status Bridge::read_input() noexcept
+{
+    ssize_t const bytes_read = read(
+        input_fd, input + input_size, INPUT_BUFFER_SIZE - input_size
+    );
+
+    if (bytes_read == 0) {
+        return Status::END_OF_INPUT;
+    }
+
+    if (bytes_read < 0) {
+        return (errno == EINTR || errno == EAGAIN) ? Status::IDLE : Status::FAILED;
+    }
+
+    input_size = remove_real_time_messages(input, input_size + (size_t)bytes_read);
+
+    /*
+    The buffer can only fill up with incomplete messages if the input is
+    garbage, e.g. an unterminated System Exclusive message, and those bytes
+    would be skipped anyway.
+    */
+    if (MPE_EMULATOR_UNLIKELY(input_size == INPUT_BUFFER_SIZE)) {
+        input_size = 0;
+    }
+
+    return Status::PROCESSED;
+}
+
+
+bool Bridge::write_out_events() noexcept
+{
+    constexpr size_t max_event_size = 3;
+
+    size_t size = 0;
+
+    for (Proxy::OutEvents::const_iterator it = proxy.out_events.begin(); it != proxy.out_events.end(); ++it) {
+        if (size + max_event_size > OUTPUT_BUFFER_SIZE) {
+            if (!write_all(output, size)) {
+                return false;
+            }
+
+            size = 0;
+        }
+
+        size += encode(*it, output_running_status, output + size);
+    }
+
+    return write_all(output, size);
+}
+
+
+bool Bridge::write_all(Midi::Byte const* const buffer, size_t const size) noexcept
+{
+    size_t written = 0;
+
+    while (written != size) {
+        ssize_t const result = write(output_fd, buffer + written, size - written);
+
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            /*
+            The receiving end has no idea what the running status is after a
+            failed write.
+            */
+            output_running_status = 0;
+
+            return false;
+        }
+
+        written += (size_t)result;
+    }
+
+    return true;
+}
+
+
+Bridge::LatencyStats::LatencyStats() noexcept
+    : count(0),
+    min(0),
+    max(0),
+    total(0)
+{
+}
+
+
+void Bridge::LatencyStats::add(uint64_t const latency_ns) noexcept
+{
+    min = count == 0 ? latency_ns : std::min(min, latency_ns);
+    max = std::max(max, latency_ns);
+    total += latency_ns;
+    ++count;
+}
+
+
+uint64_t Bridge::LatencyStats::get_count() const noexcept
+{
+    return count;
+}
+
+
+uint64_t Bridge::LatencyStats::get_min() const noexcept
+{
+    return min;
+}
+
+
+uint64_t Bridge::LatencyStats::get_max() const noexcept
+{
+    return max;
+}
+
+
+uint64_t Bridge::LatencyStats::get_average() const noexcept
+{
+    return count == 0 ? 0 : total / count;
+}
+
+}
+
+#endif
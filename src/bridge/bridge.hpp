@@ -0,0 +1,179 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPE_EMULATOR__BRIDGE__BRIDGE_HPP
+#define MPE_EMULATOR__BRIDGE__BRIDGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common.hpp"
+#include "midi.hpp"
+#include "proxy.hpp"
+
+
+namespace MpeEmulator
+{
+
+/**
+ * \brief Host a \c Proxy outside of a plugin host: read raw MIDI bytes from a
+ *        file descriptor, and write the MPE output to another one.
+ *
+ * Anything which speaks raw MIDI through a file descriptor can be used as an
+ * endpoint: ALSA rawmidi device nodes (\c /dev/snd/midiC*D*, including the
+ * ones created by the \c snd-virmidi module for reaching ALSA sequencer and
+ * JACK clients), FIFOs, pipes, and serial ports.
+ */
+class Bridge
+{
+    public:
+        static constexpr size_t INPUT_BUFFER_SIZE = 1024;
+        static constexpr size_t OUTPUT_BUFFER_SIZE = 4096;
+
+        /**
+         * \brief The bridge has no audio clock to follow, so the rate limits
+         *        of the rules are timed by converting the monotonic clock into
+         *        samples at this rate.
+         */
+        static constexpr double SAMPLE_RATE = 48000.0;
+
+        /**
+         * \brief Poll timeout which is used while controller values are held
+         *        back by rate limits, so that they are sent within the
+         *        shortest rate limit interval (1000 Hz) after becoming due.
+         */
+        static constexpr int HELD_VALUES_POLL_TIMEOUT_MS = 1;
+
+        /**
+         * \brief Time elapsed between noticing that input is available and
+         *        finishing writing the corresponding output, measured in
+         *        nanoseconds.
+         */
+        class LatencyStats
+        {
+            public:
+                LatencyStats() noexcept;
+
+                void add(uint64_t const latency_ns) noexcept;
+
+                uint64_t get_count() const noexcept;
+                uint64_t get_min() const noexcept;
+                uint64_t get_max() const noexcept;
+                uint64_t get_average() const noexcept;
+
+            private:
+                uint64_t count;
+                uint64_t min;
+                uint64_t max;
+                uint64_t total;
+        };
+
+        enum Status {
+            IDLE = 0,
+            PROCESSED = 1,
+            END_OF_INPUT = 2,
+            FAILED = 3,
+        };
+
+        /**
+         * \brief Return the number of bytes at the beginning of the buffer
+         *        which make up complete messages, assuming the given running
+         *        status. Data bytes which don't belong to a channel message
+         *        are considered complete, since they are skipped anyway.
+         */
+        static size_t find_complete_messages(
+            Midi::Byte const* const buffer,
+            size_t const size,
+            Midi::Byte running_status
+        ) noexcept;
+
+        /**
+         * \brief Remove System Real-Time messages (e.g. MIDI clock), which may
+         *        be interleaved with the bytes of other messages.
+         *
+         * \return The new size of the buffer.
+         */
+        static size_t remove_real_time_messages(
+            Midi::Byte* const buffer,
+            size_t const size
+        ) noexcept;
+
+        /**
+         * \brief Encode an event into raw MIDI bytes, omitting the status byte
+         *        when it matches the running status.
+         *
+         * \return Number of bytes written (at most 3).
+         */
+        static size_t encode(
+            Midi::Event const& event,
+            Midi::Byte& running_status,
+            Midi::Byte* const buffer
+        ) noexcept;
+
+        Bridge(Proxy& proxy, int const input_fd, int const output_fd) noexcept;
+
+        /**
+         * \brief Send the initial MPE Configuration Message and controller
+         *        values.
+         */
+        bool start() noexcept;
+
+        /**
+         * \brief Wait at most \c timeout_ms milliseconds for input (or less
+         *        when controller values are held back by rate limits), send
+         *        the held values which have become due, then process all
+         *        available bytes.
+         */
+        Status process(int const timeout_ms) noexcept;
+
+        /**
+         * \brief Release all notes which are still playing.
+         */
+        bool stop() noexcept;
+
+        LatencyStats const& get_latency_stats() const noexcept;
+
+    private:
+        static uint64_t now_ns() noexcept;
+
+        static size_t get_data_length(Midi::Byte const status) noexcept;
+
+        bool advance_clock() noexcept;
+        Status read_input() noexcept;
+        bool write_out_events() noexcept;
+        bool write_all(Midi::Byte const* const buffer, size_t const size) noexcept;
+
+        Proxy& proxy;
+        int const input_fd;
+        int const output_fd;
+
+        LatencyStats latency_stats;
+
+        uint64_t clock_start_ns;
+        uint64_t clock_samples;
+
+        size_t input_size;
+        Midi::Byte output_running_status;
+
+        Midi::Byte input[INPUT_BUFFER_SIZE];
+        Midi::Byte output[OUTPUT_BUFFER_SIZE];
+};
+
+}
+
+#endif
@@ -0,0 +1,277 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "bridge/bridge.hpp"
+#include "proxy.hpp"
+#include "serializer.hpp"
+
+#include "bridge/bridge.cpp"
+
+
+using namespace MpeEmulator;
+
+
+constexpr int POLL_TIMEOUT_MS = 100;
+constexpr int DEFAULT_PRIORITY = 70;
+
+
+std::atomic<bool> is_stopping(false);
+
+
+struct Options
+{
+    Options()
+        : input_path(NULL),
+        output_path(NULL),
+        settings_path(NULL),
+        priority(DEFAULT_PRIORITY)
+    {
+    }
+
+    char const* input_path;
+    char const* output_path;
+    char const* settings_path;
+    int priority;
+};
+
+
+void usage(char const* const name)
+{
+    fprintf(
+        stderr,
+        (
+            "Usage: %s [-i input] [-o output] [-s settings.mpe] [-p priority]\n\n"
+            "Read MIDI from the input, and write the MPE version of it to the\n"
+            "output. Both can be ALSA rawmidi devices (e.g. /dev/snd/midiC1D0),\n"
+            "FIFOs, or serial ports; the defaults are stdin and stdout.\n\n"
+            "ALSA sequencer and JACK clients can be connected through the\n"
+            "devices of the snd-virmidi kernel module.\n\n"
+            "The processing thread is run with SCHED_FIFO at the given\n"
+            "priority (default: %d, 0 turns realtime scheduling off).\n"
+        ),
+        name,
+        DEFAULT_PRIORITY
+    );
+}
+
+
+bool parse_options(int const argc, char const* const* const argv, Options& options)
+{
+    for (int i = 1; i != argc; ++i) {
+        if (i + 1 == argc || argv[i][0] != '-' || argv[i][1] == '\x00' || argv[i][2] != '\x00') {
+            return false;
+        }
+
+        char const* const value = argv[++i];
+
+        switch (argv[i - 1][1]) {
+            case 'i': options.input_path = value; break;
+            case 'o': options.output_path = value; break;
+            case 's': options.settings_path = value; break;
+            case 'p': options.priority = atoi(value); break;
+            default: return false;
+        }
+    }
+
+    return options.priority >= 0;
+}
+
+
+int open_endpoint(char const* const path, int const flags, int const default_fd)
+{
+    if (path == NULL) {
+        return default_fd;
+    }
+
+    int const fd = open(path, flags | O_NOCTTY, 0666);
+
+    if (fd == -1) {
+        fprintf(stderr, "ERROR: unable to open %s: %s\n", path, strerror(errno));
+    }
+
+    return fd;
+}
+
+
+bool import_settings(Proxy& proxy, char const* const path)
+{
+    std::ifstream settings_file(path, std::ios::in | std::ios::binary);
+
+    if (!settings_file.is_open()) {
+        fprintf(stderr, "ERROR: unable to open %s: %s\n", path, strerror(errno));
+
+        return false;
+    }
+
+    std::ostringstream settings;
+
+    settings << settings_file.rdbuf();
+    Serializer::import_settings_in_audio_thread(proxy, settings.str());
+
+    return true;
+}
+
+
+void* run_bridge(void* const bridge_ptr)
+{
+    Bridge& bridge = *(Bridge*)bridge_ptr;
+
+    if (!bridge.start()) {
+        fprintf(stderr, "ERROR: unable to write output: %s\n", strerror(errno));
+        is_stopping = true;
+
+        return NULL;
+    }
+
+    while (!is_stopping.load()) {
+        Bridge::Status const status = bridge.process(POLL_TIMEOUT_MS);
+
+        if (status == Bridge::Status::FAILED) {
+            fprintf(stderr, "ERROR: unable to process MIDI: %s\n", strerror(errno));
+            break;
+        } else if (status == Bridge::Status::END_OF_INPUT) {
+            break;
+        }
+    }
+
+    bridge.stop();
+
+    return NULL;
+}
+
+
+bool start_thread(pthread_t& thread, Bridge& bridge, int const priority)
+{
+    if (priority > 0) {
+        pthread_attr_t attr;
+        sched_param param;
+
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = priority;
+
+        pthread_attr_init(&attr);
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        pthread_attr_setschedparam(&attr, &param);
+
+        int const error = pthread_create(&thread, &attr, &run_bridge, &bridge);
+
+        pthread_attr_destroy(&attr);
+
+        if (error == 0) {
+            return true;
+        }
+
+        fprintf(
+            stderr,
+            "WARNING: unable to use realtime scheduling (%s), running with normal priority\n",
+            strerror(error)
+        );
+    }
+
+    return pthread_create(&thread, NULL, &run_bridge, &bridge) == 0;
+}
+
+
+void stop(int const signal_number)
+{
+    is_stopping = true;
+}
+
+
+int main(int const argc, char const* const* const argv)
+{
+    Options options;
+
+    if (!parse_options(argc, argv, options)) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    Proxy* const proxy = new Proxy();
+
+    if (options.settings_path != NULL && !import_settings(*proxy, options.settings_path)) {
+        delete proxy;
+
+        return 1;
+    }
+
+    int const input_fd = open_endpoint(options.input_path, O_RDONLY, STDIN_FILENO);
+    int const output_fd = open_endpoint(
+        options.output_path, O_WRONLY | O_CREAT | O_APPEND, STDOUT_FILENO
+    );
+
+    if (input_fd == -1 || output_fd == -1) {
+        delete proxy;
+
+        return 1;
+    }
+
+    Bridge* const bridge = new Bridge(*proxy, input_fd, output_fd);
+    pthread_t thread;
+
+    signal(SIGINT, &stop);
+    signal(SIGTERM, &stop);
+    signal(SIGPIPE, SIG_IGN);
+
+    /* Page faults in the processing thread would add to the latency. */
+    if (options.priority > 0 && mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        fprintf(stderr, "WARNING: unable to lock memory: %s\n", strerror(errno));
+    }
+
+    if (!start_thread(thread, *bridge, options.priority)) {
+        fprintf(stderr, "ERROR: unable to start the processing thread\n");
+
+        return 1;
+    }
+
+    pthread_join(thread, NULL);
+
+    Bridge::LatencyStats const& latency = bridge->get_latency_stats();
+
+    fprintf(
+        stderr,
+        "Processed %llu input batches, latency: min=%.1fus avg=%.1fus max=%.1fus\n",
+        (unsigned long long)latency.get_count(),
+        (double)latency.get_min() / 1000.0,
+        (double)latency.get_average() / 1000.0,
+        (double)latency.get_max() / 1000.0
+    );
+
+    delete bridge;
+    delete proxy;
+
+    return 0;
+}
@@ -19,6 +19,12 @@
 #ifndef MPE_EMULATOR__DEBUG_HPP
 #define MPE_EMULATOR__DEBUG_HPP
 
+/*
+MPE_EMULATOR_DEBUG() formats the message and opens, writes, and closes the log
+file on the calling thread; on the audio thread, MPE_EMULATOR_TRACE() from
+trace.hpp should be used instead.
+*/
+
 #ifndef MPE_EMULATOR_DEBUG_LOG
 
 #define MPE_EMULATOR_DEBUG(message_template, ...)
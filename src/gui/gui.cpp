@@ -49,6 +49,9 @@ const GUI::Color GUI::TEXT_HIGHLIGHT_BACKGROUND = GUI::rgb(82, 82, 86);
 const GUI::Color GUI::STATUS_LINE_BACKGROUND = GUI::rgb(21, 21, 32);
 const GUI::Color GUI::TOGGLE_OFF_COLOR = GUI::rgb(0, 0, 0);
 const GUI::Color GUI::TOGGLE_ON_COLOR = GUI::rgb(150, 200, 230);
+const GUI::Color GUI::CHANNEL_FREE_COLOR = GUI::rgb(36, 40, 58);
+const GUI::Color GUI::CHANNEL_ACTIVE_COLOR = GUI::rgb(150, 200, 230);
+const GUI::Color GUI::CHANNEL_SUSTAINED_COLOR = GUI::rgb(220, 180, 110);
 
 
 constexpr GUI::ColorComponent GUI::red(Color const color)
@@ -180,6 +183,146 @@ constexpr int pos_rel_offset_top = 0;
     )
 
 
+std::atomic_flag GUI::SharedImages::Lock::flag = ATOMIC_FLAG_INIT;
+
+GUI::SharedImages* GUI::SharedImages::instance = NULL;
+
+size_t GUI::SharedImages::references = 0;
+
+
+GUI::SharedImages::Lock::Lock()
+{
+    while (flag.test_and_set(std::memory_order_acquire)) {
+    }
+}
+
+
+GUI::SharedImages::Lock::~Lock()
+{
+    flag.clear(std::memory_order_release);
+}
+
+
+GUI::SharedImages const* GUI::SharedImages::acquire(PlatformData platform_data)
+{
+    {
+        Lock lock;
+
+        if (instance != NULL) {
+            ++references;
+
+            return instance;
+        }
+    }
+
+    /*
+    If another editor is opened meanwhile, then both of them load the images,
+    and the one which finishes later throws its own copy away.
+    */
+    SharedImages* const loaded = new SharedImages(platform_data);
+    SharedImages* discarded = NULL;
+    SharedImages const* acquired;
+
+    {
+        Lock lock;
+
+        if (instance == NULL) {
+            instance = loaded;
+        } else {
+            discarded = loaded;
+        }
+
+        ++references;
+        acquired = instance;
+    }
+
+    delete discarded;
+
+    return acquired;
+}
+
+
+void GUI::SharedImages::release()
+{
+    SharedImages* released = NULL;
+
+    {
+        Lock lock;
+
+        MPE_EMULATOR_ASSERT(references > 0);
+
+        --references;
+
+        if (references == 0) {
+            released = instance;
+            instance = NULL;
+        }
+    }
+
+    delete released;
+}
+
+
+GUI::SharedImages::SharedImages(PlatformData platform_data)
+    : dummy_widget(new Widget("")),
+    about_image(dummy_widget->load_image(platform_data, "ABOUT")),
+    zone_1_image(dummy_widget->load_image(platform_data, "ZONE1")),
+    vst_logo_image(dummy_widget->load_image(platform_data, "VSTLOGO")),
+    knob_states(
+        new ParamStateImages(
+            dummy_widget,
+            dummy_widget->load_image(platform_data, "KNOBSTATES"),
+            128,
+            48,
+            48
+        )
+    ),
+    rocker_switch(
+        new ParamStateImages(
+            dummy_widget,
+            dummy_widget->load_image(platform_data, "ROCKERSWITCH"),
+            2,
+            48,
+            48
+        )
+    ),
+    distortions(
+        new ParamStateImages(
+            dummy_widget,
+            dummy_widget->load_image(platform_data, "DISTORTIONS"),
+            4,
+            21,
+            21
+        )
+    ),
+    midpoint_states(
+        new ParamStateImages(
+            dummy_widget,
+            dummy_widget->load_image(platform_data, "MIDPOINT"),
+            128,
+            21,
+            21
+        )
+    )
+{
+}
+
+
+GUI::SharedImages::~SharedImages()
+{
+    delete knob_states;
+    delete rocker_switch;
+    delete distortions;
+    delete midpoint_states;
+
+    dummy_widget->delete_image(about_image);
+    dummy_widget->delete_image(zone_1_image);
+    dummy_widget->delete_image(vst_logo_image);
+
+    delete dummy_widget;
+}
+
+
 GUI::GUI(
         char const* const sdk_version,
         PlatformData platform_data,
@@ -188,7 +331,7 @@ GUI::GUI(
         bool const show_vst_logo
 )
     : show_vst_logo(show_vst_logo),
-    dummy_widget(NULL),
+    images(NULL),
     background(NULL),
     about_body(NULL),
     zone_1_body(NULL),
@@ -196,57 +339,23 @@ GUI::GUI(
     proxy(proxy),
     platform_data(platform_data),
     active_voices_count(0),
-    polyphony(0)
+    polyphony(0),
+    suppressed_duplicates_count(0),
+    dropped_events_count(0)
 {
     default_status_line[0] = '\x00';
     update_active_voices_count();
 
     initialize();
 
-    dummy_widget = new Widget("");
-
-    knob_states = new ParamStateImages(
-        dummy_widget,
-        dummy_widget->load_image(this->platform_data, "KNOBSTATES"),
-        128,
-        48,
-        48
-    );
-
-    rocker_switch = new ParamStateImages(
-        dummy_widget,
-        dummy_widget->load_image(this->platform_data, "ROCKERSWITCH"),
-        2,
-        48,
-        48
-    );
-
-    distortions = new ParamStateImages(
-        dummy_widget,
-        dummy_widget->load_image(this->platform_data, "DISTORTIONS"),
-        4,
-        21,
-        21
-    );
-
-    midpoint_states = new ParamStateImages(
-        dummy_widget,
-        dummy_widget->load_image(this->platform_data, "MIDPOINT"),
-        128,
-        21,
-        21
-    );
-
-    about_image = dummy_widget->load_image(this->platform_data, "ABOUT");
-    zone_1_image = dummy_widget->load_image(this->platform_data, "ZONE1");
-    vst_logo_image = dummy_widget->load_image(this->platform_data, "VSTLOGO");
+    images = SharedImages::acquire(this->platform_data);
 
     background = new Background();
 
     this->parent_window = new ExternallyCreatedWindow(this->platform_data, parent_window);
     this->parent_window->own(background);
 
-    background->set_image(zone_1_image);
+    background->set_image(images->zone_1_image);
 
     status_line = new StatusLine();
     status_line->set_text("");
@@ -255,17 +364,17 @@ GUI::GUI(
 
     build_about_body(sdk_version);
     build_zone_1_body(
-        knob_states,
-        rocker_switch,
-        distortions,
-        midpoint_states,
+        images->knob_states,
+        images->rocker_switch,
+        images->distortions,
+        images->midpoint_states,
         controller_selector
     );
 
     background->own(
         new TabSelector(
             background,
-            zone_1_image,
+            images->zone_1_image,
             zone_1_body,
             "Settings",
             TabSelector::LEFT + TabSelector::WIDTH * 0
@@ -274,7 +383,7 @@ GUI::GUI(
     background->own(
         new TabSelector(
             background,
-            about_image,
+            images->about_image,
             about_body,
             "About",
             TabSelector::LEFT + TabSelector::WIDTH * 1
@@ -316,12 +425,12 @@ GUI::GUI(
 
 void GUI::build_about_body(char const* const sdk_version)
 {
-    about_body = new TabBody(*this, "About");
+    about_body = new TabBody(*this, proxy, "About");
 
     background->own(about_body);
 
     ((Widget*)about_body)->own(
-        new AboutText(sdk_version, show_vst_logo ? vst_logo_image : NULL)
+        new AboutText(sdk_version, show_vst_logo ? images->vst_logo_image : NULL)
     );
 
     about_body->hide();
@@ -335,7 +444,7 @@ void GUI::build_zone_1_body(
         ParamStateImages const* const midpoint_states,
         OptionSelector* const controller_selector
 ) {
-    zone_1_body = new TabBody(*this, "Settings");
+    zone_1_body = new TabBody(*this, proxy, "Settings");
 
     background->own(zone_1_body);
 
@@ -365,6 +474,107 @@ void GUI::build_zone_1_body(
 
     POSITION_RELATIVE_END();
 
+    zone_1_body->own(new ChannelMap(*this, proxy));
+
+    ((Widget*)zone_1_body)->own(new SplitsPanel());
+
+    POSITION_RELATIVE_BEGIN(SplitsPanel::LEFT, SplitsPanel::TOP);
+
+    DPET(
+        zone_1_body,
+        SplitsPanel::SEPARATE_CHANNELS_LEFT,
+        SplitsPanel::SEPARATE_CHANNELS_TOP,
+        SplitsPanel::SEPARATE_CHANNELS_WIDTH,
+        SplitsPanel::VALUE_HEIGHT,
+        0,
+        SplitsPanel::SEPARATE_CHANNELS_WIDTH,
+        Proxy::ParamId::Z1SPP
+    );
+    DPET(
+        zone_1_body,
+        SplitsPanel::LOWER_SPLIT_POINT_LEFT,
+        SplitsPanel::SPLITS_TOP,
+        SplitsPanel::SPLIT_POINT_WIDTH,
+        SplitsPanel::VALUE_HEIGHT,
+        0,
+        SplitsPanel::SPLIT_POINT_WIDTH,
+        Proxy::ParamId::Z1SPL
+    );
+    DPET(
+        zone_1_body,
+        SplitsPanel::TRANSPOSE_BELOW_LOWER_LEFT,
+        SplitsPanel::SPLITS_TOP,
+        SplitsPanel::TRANSPOSE_WIDTH,
+        SplitsPanel::VALUE_HEIGHT,
+        0,
+        SplitsPanel::TRANSPOSE_WIDTH,
+        Proxy::ParamId::Z1TRL
+    );
+    DPET(
+        zone_1_body,
+        SplitsPanel::UPPER_SPLIT_POINT_LEFT,
+        SplitsPanel::SPLITS_TOP,
+        SplitsPanel::SPLIT_POINT_WIDTH,
+        SplitsPanel::VALUE_HEIGHT,
+        0,
+        SplitsPanel::SPLIT_POINT_WIDTH,
+        Proxy::ParamId::Z1SPH
+    );
+    DPET(
+        zone_1_body,
+        SplitsPanel::TRANSPOSE_ABOVE_UPPER_LEFT,
+        SplitsPanel::SPLITS_TOP,
+        SplitsPanel::TRANSPOSE_WIDTH,
+        SplitsPanel::VALUE_HEIGHT,
+        0,
+        SplitsPanel::TRANSPOSE_WIDTH,
+        Proxy::ParamId::Z1TRH
+    );
+
+    for (size_t i = 0; i != Proxy::RULES; ++i) {
+        DPET(
+            zone_1_body,
+            SplitsPanel::get_scope_left(i),
+            SplitsPanel::get_scope_top(i),
+            SplitsPanel::SCOPE_WIDTH,
+            SplitsPanel::VALUE_HEIGHT,
+            0,
+            SplitsPanel::SCOPE_WIDTH,
+            (Proxy::ParamId)((int)Proxy::ParamId::Z1R1SC + (int)i)
+        );
+    }
+
+    POSITION_RELATIVE_END();
+
+    ((Widget*)zone_1_body)->own(new RateLimitsPanel());
+
+    POSITION_RELATIVE_BEGIN(RateLimitsPanel::LEFT, RateLimitsPanel::TOP);
+
+    for (size_t i = 0; i != Proxy::RULES; ++i) {
+        DPET(
+            zone_1_body,
+            RateLimitsPanel::get_rate_limit_left(i),
+            0,
+            RateLimitsPanel::RATE_LIMIT_WIDTH,
+            RateLimitsPanel::VALUE_HEIGHT,
+            0,
+            RateLimitsPanel::RATE_LIMIT_WIDTH,
+            (Proxy::ParamId)((int)Proxy::ParamId::Z1R1RL + (int)i)
+        );
+        DPET(
+            zone_1_body,
+            RateLimitsPanel::get_deadband_left(i),
+            0,
+            RateLimitsPanel::DEADBAND_WIDTH,
+            RateLimitsPanel::VALUE_HEIGHT,
+            0,
+            RateLimitsPanel::DEADBAND_WIDTH,
+            (Proxy::ParamId)((int)Proxy::ParamId::Z1R1DB + (int)i)
+        );
+    }
+
+    POSITION_RELATIVE_END();
+
 
     POSITION_RELATIVE_BEGIN(18, 149);
 
@@ -527,18 +737,8 @@ GUI::~GUI()
 {
     delete parent_window;
 
-    delete knob_states;
-    delete rocker_switch;
-    delete distortions;
-    delete midpoint_states;
-
-    dummy_widget->delete_image(about_image);
-    dummy_widget->delete_image(zone_1_image);
-    dummy_widget->delete_image(vst_logo_image);
-
-    delete dummy_widget;
-
-    dummy_widget = NULL;
+    images = NULL;
+    SharedImages::release();
 
     destroy();
 }
@@ -554,24 +754,56 @@ void GUI::update_active_voices_count()
 {
     unsigned int const old_active_voices_count = active_voices_count;
     unsigned int const old_polyphony = polyphony;
+    unsigned int const old_suppressed_duplicates_count = suppressed_duplicates_count;
+    unsigned int const old_dropped_events_count = dropped_events_count;
 
     active_voices_count = proxy.get_active_voices_count();
     polyphony = proxy.get_channel_count();
-
-    if (active_voices_count == old_active_voices_count && polyphony == old_polyphony) {
+    suppressed_duplicates_count = proxy.get_suppressed_duplicates_count();
+    dropped_events_count = proxy.get_dropped_events_count();
+
+    if (
+            active_voices_count == old_active_voices_count
+            && polyphony == old_polyphony
+            && suppressed_duplicates_count == old_suppressed_duplicates_count
+            && dropped_events_count == old_dropped_events_count
+    ) {
         return;
     }
 
-    if (active_voices_count < 1) {
+    if (
+            active_voices_count < 1
+            && suppressed_duplicates_count < 1
+            && dropped_events_count < 1
+    ) {
         default_status_line[0] = '\x00';
     } else {
-        snprintf(
+        int length = snprintf(
             default_status_line,
             DEFAULT_STATUS_LINE_MAX_LENGTH,
             "Voices: %u / %u",
             active_voices_count,
             polyphony
         );
+
+        if (suppressed_duplicates_count > 0 && length > 0) {
+            length += snprintf(
+                default_status_line + length,
+                DEFAULT_STATUS_LINE_MAX_LENGTH - (size_t)length,
+                ", clones: %u",
+                suppressed_duplicates_count
+            );
+        }
+
+        if (dropped_events_count > 0 && length > 0) {
+            snprintf(
+                default_status_line + length,
+                DEFAULT_STATUS_LINE_MAX_LENGTH - (size_t)length,
+                ", lost: %u",
+                dropped_events_count
+            );
+        }
+
         default_status_line[DEFAULT_STATUS_LINE_MAX_LENGTH - 1] = '\x00';
     }
 
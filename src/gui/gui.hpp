@@ -19,6 +19,7 @@
 #ifndef MPE_EMULATOR__GUI__GUI_HPP
 #define MPE_EMULATOR__GUI__GUI_HPP
 
+#include <atomic>
 #include <cstddef>
 #include <vector>
 
@@ -30,6 +31,7 @@ namespace MpeEmulator
 {
 
 class Background;
+class ChannelMap;
 class ExportSettingsButton;
 class ExternallyCreatedWindow;
 class ImportSettingsButton;
@@ -105,6 +107,9 @@ class GUI
         static Color const STATUS_LINE_BACKGROUND;
         static Color const TOGGLE_OFF_COLOR;
         static Color const TOGGLE_ON_COLOR;
+        static Color const CHANNEL_FREE_COLOR;
+        static Color const CHANNEL_ACTIVE_COLOR;
+        static Color const CHANNEL_SUSTAINED_COLOR;
 
         static void param_ratio_to_str(
             Proxy const& synth,
@@ -144,7 +149,53 @@ class GUI
         PlatformData get_platform_data() const;
 
     private:
-        static constexpr size_t DEFAULT_STATUS_LINE_MAX_LENGTH = 32;
+        static constexpr size_t DEFAULT_STATUS_LINE_MAX_LENGTH = 64;
+
+        /**
+         * \brief Images never change after loading, so all GUI instances in
+         *        the process share a single reference counted copy of them,
+         *        and only the first editor pays the price of decoding them.
+         */
+        class SharedImages
+        {
+            public:
+                static SharedImages const* acquire(PlatformData platform_data);
+                static void release();
+
+                explicit SharedImages(PlatformData platform_data);
+                ~SharedImages();
+
+                Widget* const dummy_widget;
+
+                Image const about_image;
+                Image const zone_1_image;
+                Image const vst_logo_image;
+
+                ParamStateImages const* const knob_states;
+                ParamStateImages const* const rocker_switch;
+                ParamStateImages const* const distortions;
+                ParamStateImages const* const midpoint_states;
+
+            private:
+                /*
+                Editors are opened and closed rarely, and the images are
+                loaded and freed outside the lock, so it only guards a pointer
+                and a counter. A spin lock is good enough for that, and unlike
+                std::mutex, it is available with every MinGW threading model.
+                */
+                class Lock
+                {
+                    public:
+                        Lock();
+                        ~Lock();
+
+                    private:
+                        static std::atomic_flag flag;
+                };
+
+                static SharedImages* instance;
+                static size_t references;
+        };
 
         static void param_ratio_to_str_float(
             Proxy const& synth,
@@ -191,16 +242,8 @@ class GUI
 
         char default_status_line[DEFAULT_STATUS_LINE_MAX_LENGTH];
 
-        Widget* dummy_widget;
-
-        Image about_image;
-        Image zone_1_image;
-        Image vst_logo_image;
+        SharedImages const* images;
 
-        ParamStateImages const* knob_states;
-        ParamStateImages const* rocker_switch;
-        ParamStateImages const* distortions;
-        ParamStateImages const* midpoint_states;
         Background* background;
         OptionSelector* controller_selector;
         OptionSelector* target_selector;
@@ -214,6 +257,8 @@ class GUI
 
         unsigned int active_voices_count;
         unsigned int polyphony;
+        unsigned int suppressed_duplicates_count;
+        unsigned int dropped_events_count;
 };
 
 
@@ -238,6 +283,9 @@ class WidgetBase
             DISCRETE_PARAM_EDITOR = 1 << 11,
             OPTION_SELECTOR = 1 << 12,
             OPTION = 1 << 13,
+            CHANNEL_MAP = 1 << 14,
+            SPLITS_PANEL = 1 << 15,
+            RATE_LIMITS_PANEL = 1 << 16,
         };
 
         enum TextAlignment {
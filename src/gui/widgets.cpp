@@ -147,8 +147,10 @@ bool ExportSettingsButton::mouse_leave(int const x, int const y)
 }
 
 
-TabBody::TabBody(GUI& gui, char const* const text)
-    : TransparentWidget(text, LEFT, TOP, WIDTH, HEIGHT, Type::TAB_BODY)
+TabBody::TabBody(GUI& gui, Proxy& proxy, char const* const text)
+    : TransparentWidget(text, LEFT, TOP, WIDTH, HEIGHT, Type::TAB_BODY),
+    proxy(proxy),
+    channel_map(NULL)
 {
     set_gui(gui);
 }
@@ -184,6 +186,16 @@ DiscreteParamEditor* TabBody::own(DiscreteParamEditor* const discrete_param_edit
 }
 
 
+ChannelMap* TabBody::own(ChannelMap* const channel_map)
+{
+    Widget::own(channel_map);
+
+    this->channel_map = channel_map;
+
+    return channel_map;
+}
+
+
 void TabBody::stop_editing()
 {
     for (GUI::KnobParamEditors::iterator it = knob_param_editors.begin(); it != knob_param_editors.end(); ++it) {
@@ -206,6 +218,49 @@ void TabBody::refresh_all_params()
         (*it)->refresh();
     }
 
+    if (channel_map != NULL) {
+        channel_map->refresh();
+    }
+
+    gui->update_active_voices_count();
+}
+
+
+void TabBody::refresh_changed_params()
+{
+    /*
+    Only the visible body is refreshed, so the changes of parameters which
+    belong to hidden bodies are dropped here, but a body is fully refreshed
+    when it becomes visible.
+    */
+    Proxy::ChangedParams changed_params;
+
+    proxy.collect_changed_params(changed_params);
+
+    if (!changed_params.is_empty()) {
+        for (GUI::KnobParamEditors::iterator it = knob_param_editors.begin(); it != knob_param_editors.end(); ++it) {
+            if (changed_params.contains((*it)->param_id)) {
+                (*it)->refresh();
+            }
+        }
+
+        for (GUI::ToggleSwitchParamEditors::iterator it = toggle_switch_param_editors.begin(); it != toggle_switch_param_editors.end(); ++it) {
+            if (changed_params.contains((*it)->param_id)) {
+                (*it)->refresh();
+            }
+        }
+
+        for (GUI::DiscreteParamEditors::iterator it = discrete_param_editors.begin(); it != discrete_param_editors.end(); ++it) {
+            if (changed_params.contains((*it)->param_id)) {
+                (*it)->refresh();
+            }
+        }
+    }
+
+    if (channel_map != NULL) {
+        channel_map->refresh();
+    }
+
     gui->update_active_voices_count();
 }
 
@@ -213,7 +268,7 @@ void TabBody::refresh_all_params()
 Background::Background()
     : Widget("MPE Emulator", 0, 0, GUI::WIDTH, GUI::HEIGHT, Type::BACKGROUND),
     body(NULL),
-    next_full_refresh(FULL_REFRESH_TICKS)
+    next_refresh(REFRESH_TICKS)
 {
 }
 
@@ -256,11 +311,11 @@ void Background::refresh()
         return;
     }
 
-    --next_full_refresh;
+    --next_refresh;
 
-    if (next_full_refresh == 0) {
-        next_full_refresh = FULL_REFRESH_TICKS;
-        body->refresh_all_params();
+    if (next_refresh == 0) {
+        next_refresh = REFRESH_TICKS;
+        body->refresh_changed_params();
     }
 }
 
@@ -285,6 +340,7 @@ void TabSelector::click()
 
     background->set_image(tab_image);
     background->replace_body(tab_body);
+    tab_body->refresh_all_params();
 }
 
 
@@ -1097,6 +1153,323 @@ bool StatusLine::paint()
 }
 
 
+char const* const ChannelMap::NOTE_NAMES[] = {
+    "C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B",
+};
+
+
+ChannelMap::ChannelMap(GUI& gui, Proxy& proxy)
+    : TransparentWidget("Channels", LEFT, TOP, WIDTH, HEIGHT, Type::CHANNEL_MAP),
+    proxy(proxy),
+    voice_stats(proxy.get_voice_stats())
+{
+    set_gui(gui);
+}
+
+
+void ChannelMap::refresh()
+{
+    Proxy::VoiceStats const new_voice_stats = proxy.get_voice_stats();
+
+    if (is_equal(voice_stats, new_voice_stats)) {
+        return;
+    }
+
+    voice_stats = new_voice_stats;
+    redraw();
+}
+
+
+bool ChannelMap::is_equal(
+        Proxy::VoiceStats const& a,
+        Proxy::VoiceStats const& b
+) {
+    return (
+        std::equal(a.channel_states, a.channel_states + Midi::CHANNELS, b.channel_states)
+        && std::equal(a.notes, a.notes + Midi::CHANNELS, b.notes)
+        && std::equal(
+            a.steals, a.steals + Proxy::VoiceStats::EXCESS_NOTE_HANDLINGS, b.steals
+        )
+        && a.retriggered_notes == b.retriggered_notes
+        && a.dropped_notes == b.dropped_notes
+        && a.deferred_note_offs == b.deferred_note_offs
+        && a.active_voices == b.active_voices
+        && a.peak_voices == b.peak_voices
+        && a.channel_count == b.channel_count
+    );
+}
+
+
+bool ChannelMap::paint()
+{
+    TransparentWidget::paint();
+
+    char line[TEXT_MAX_LENGTH];
+
+    fill_rectangle(0, 0, WIDTH, HEIGHT, GUI::STATUS_LINE_BACKGROUND);
+
+    snprintf(
+        line,
+        TEXT_MAX_LENGTH,
+        "Voices: %u / %u    Peak: %u",
+        (unsigned int)voice_stats.active_voices,
+        (unsigned int)voice_stats.channel_count,
+        (unsigned int)voice_stats.peak_voices
+    );
+    draw_line(line, 0);
+
+    for (Midi::Channel channel = 0; channel != Midi::CHANNELS; ++channel) {
+        draw_channel(channel);
+    }
+
+    snprintf(
+        line,
+        TEXT_MAX_LENGTH,
+        "Steals: %s %u, %s %u, %s %u, %s %u",
+        Strings::EXCESS_NOTE_HANDLINGS[Proxy::ExcessNoteHandling::ENH_STEAL_LOWEST],
+        (unsigned int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_STEAL_LOWEST],
+        Strings::EXCESS_NOTE_HANDLINGS[Proxy::ExcessNoteHandling::ENH_STEAL_HIGHEST],
+        (unsigned int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_STEAL_HIGHEST],
+        Strings::EXCESS_NOTE_HANDLINGS[Proxy::ExcessNoteHandling::ENH_STEAL_OLDEST],
+        (unsigned int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_STEAL_OLDEST],
+        Strings::EXCESS_NOTE_HANDLINGS[Proxy::ExcessNoteHandling::ENH_STEAL_NEWEST],
+        (unsigned int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_STEAL_NEWEST]
+    );
+    draw_line(line, COUNTERS_TOP);
+
+    snprintf(
+        line,
+        TEXT_MAX_LENGTH,
+        "Retriggered: %u    Dropped: %u    Sustained: %u",
+        (unsigned int)voice_stats.retriggered_notes,
+        (unsigned int)voice_stats.dropped_notes,
+        (unsigned int)voice_stats.deferred_note_offs
+    );
+    draw_line(line, COUNTERS_TOP + LINE_HEIGHT);
+
+    return true;
+}
+
+
+void ChannelMap::draw_line(char const* const text, int const top)
+{
+    draw_text(
+        text,
+        FONT_SIZE,
+        0,
+        top,
+        WIDTH,
+        LINE_HEIGHT,
+        GUI::TEXT_COLOR,
+        GUI::STATUS_LINE_BACKGROUND,
+        FontWeight::NORMAL,
+        PADDING,
+        TextAlignment::LEFT
+    );
+}
+
+
+void ChannelMap::draw_channel(Midi::Channel const channel)
+{
+    Midi::Note const note = voice_stats.notes[channel];
+    int const left = CELLS_LEFT + (channel % CELLS_PER_ROW) * (CELL_WIDTH + CELL_GAP);
+    int const top = CELLS_TOP + (channel / CELLS_PER_ROW) * (CELL_HEIGHT + CELL_GAP);
+    char label[8];
+    GUI::Color color;
+    GUI::Color background;
+    bool shows_note = false;
+
+    switch ((Proxy::VoiceStats::ChannelState)voice_stats.channel_states[channel]) {
+        case Proxy::VoiceStats::ChannelState::CS_MANAGER:
+            color = GUI::TEXT_HIGHLIGHT_COLOR;
+            background = GUI::TEXT_HIGHLIGHT_BACKGROUND;
+            break;
+
+        case Proxy::VoiceStats::ChannelState::CS_FREE:
+            color = GUI::TEXT_COLOR;
+            background = GUI::CHANNEL_FREE_COLOR;
+            break;
+
+        case Proxy::VoiceStats::ChannelState::CS_ACTIVE:
+            color = GUI::TEXT_BACKGROUND;
+            background = GUI::CHANNEL_ACTIVE_COLOR;
+            shows_note = true;
+            break;
+
+        case Proxy::VoiceStats::ChannelState::CS_SUSTAINED:
+            color = GUI::TEXT_BACKGROUND;
+            background = GUI::CHANNEL_SUSTAINED_COLOR;
+            shows_note = true;
+            break;
+
+        default:
+            color = GUI::TEXT_HIGHLIGHT_BACKGROUND;
+            background = GUI::TEXT_BACKGROUND;
+            break;
+    }
+
+    if (shows_note) {
+        snprintf(label, 8, "%s%d", NOTE_NAMES[note % 12], (int)(note / 12) - 1);
+    } else {
+        snprintf(label, 8, "%d", (int)channel + 1);
+    }
+
+    draw_text(
+        label,
+        FONT_SIZE,
+        left,
+        top,
+        CELL_WIDTH,
+        CELL_HEIGHT,
+        color,
+        background,
+        FontWeight::NORMAL,
+        0,
+        TextAlignment::CENTER
+    );
+}
+
+
+SplitsPanel::SplitsPanel()
+    : TransparentWidget("Splits", LEFT, TOP, WIDTH, HEIGHT, Type::SPLITS_PANEL)
+{
+}
+
+
+bool SplitsPanel::paint()
+{
+    TransparentWidget::paint();
+
+    fill_rectangle(0, 0, WIDTH, HEIGHT, GUI::STATUS_LINE_BACKGROUND);
+
+    draw_label(
+        "Splits", 0, SEPARATE_CHANNELS_TOP, 100, FontWeight::BOLD, TextAlignment::LEFT
+    );
+    draw_label(
+        "Own channels",
+        100,
+        SEPARATE_CHANNELS_TOP,
+        SEPARATE_CHANNELS_LEFT - 100
+    );
+
+    draw_label("Lower", 0, SPLITS_TOP, LOWER_SPLIT_POINT_LEFT);
+    draw_label(
+        "TR",
+        LOWER_SPLIT_POINT_LEFT + SPLIT_POINT_WIDTH,
+        SPLITS_TOP,
+        TRANSPOSE_BELOW_LOWER_LEFT - LOWER_SPLIT_POINT_LEFT - SPLIT_POINT_WIDTH
+    );
+    draw_label(
+        "Upper",
+        TRANSPOSE_BELOW_LOWER_LEFT + TRANSPOSE_WIDTH,
+        SPLITS_TOP,
+        UPPER_SPLIT_POINT_LEFT - TRANSPOSE_BELOW_LOWER_LEFT - TRANSPOSE_WIDTH
+    );
+    draw_label(
+        "TR",
+        UPPER_SPLIT_POINT_LEFT + SPLIT_POINT_WIDTH,
+        SPLITS_TOP,
+        TRANSPOSE_ABOVE_UPPER_LEFT - UPPER_SPLIT_POINT_LEFT - SPLIT_POINT_WIDTH
+    );
+
+    draw_label(
+        "Rule split scopes",
+        0,
+        (SPLITS_TOP + SCOPES_TOP) / 2,
+        WIDTH,
+        FontWeight::NORMAL,
+        TextAlignment::LEFT
+    );
+
+    for (size_t i = 0; i != Proxy::RULES; ++i) {
+        char label[8];
+
+        snprintf(label, 8, "R%d", (int)i + 1);
+        draw_label(
+            label,
+            get_scope_left(i) - SCOPE_LABEL_WIDTH,
+            get_scope_top(i),
+            SCOPE_LABEL_WIDTH - 2
+        );
+    }
+
+    return true;
+}
+
+
+void SplitsPanel::draw_label(
+        char const* const text,
+        int const left,
+        int const top,
+        int const width,
+        FontWeight const font_weight,
+        TextAlignment const alignment
+) {
+    draw_text(
+        text,
+        FONT_SIZE,
+        left,
+        top,
+        width,
+        VALUE_HEIGHT,
+        GUI::TEXT_COLOR,
+        GUI::STATUS_LINE_BACKGROUND,
+        font_weight,
+        alignment == TextAlignment::LEFT ? PADDING : 3,
+        alignment
+    );
+}
+
+
+RateLimitsPanel::RateLimitsPanel()
+    : TransparentWidget("Limits", LEFT, TOP, WIDTH, HEIGHT, Type::RATE_LIMITS_PANEL)
+{
+}
+
+
+bool RateLimitsPanel::paint()
+{
+    TransparentWidget::paint();
+
+    fill_rectangle(0, 0, WIDTH, HEIGHT, GUI::STATUS_LINE_BACKGROUND);
+
+    draw_text(
+        "Limits",
+        FONT_SIZE,
+        0,
+        0,
+        TITLE_WIDTH,
+        VALUE_HEIGHT,
+        GUI::TEXT_COLOR,
+        GUI::STATUS_LINE_BACKGROUND,
+        FontWeight::BOLD,
+        PADDING,
+        TextAlignment::LEFT
+    );
+
+    for (size_t i = 0; i != Proxy::RULES; ++i) {
+        char label[8];
+
+        snprintf(label, 8, "R%d", (int)i + 1);
+        draw_text(
+            label,
+            FONT_SIZE,
+            get_rate_limit_left(i) - RULE_LABEL_WIDTH,
+            0,
+            RULE_LABEL_WIDTH - 2,
+            VALUE_HEIGHT,
+            GUI::TEXT_COLOR,
+            GUI::STATUS_LINE_BACKGROUND,
+            FontWeight::NORMAL,
+            3,
+            TextAlignment::RIGHT
+        );
+    }
+
+    return true;
+}
+
+
 ToggleSwitchParamEditor::ToggleSwitchParamEditor(
         GUI& gui,
         int const left,
@@ -119,22 +119,27 @@ class TabBody : public TransparentWidget
         static constexpr int WIDTH = GUI::WIDTH;
         static constexpr int HEIGHT = GUI::HEIGHT - TOP;
 
-        explicit TabBody(GUI& gui, char const* const text);
+        TabBody(GUI& gui, Proxy& proxy, char const* const text);
 
         using TransparentWidget::own;
 
         KnobParamEditor* own(KnobParamEditor* const knob_param_editor);
         ToggleSwitchParamEditor* own(ToggleSwitchParamEditor* const toggle_switch_param_editor);
         DiscreteParamEditor* own(DiscreteParamEditor* const discrete_param_editor);
+        ChannelMap* own(ChannelMap* const channel_map);
 
         void stop_editing();
 
         void refresh_all_params();
+        void refresh_changed_params();
 
     private:
+        Proxy& proxy;
+
         GUI::KnobParamEditors knob_param_editors;
         GUI::ToggleSwitchParamEditors toggle_switch_param_editors;
         GUI::DiscreteParamEditors discrete_param_editors;
+        ChannelMap* channel_map;
 };
 
 
@@ -150,10 +155,10 @@ class Background : public Widget
         void refresh();
 
     private:
-        static constexpr int FULL_REFRESH_TICKS = 3;
+        static constexpr int REFRESH_TICKS = 3;
 
         TabBody* body;
-        int next_full_refresh;
+        int next_refresh;
 };
 
 
@@ -513,6 +518,162 @@ class StatusLine : public TransparentWidget
 };
 
 
+/**
+ * \brief Live view of \c Proxy::VoiceStats: what each MIDI channel is doing,
+ *        and the counters which tell why notes may have been cut off.
+ */
+class ChannelMap : public TransparentWidget
+{
+    public:
+        static constexpr int LEFT = 697;
+        static constexpr int TOP = 11;
+        static constexpr int WIDTH = 265;
+        static constexpr int HEIGHT = 120;
+
+        ChannelMap(GUI& gui, Proxy& proxy);
+
+        void refresh();
+
+    protected:
+        virtual bool paint() override;
+
+    private:
+        static constexpr int FONT_SIZE = 9;
+        static constexpr int PADDING = 5;
+        static constexpr int LINE_HEIGHT = 20;
+        static constexpr int CELLS_PER_ROW = 8;
+        static constexpr int CELL_WIDTH = 30;
+        static constexpr int CELL_HEIGHT = 22;
+        static constexpr int CELL_GAP = 3;
+        static constexpr int CELLS_LEFT = (
+            (WIDTH - CELLS_PER_ROW * CELL_WIDTH - (CELLS_PER_ROW - 1) * CELL_GAP) / 2
+        );
+        static constexpr int CELLS_TOP = LINE_HEIGHT;
+        static constexpr int COUNTERS_TOP = CELLS_TOP + 2 * (CELL_HEIGHT + CELL_GAP);
+        static constexpr size_t TEXT_MAX_LENGTH = 64;
+
+        static char const* const NOTE_NAMES[];
+
+        static bool is_equal(
+            Proxy::VoiceStats const& a,
+            Proxy::VoiceStats const& b
+        );
+
+        void draw_line(char const* const text, int const top);
+        void draw_channel(Midi::Channel const channel);
+
+        Proxy& proxy;
+        Proxy::VoiceStats voice_stats;
+};
+
+
+/**
+ * \brief Labels and frame for the keyboard split settings. The editors of the
+ *        parameters are separate widgets, placed at the positions which are
+ *        defined here.
+ */
+class SplitsPanel : public TransparentWidget
+{
+    public:
+        static constexpr int LEFT = 7;
+        static constexpr int TOP = 11;
+        static constexpr int WIDTH = 281;
+        static constexpr int HEIGHT = 120;
+
+        static constexpr int VALUE_HEIGHT = 18;
+
+        static constexpr int SEPARATE_CHANNELS_TOP = 1;
+        static constexpr int SEPARATE_CHANNELS_LEFT = 243;
+        static constexpr int SEPARATE_CHANNELS_WIDTH = 34;
+
+        static constexpr int SPLITS_TOP = 27;
+        static constexpr int LOWER_SPLIT_POINT_LEFT = 34;
+        static constexpr int TRANSPOSE_BELOW_LOWER_LEFT = 94;
+        static constexpr int UPPER_SPLIT_POINT_LEFT = 176;
+        static constexpr int TRANSPOSE_ABOVE_UPPER_LEFT = 236;
+        static constexpr int SPLIT_POINT_WIDTH = 40;
+        static constexpr int TRANSPOSE_WIDTH = 34;
+
+        static constexpr int SCOPES_TOP = 75;
+        static constexpr int SCOPES_PER_ROW = 5;
+        static constexpr int SCOPE_LABEL_WIDTH = 16;
+        static constexpr int SCOPE_WIDTH = 38;
+        static constexpr int SCOPE_COLUMN_WIDTH = 56;
+        static constexpr int SCOPE_ROW_HEIGHT = 23;
+
+        static constexpr int get_scope_left(size_t const rule)
+        {
+            return (int)(rule % SCOPES_PER_ROW) * SCOPE_COLUMN_WIDTH + SCOPE_LABEL_WIDTH;
+        }
+
+        static constexpr int get_scope_top(size_t const rule)
+        {
+            return SCOPES_TOP + (int)(rule / SCOPES_PER_ROW) * SCOPE_ROW_HEIGHT;
+        }
+
+        SplitsPanel();
+
+    protected:
+        virtual bool paint() override;
+
+    private:
+        static constexpr int FONT_SIZE = 9;
+        static constexpr int PADDING = 5;
+
+        void draw_label(
+            char const* const text,
+            int const left,
+            int const top,
+            int const width,
+            FontWeight const font_weight = FontWeight::NORMAL,
+            TextAlignment const alignment = TextAlignment::RIGHT
+        );
+};
+
+
+/**
+ * \brief Labels for the rate limit and deadband settings of the rules, in the
+ *        strip below the rules. The editors are separate widgets, placed at
+ *        the positions which are defined here.
+ */
+class RateLimitsPanel : public TransparentWidget
+{
+    public:
+        static constexpr int LEFT = 18;
+        static constexpr int TOP = 547;
+        static constexpr int WIDTH = 944;
+        static constexpr int HEIGHT = 18;
+
+        static constexpr int VALUE_HEIGHT = 18;
+
+        static constexpr int TITLE_WIDTH = 44;
+        static constexpr int CELL_WIDTH = 100;
+        static constexpr int RULE_LABEL_WIDTH = 18;
+        static constexpr int RATE_LIMIT_WIDTH = 44;
+        static constexpr int DEADBAND_GAP = 4;
+        static constexpr int DEADBAND_WIDTH = 30;
+
+        static constexpr int get_rate_limit_left(size_t const rule)
+        {
+            return TITLE_WIDTH + (int)rule * CELL_WIDTH + RULE_LABEL_WIDTH;
+        }
+
+        static constexpr int get_deadband_left(size_t const rule)
+        {
+            return get_rate_limit_left(rule) + RATE_LIMIT_WIDTH + DEADBAND_GAP;
+        }
+
+        RateLimitsPanel();
+
+    protected:
+        virtual bool paint() override;
+
+    private:
+        static constexpr int FONT_SIZE = 9;
+        static constexpr int PADDING = 5;
+};
+
+
 class ToggleSwitchParamEditor: public TransparentWidget
 {
     public:
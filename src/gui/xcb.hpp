@@ -261,6 +261,9 @@ class Widget : public WidgetBase
             | Type::STATUS_LINE
             | Type::TOGGLE_SWITCH
             | Type::DISCRETE_PARAM_EDITOR
+            | Type::CHANNEL_MAP
+            | Type::SPLITS_PANEL
+            | Type::RATE_LIMITS_PANEL
         );
 
         class Resource;
@@ -79,18 +79,13 @@ class Math
         static constexpr size_t DISTORTION_TABLE_MAX_INDEX = DISTORTION_TABLE_SIZE - 1;
         static constexpr double DISTORTION_SCALE = (double)DISTORTION_TABLE_MAX_INDEX;
 
-        static Math const math;
-
-        Math() noexcept;
-
-        void init_distortions() noexcept;
-
-        double dist_smooth_smooth(double const x) noexcept;
-        double dist_smooth_sharp(double const x) noexcept;
-        double dist_sharp_smooth(double const x) noexcept;
-        double dist_sharp_sharp(double const x) noexcept;
-
-        double distortions[DISTORTIONS][DISTORTION_TABLE_SIZE];
+        /*
+        The tables are generated by scripts/gen_distortion_tables.py into
+        src/math_tables.cpp so that they can live in read-only memory, and
+        loading the plugin doesn't have to compute thousands of transcendental
+        functions.
+        */
+        static double const distortions[DISTORTIONS][DISTORTION_TABLE_SIZE];
 };
 
 }
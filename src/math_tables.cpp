@@ -0,0 +1,2093 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+This file is generated by scripts/gen_distortion_tables.py, do not edit.
+*/
+
+#ifndef MPE_EMULATOR__MATH_TABLES_CPP
+#define MPE_EMULATOR__MATH_TABLES_CPP
+
+#include "math.hpp"
+
+
+namespace MpeEmulator
+{
+
+double const Math::distortions[Math::DISTORTIONS][Math::DISTORTION_TABLE_SIZE] = {
+    [Math::DistortionCurve::DIST_CURVE_SMOOTH_SMOOTH] = {
+        1.1253516207787584e-07, 1.1430820529012564e-07, 1.1610918371207646e-07, 1.179385372696018e-07,
+        1.1979671321604712e-07, 1.216841655216072e-07, 1.2360135553945995e-07, 1.2554875172821056e-07,
+        1.2752683009598087e-07, 1.295360739228535e-07, 1.3157697431598336e-07, 1.3365003009857546e-07,
+        1.357557477543736e-07, 1.3789464198277201e-07, 1.400672354767707e-07, 1.4227405914502e-07,
+        1.4451565233386532e-07, 1.4679256288285814e-07, 1.4910534718026724e-07, 1.5145457044063448e-07,
+        1.5384080676028589e-07, 1.5626463939488744e-07, 1.5872666053740048e-07, 1.6122747203972665e-07,
+        1.6376768491310756e-07, 1.6634791999425858e-07, 1.6896880788985769e-07, 1.7163098903205665e-07,
+        1.7433511406705904e-07, 1.7708184385512027e-07, 1.7987184963708103e-07, 1.8270581314538958e-07,
+        1.8558442710370215e-07, 1.8850839494932714e-07, 1.914784312218032e-07, 1.944952617849438e-07,
+        1.975596238823485e-07, 2.0067226635944735e-07, 2.03833949996568e-07, 2.0704544734240216e-07,
+        2.103075433246282e-07, 2.1362103513888897e-07, 2.1698673247083633e-07, 2.2040545794022037e-07,
+        2.2387804698986713e-07, 2.2740534821874547e-07, 2.3098822371503402e-07, 2.3462754900061e-07,
+        2.383242135306496e-07, 2.420791206936279e-07, 2.45893188144386e-07, 2.4976734797066413e-07,
+        2.537025469151466e-07, 2.5769974670852847e-07, 2.6175992418053795e-07, 2.658840715930033e-07,
+        2.7007319686189746e-07, 2.7432832366836024e-07, 2.786504919027877e-07, 2.8304075788687655e-07,
+        2.875001944846467e-07, 2.9202989154653025e-07, 2.966309560203939e-07, 3.01304512340117e-07,
+        3.060517027031473e-07, 3.1087368712601204e-07, 3.157716441104519e-07, 3.2074677064342083e-07,
+        3.2580028253015314e-07, 3.309334147827414e-07, 3.361474218976923e-07, 3.414435779669489e-07,
+        3.468231773995356e-07, 3.52287534866047e-07, 3.578379857427372e-07, 3.634758864445864e-07,
+        3.692026148138794e-07, 3.75019570397761e-07, 3.80928174725792e-07, 3.8692987175403815e-07,
+        3.930261281981373e-07, 3.992184339218774e-07, 4.055083022147521e-07, 4.1189727023605016e-07,
+        4.1838689929241113e-07, 4.249787753374257e-07, 4.316745093602137e-07, 4.3847573771849113e-07,
+        4.453841224161259e-07, 4.524013518247827e-07, 4.595291408504565e-07, 4.667692313220506e-07,
+        4.7412339271302173e-07, 4.815934221968909e-07, 4.891811453133776e-07, 4.968884164124887e-07,
+        5.047171189875854e-07, 5.126691662860061e-07, 5.207465015866219e-07, 5.28951098976993e-07,
+        5.372849634088794e-07, 5.457501315309088e-07, 5.543486721881763e-07, 5.630826866998007e-07,
+        5.719543094695467e-07, 5.809657085964481e-07, 5.901190863188965e-07, 5.994166795142419e-07,
+        6.088607604759488e-07, 6.184536370801297e-07, 6.281976536737233e-07, 6.380951916296063e-07,
+        6.481486695686378e-07, 6.583605445809049e-07, 6.687333121146999e-07, 6.792695071977661e-07,
+        6.899717047148535e-07, 7.00842520018341e-07, 7.118846098164155e-07, 7.231006725616496e-07,
+        7.344934493391797e-07, 7.46065724310796e-07, 7.578203254920979e-07, 7.697601256406728e-07,
+        7.818880424781405e-07, 7.94207040022421e-07, 8.067201286987569e-07, 8.194303665609581e-07,
+        8.323408597910031e-07, 8.454547634206833e-07, 8.587752823308037e-07, 8.723056718062949e-07,
+        8.860492384799024e-07, 9.000093409428089e-07, 9.141893909103693e-07, 9.285928537217103e-07,
+        9.432232492834203e-07, 9.58084153013239e-07, 9.731791967282355e-07, 9.88512069366454e-07,
+        1.0040865180416247e-06, 1.0199063488203208e-06, 1.0359754278321809e-06, 1.0522976821025765e-06,
+        1.0688771004407904e-06, 1.0857177346612623e-06, 1.102823700249722e-06, 1.1201991775844355e-06,
+        1.1378484130464273e-06, 1.1557757196856144e-06, 1.1739854786640969e-06, 1.1924821401443353e-06,
+        1.2112702243438633e-06, 1.230354322812044e-06, 1.2497390992627366e-06, 1.2694292911286098e-06,
+        1.2894297102272745e-06, 1.3097452443155966e-06, 1.33038085819992e-06, 1.3513415948462892e-06,
+        1.3726325767127179e-06, 1.3942590068594107e-06, 1.4162261705030765e-06, 1.4385394359051062e-06,
+        1.46120425614793e-06, 1.4842261700231951e-06, 1.5076108036971014e-06, 1.531363871987157e-06,
+        1.5554911796389348e-06, 1.5799986229914076e-06, 1.6048921911981928e-06, 1.6301779678373762e-06,
+        1.6558621322437794e-06, 1.6819509611742944e-06, 1.7084508302511736e-06, 1.735368215571853e-06,
+        1.7627096952632648e-06, 1.7904819510361492e-06, 1.8186917699614114e-06, 1.847346046024434e-06,
+        1.8764517817349002e-06, 1.9060160900141732e-06, 1.93604619586063e-06, 1.9665494380149973e-06,
+        1.9975332709587512e-06, 2.029005266523942e-06, 2.0609731158915956e-06, 2.09344463142358e-06,
+        2.126427748494475e-06, 2.159930527600995e-06, 2.1939611561383465e-06, 2.2285279506206734e-06,
+        2.2636393584574144e-06, 2.2993039601737486e-06, 2.335530471631042e-06, 2.3723277458032044e-06,
+        2.409704775219179e-06, 2.4476706941833903e-06, 2.4862347807741436e-06, 2.525406459341628e-06,
+        2.56519530261734e-06, 2.6056110342675964e-06, 2.6466635311139797e-06, 2.6883628255203185e-06,
+        2.7307191080572224e-06, 2.773742729722528e-06, 2.8174442046058346e-06, 2.861834212497527e-06,
+        2.9069236014422906e-06, 2.9527233904036443e-06, 2.9992447718729665e-06, 3.046499114756074e-06,
+        3.094497967093268e-06, 3.1432530587793828e-06, 3.1927763046168955e-06, 3.2430798070359756e-06,
+        3.2941758591475967e-06, 3.3460769479076724e-06, 3.3987957567260807e-06, 3.4523451690193774e-06,
+        3.5067382712083983e-06, 3.5619883557713727e-06, 3.6181089247411258e-06, 3.6751136927026806e-06,
+        3.7330165904569945e-06, 3.7918317682406055e-06, 3.851573599278346e-06, 3.912256683114013e-06,
+        3.973895849440634e-06, 4.036506161542164e-06, 4.100102919957216e-06, 4.164701666475867e-06,
+        4.230318187470328e-06, 4.29696851828032e-06, 4.364668946765793e-06, 4.433436017359238e-06,
+        4.503286535229023e-06, 4.574237570331707e-06, 4.6463064614088445e-06, 4.719510820538897e-06,
+        4.7938685371895495e-06, 4.869397782714113e-06, 4.946117014681395e-06, 5.024044981594145e-06,
+        5.103200727107904e-06, 5.183603595193542e-06, 5.265273234356105e-06, 5.3482296027418386e-06,
+        5.432492972912151e-06, 5.518083936895124e-06, 5.605023411070498e-06, 5.693332641332205e-06,
+        5.783033208361932e-06, 5.874147032736143e-06, 5.96669638053271e-06, 6.060703868548956e-06,
+        6.1561924698527726e-06, 6.2531855195002706e-06, 6.351706720142403e-06, 6.45178014802017e-06,
+        6.553430258404713e-06, 6.656681892147631e-06, 6.761560281176582e-06, 6.868091055212133e-06,
+        6.976300247540923e-06, 7.0862143017325074e-06, 7.19786007785661e-06, 7.311264859199973e-06,
+        7.426456358983202e-06, 7.5434627268555765e-06, 7.662312556111495e-06, 7.783034890407325e-06,
+        7.905659230977857e-06, 8.030215543852748e-06, 8.156734267295018e-06, 8.28524631885097e-06,
+        8.415783103288277e-06, 8.548376520256529e-06, 8.683058971725721e-06, 8.81986337025742e-06,
+        8.958823146998363e-06, 9.099972259674072e-06, 9.243345201026543e-06, 9.388977007251942e-06,
+        9.53690326638279e-06, 9.687160127225258e-06, 9.839784308129929e-06, 9.994813105818068e-06,
+        1.015228440465199e-05, 1.0312236685738885e-05, 1.0474709036478735e-05, 1.0639741160167748e-05,
+        1.0807373385379737e-05, 1.0977646676235686e-05, 1.115060264206269e-05, 1.132628354777454e-05,
+        1.1504732324141287e-05, 1.1685992578225335e-05, 1.1870108604039586e-05, 1.2057125393483137e-05,
+        1.224708864722146e-05, 1.2440044785899662e-05, 1.2636040961411243e-05, 1.2835125068610953e-05,
+        1.3037345756694574e-05, 1.3242752441355865e-05, 1.3451395316887993e-05, 1.366332536817394e-05,
+        1.3878594383343046e-05, 1.4097254966427553e-05, 1.4319360550074656e-05, 1.454496540875816e-05,
+        1.4774124672045641e-05, 1.5006894337865617e-05, 1.524333128632982e-05, 1.5483493293666495e-05,
+        1.5727439046264724e-05, 1.5975228155051813e-05, 1.6226921170037212e-05, 1.648257959496746e-05,
+        1.674226590264727e-05, 1.700604355003854e-05, 1.7273976993636975e-05, 1.7546131705403756e-05,
+        1.782257418869726e-05, 1.810337199453782e-05, 1.838859373809454e-05, 1.8678309115449654e-05,
+        1.8972588920473932e-05, 1.927150506247921e-05, 1.957513058342686e-05, 1.9883539675968898e-05,
+        2.0196807701489128e-05, 2.051501120847732e-05, 2.0838227951403e-05, 2.116653690953374e-05,
+        2.1500018306253033e-05, 2.1838753628711238e-05, 2.218282564769858e-05, 2.2532318437906707e-05,
+        2.288731739835681e-05, 2.3247909273382827e-05, 2.3614182173725684e-05, 2.398622559812713e-05,
+        2.4364130455145627e-05, 2.474798908530529e-05, 2.513789528379995e-05, 2.5533944323308244e-05,
+        2.593623297719727e-05, 2.6344859543281363e-05, 2.6759923867802904e-05, 2.7181527369746217e-05,
+        2.7609773065651044e-05, 2.8044765594814614e-05, 2.8486611244771254e-05, 2.8935417977327127e-05,
+        2.9391295454817e-05, 2.985435506702716e-05, 3.0324709958284846e-05, 3.080247505515832e-05,
+        3.128776709443448e-05, 3.1780704651707126e-05, 3.2281408170409254e-05, 3.278999999101195e-05,
+        3.3306604381055926e-05, 3.383134756540507e-05, 3.43643577572772e-05, 3.490576518916377e-05,
+        3.545570214508187e-05, 3.6014302992493086e-05, 3.65817042153882e-05, 3.715804444748283e-05,
+        3.774346450602373e-05, 3.833810742620569e-05, 3.894211849631013e-05, 3.955564529284361e-05,
+        4.017883771667563e-05, 4.08118480298425e-05, 4.145483089240676e-05, 4.2107943400482295e-05,
+        4.277134512437053e-05, 4.3445198147751274e-05, 4.412966710698463e-05, 4.482491923157861e-05,
+        4.553112438482332e-05, 4.624845510531328e-05, 4.697708664896938e-05, 4.771719703217103e-05,
+        4.8468967074721814e-05, 4.923258044431389e-05, 5.0008223701325516e-05, 5.0796086344284674e-05,
+        5.159636085610986e-05, 5.2409242751128016e-05, 5.323493062298068e-05, 5.407362619264111e-05,
+        5.492553435809677e-05, 5.579086324414284e-05, 5.666982425334144e-05, 5.756263211731394e-05,
+        5.846950494942105e-05, 5.9390664297886975e-05, 6.032633519997832e-05, 6.127674623662704e-05,
+        6.224212958866326e-05, 6.322272109299254e-05, 6.421876030054952e-05, 6.52304905344736e-05,
+        6.625815894961695e-05, 6.730201659282953e-05, 6.836231846424345e-05, 6.943932357938998e-05,
+        7.053329503248218e-05, 7.164450006058587e-05, 7.277321010878968e-05, 7.391970089654087e-05,
+        7.508425248475836e-05, 7.62671493441669e-05, 7.746868042485255e-05, 7.868913922659537e-05,
+        7.992882387047873e-05, 8.118803717166445e-05, 8.246708671327818e-05, 8.376628492134941e-05,
+        8.50859491410283e-05, 8.642640171402372e-05, 8.778797005720707e-05, 8.917098674243729e-05,
+        9.057578957777368e-05, 9.200272168963242e-05, 9.345213160666388e-05, 9.492437334468473e-05,
+        9.641980649305326e-05, 9.793879630209945e-05, 9.948171377255344e-05, 0.00010104893574569562,
+        0.00010264084499544968, 0.00010425783032153024, 0.0001059002866443115, 0.00010756861510108351,
+        0.00010926322314391834, 0.00011098452463881303, 0.00011273293996666434, 0.00011450889612585335,
+        0.00011631282683610689, 0.0001181451726443572, 0.00012000638103187855, 0.00012189690652375518,
+        0.00012381721079918195, 0.00012576776280426305, 0.00012774903886619837, 0.00012976152280935738,
+        0.00013180570607296271, 0.00013388208783121636, 0.00013599117511448044, 0.00013813348293317818,
+        0.00014030953440280491, 0.0001425198608718814, 0.00014476500205090614, 0.0001470455061440834,
+        0.00014936192998266096, 0.00015171483916071038, 0.00015410480817268368, 0.00015653242055341243,
+        0.0001589982690201608, 0.0001615029556169545, 0.0001640470918610748, 0.00016663129889205042,
+        0.00016925620762281435, 0.00017192245889319224, 0.00017463070362594424, 0.00017738160298536032,
+        0.00018017582853779857, 0.00018301406241538754, 0.00018589699748206012, 0.00018882533750180786,
+        0.00019179979731026586, 0.0001948211029885183, 0.00019788999203951274, 0.0002010072135678609,
+        0.000204173528461582, 0.00020738970957762115, 0.00021065654192942151, 0.00021397482287810465,
+        0.00021734536232614898, 0.00022076898291445435, 0.00022424652022223768, 0.0002277788229701483,
+        0.00023136675322676936, 0.0002350111866179505, 0.00023871301253969301, 0.00024247313437419926,
+        0.00024629246970953034, 0.0002501719505624833, 0.00025411252360507675, 0.00025811515039442234,
+        0.0002621808076063159, 0.00026631048727249196, 0.0002705051970217087, 0.00027476596032405265,
+        0.00027909381673973943, 0.0002834898221714677, 0.0002879550491206584, 0.0002924905869478578,
+        0.0002970975421371369, 0.000301777038564488, 0.00030653021777077294, 0.0003113582392385017,
+        0.0003162622806732185, 0.00032124353828899554, 0.0003263032270989785, 0.0003314425812095956,
+        0.000336662854119929, 0.00034196531902597194, 0.00034735126912871506, 0.00035282201794811785,
+        0.0003583788996411319, 0.0003640232693251644, 0.0003697565034063155, 0.0003755799999130005,
+        0.0003814951788344012, 0.00038750348246446853, 0.00039360637575130974, 0.00039980534665162715,
+        0.000406101906491263, 0.0004124975903307404, 0.0004189939573369106, 0.00042559259116031756,
+        0.00043229510031822516, 0.0004391031185837502, 0.00044601830538104625, 0.000453042346186705,
+        0.00046017695293709693, 0.00046742386444226236, 0.0004747848468062976, 0.00048226169385418016,
+        0.0004898562275649221, 0.0004975702985120511, 0.00050540578631042, 0.0005133646000701209,
+        0.0005214486788574502, 0.0005296599921630341, 0.0005380005403768928, 0.0005464723552716655,
+        0.0005550775004922182, 0.0005638180720538566, 0.0005726961988473667, 0.0005817140431526591,
+        0.0005908738011598524, 0.0006001777034984612, 0.0006096280157750211, 0.0006192270391185972,
+        0.0006289771107353959, 0.0006388806044710926, 0.0006489399313825417, 0.0006591575403178118,
+        0.0006695359185056038, 0.0006800775921535496, 0.0006907851270555598, 0.0007016611292087749,
+        0.000712708245440008, 0.0007239291640417922, 0.000735326615418086, 0.0007469033727401375,
+        0.0007586622526122855, 0.0007706061157480848, 0.0007827378676568131, 0.0007950604593403576,
+        0.0008075768880010936, 0.0008202901977604204, 0.0008332034803884003, 0.0008463198760446655,
+        0.0008596425740304281, 0.0008731748135521467, 0.0008869198844972948, 0.0009008811282212315,
+        0.0009150619383466174, 0.0009294657615752655, 0.0009440960985115932, 0.0009589565044997306,
+        0.0009740505904722863, 0.0009893820238131568, 0.00100495452923266, 0.001020771889656491,
+        0.0010368379471279998, 0.0010531566037244033, 0.001069731822486708, 0.0010865676283640102,
+        0.0011036681091720624, 0.001121037416566384, 0.0011386797670302484, 0.0011565994428775483,
+        0.0011748007932708693, 0.0011932882352553853, 0.001212066254807742, 0.001231139407901316,
+        0.0012505123215877378, 0.0012701896950940705, 0.0012901763009374179, 0.001310476986055631,
+        0.0013310966729557783, 0.0013520403608792142, 0.0013733131269849097, 0.0013949201275500478,
+        0.0014168665991889928, 0.001439157860090523, 0.0014617993112737149, 0.0014847964378625345,
+        0.0015081548103795805, 0.0015318800860594228, 0.0015559780101815357, 0.0015804544174229385,
+        0.0016053152332312637, 0.0016305664752185312, 0.00165621425457535, 0.001682264777506548,
+        0.0017087243466877289, 0.0017355993627442556, 0.0017628963257514951, 0.0017906218367577664,
+        0.0018187825993298268, 0.0018473854211212282, 0.001876437215463822, 0.0019059450029831893,
+        0.0019359159132373294, 0.0019663571863803297, 0.001997276174849738, 0.002028680345079581,
+        0.002060577279237974, 0.002092974676990822, 0.0021258803572908325, 0.0021593022601933964,
+        0.0021932484486984483, 0.002227727110619915, 0.0022627465604819763, 0.002298315241443083,
+        0.0023344417272484486, 0.0023711347242103, 0.0024084030732174355, 0.0024462557517738737,
+        0.0024847018760666972, 0.0025237507030642647, 0.0025634116326445633, 0.0026036942097543703,
+        0.0026446081265992794, 0.0026861632248656453, 0.0027283694979740036, 0.0027712370933654085,
+        0.0028147763148196336, 0.002858997624807569, 0.0029039116468763115, 0.002949529168068732,
+        0.0029958611413773983, 0.003042918688232976, 0.003090713101028597, 0.0031392558456791453,
+        0.0031885585642173475, 0.00323863307742589, 0.0032894913875071707, 0.0033411456807899143,
+        0.0033936083304740294, 0.0034468918994139397, 0.00350100914294027, 0.003555973011721447,
+        0.0036117966546645452, 0.0036684934218565446, 0.003726076867546113, 0.003784560753166799,
+        0.0038439590504013577, 0.0039042859442887656, 0.00396555583637298, 0.004027783347895608,
+        0.004090983323031261, 0.004155170832167321, 0.004220361175227949, 0.004286569885043223,
+        0.004353812730763407, 0.004422105721319125, 0.004491465108928172, 0.0045619073926486675,
+        0.004633449321980065, 0.004706107900511458, 0.004779900389618397, 0.004854844312208506,
+        0.004930957456516227, 0.005008257879947076, 0.005086763912972414, 0.005166494163074797,
+        0.005247467518744053, 0.005329703153525545, 0.00541322053012, 0.005498039404536081,
+        0.005584179830295799, 0.005671662162693603, 0.005760507063109044, 0.005850735503373783,
+        0.005942368770193829, 0.006035428469626347, 0.006129936531612423, 0.006225915214566002,
+        0.006323387110019063, 0.0064223751473237445, 0.006522902598411984, 0.006624993082612551,
+        0.006728670571526263, 0.00683395939395981, 0.00694088424091821, 0.007049470170656547,
+        0.007159742613791209, 0.007271727378470982, 0.0073854506556084165, 0.007500939024171649,
+        0.0076182194565368455, 0.007737319323902203, 0.00785826640176257, 0.00798108887544663,
+        0.00810581534571475, 0.008232474834420023, 0.008361096790230838, 0.008491711094416099,
+        0.008624348066692988, 0.008759038471137681, 0.008895813522158402, 0.009034704890532264,
+        0.009175744709504108, 0.009318965580949079, 0.009464400581598309, 0.009612083269327165,
+        0.009762047689507003, 0.009914328381419646, 0.01006896038473487, 0.010225979246050454,
+        0.010385421025495056, 0.01054732230339328, 0.010711720186992846, 0.010878652317254045,
+        0.011048156875700155, 0.011220272591329516, 0.011395038747588349, 0.011572495189403953,
+        0.011752682330277875, 0.011935641159438237, 0.012121413249051305, 0.012310040761490781,
+        0.01250156645666517, 0.012696033699401366, 0.012893486466884707, 0.013093969356153867,
+        0.013297527591650371, 0.01350420703282107, 0.013714054181773017, 0.01392711619097986,
+        0.014143440871037583, 0.014363076698469701, 0.01458607282357971, 0.014812479078349483,
+        0.01504234598438281, 0.015275724760891563, 0.015512667332723773, 0.015753226338431348,
+        0.015997455138376082, 0.016245407822871427, 0.01649713922035878, 0.01675270490561631,
+        0.017012161207996646, 0.017275565219693645, 0.017542974804033606, 0.017814448603789834,
+        0.018090046049517305, 0.018369827367905323, 0.018653853590144376, 0.01894218656030594,
+        0.019234888943729878, 0.01953202423541872, 0.01983365676843346, 0.020139851722288993,
+        0.020450675131344243, 0.020766193893184903, 0.021086475776992963, 0.021411589431900968,
+        0.02174160439532541, 0.022076591101275855, 0.022416620888634775, 0.02276176600940405,
+        0.02311209963691241, 0.02346769587398001, 0.023828629761034392, 0.02419497728417236,
+        0.024566815383162632, 0.024944221959383728, 0.025327275883690714, 0.02571605700420515,
+        0.02611064615402192, 0.026511125158826643, 0.02691757684441648, 0.02733008504411827,
+        0.027748734606095893, 0.0281736114005412, 0.028604802326738565, 0.029042395319998138,
+        0.029486479358447393, 0.02993714446967438, 0.030394481737213264, 0.030858583306864307,
+        0.03132954239283836, 0.03180745328371798, 0.032292411348224026, 0.03278451304078045,
+        0.03328385590686411, 0.033790538588133245, 0.034304660827320144, 0.03482632347288078,
+        0.0353556284833878, 0.03589267893165732, 0.0364375790085964, 0.03699043402676122,
+        0.03755135042361146, 0.03812043576445101, 0.03869779874503998, 0.03928354919386662,
+        0.03987779807406472, 0.04048065748496388, 0.041092240663257784, 0.04171266198377699,
+        0.04234203695985095, 0.04298048224324591, 0.043628115623661035, 0.04428505602777083,
+        0.04495142351779413, 0.04562733928957757, 0.04631292567017381, 0.04700830611490092,
+        0.04771360520386275, 0.04842894863791691, 0.0491544632340688, 0.04989027692027781,
+        0.0506365187296538, 0.05139331879402931, 0.05216080833688541, 0.052939119665615375,
+        0.053728386163103825, 0.05452874227860571, 0.0553403235179013, 0.05616326643271119,
+        0.05699770860934805, 0.05784378865658729, 0.058701646192733714, 0.0595714218318657,
+        0.06045325716923372, 0.06134729476579459, 0.06225367813185695, 0.06317255170982033,
+        0.06410406085598225, 0.06504835182139546, 0.06600557173175009, 0.06697586856626186,
+        0.06795939113554172, 0.06895628905842766, 0.06996671273775357, 0.07099081333503676,
+        0.0720287427440583, 0.07308065356331822, 0.07414669906733995, 0.07522703317680568,
+        0.07632181042749797, 0.07743118593802906, 0.07855531537633387, 0.07969435492490845,
+        0.0808484612447703, 0.08201779143812293, 0.08320250300970183, 0.08440275382678453,
+        0.08561870207784317, 0.08685050622982321, 0.08809832498402659, 0.08936231723058535,
+        0.09064264200150435, 0.09193945842226048, 0.09325292566193805, 0.09458320288188976,
+        0.09593044918290383, 0.09729482355086833, 0.09867648480091529, 0.1000755915200372,
+        0.10149230200816056, 0.10292677421767055, 0.10437916569137434, 0.10584963349889931,
+        0.10733833417151484, 0.10884542363537825, 0.11037105714319467, 0.11191538920429478,
+        0.11347857351312307, 0.11506076287614325, 0.11666210913715658, 0.11828276310104308,
+        0.11992287445592481, 0.1215825916937644, 0.12326206202940171, 0.12496143131804588,
+        0.1266808439712283, 0.12842044287123966, 0.1301803692840593, 0.13196076277080387,
+        0.13376176109771004, 0.13558350014468024, 0.13742611381241215, 0.1392897339281458,
+        0.14117449015005262, 0.14308050987030713, 0.14500791811686892, 0.14695683745402133,
+        0.1489273878817005, 0.15091968673366607, 0.15293384857455217, 0.15496998509585624,
+        0.15702820501090942, 0.15910861394889292, 0.16121131434794927, 0.16333640534745647,
+        0.1654839826795242, 0.16765413855978412, 0.16984696157753676, 0.17206253658533743,
+        0.17430094458808798, 0.17656226263172092, 0.17884656369155238, 0.1811539165603942,
+        0.18348438573650738, 0.1858380313114954, 0.1882149088582229, 0.19061506931886613,
+        0.19303855889318616, 0.195485418927136, 0.1979556858018987, 0.20044939082347435,
+        0.20296656011291703, 0.20550721449734516, 0.2080713694018314, 0.21065903474230158,
+        0.21327021481955155, 0.2159049082145179, 0.21856310768491438, 0.22124480006337488,
+        0.22394996615721863, 0.22667858064998025, 0.2294306120048274, 0.23220602237000726,
+        0.2350047674864495, 0.23782679659767042, 0.2406720523621046, 0.24354047076801277,
+        0.24643198105109299, 0.24934650561494437, 0.25228395995451036, 0.2552442525826515,
+        0.25822728495997394, 0.26123295142806235, 0.2642611391462423, 0.2673117280320191,
+        0.27038459070531484, 0.2734795924366492, 0.27659659109938073, 0.27973543712615073,
+        0.28289597346964357, 0.2860780355677972, 0.2892814513135756, 0.2925060410294286,
+        0.2957516174465449, 0.2990179856890168, 0.3023049432630137, 0.30561228005107666,
+        0.3089397783116191, 0.3122872126837399, 0.31565435019742166, 0.31904095028921114,
+        0.3224467648234435, 0.32587153811909503, 0.32931500698231575, 0.3327769007447129,
+        0.33625694130742345, 0.33975484319103477, 0.34327031359137694, 0.34680305244123066,
+        0.3503527524779623, 0.3539190993171126, 0.35750177153193574, 0.36110044073890196,
+        0.364714771689141, 0.3683444223658259, 0.3719890440874577, 0.37564828161703334,
+        0.3793217732770411, 0.38300915107024847, 0.3867100408062113, 0.3904240622334497,
+        0.394150829177205, 0.3978899496827045, 0.4016410261638319, 0.40540365555711405,
+        0.4091774294809033, 0.4129619343996516, 0.41675675179313776, 0.42056145833052827,
+        0.42437562604911766, 0.42819882253761293, 0.43203061112379254, 0.43587055106639017,
+        0.4397181977510192, 0.4435731028899745, 0.4474348147257131, 0.451302878237839,
+        0.4551768353533804, 0.45905622516017247, 0.4629405841231248, 0.46682944630317397,
+        0.470722343578692, 0.4746188058691423, 0.4785183613607445, 0.48242053673393376,
+        0.4863248573923678, 0.49023084769326225, 0.49413803117880256, 0.49804593080840776,
+        0.5019540691915922, 0.505861968821197, 0.5097691523067381, 0.5136751426076323,
+        0.5175794632660662, 0.521481638639255, 0.5253811941308582, 0.529277656421308,
+        0.533170553696826, 0.5370594158768748, 0.5409437748398279, 0.5448231646466196,
+        0.548697121762161, 0.5525651852742864, 0.5564268971100259, 0.5602818022489808,
+        0.5641294489336098, 0.5679693888762071, 0.5718011774623875, 0.5756243739508824,
+        0.5794385416694717, 0.5832432482068618, 0.5870380656003488, 0.5908225705190967,
+        0.594596344442886, 0.5983589738361677, 0.6021100503172959, 0.605849170822795,
+        0.6095759377665503, 0.6132899591937883, 0.616990848929752, 0.6206782267229589,
+        0.6243517183829667, 0.6280109559125419, 0.6316555776341746, 0.635285228310859,
+        0.638899559261098, 0.6424982284680638, 0.6460809006828878, 0.6496472475220376,
+        0.6531969475587693, 0.6567296864086227, 0.6602451568089656, 0.6637430586925765,
+        0.6672230992552871, 0.6706849930176839, 0.6741284618809054, 0.6775532351765565,
+        0.6809590497107889, 0.684345649802578, 0.6877127873162605, 0.6910602216883809,
+        0.6943877199489233, 0.6976950567369858, 0.7009820143109835, 0.7042483825534551,
+        0.7074939589705713, 0.7107185486864241, 0.7139219644322032, 0.7171040265303564,
+        0.7202645628738493, 0.7234034089006189, 0.7265204075633511, 0.7296154092946852,
+        0.7326882719679809, 0.7357388608537574, 0.7387670485719381, 0.7417727150400261,
+        0.7447557474173485, 0.7477160400454893, 0.750653494385056, 0.753568018948907,
+        0.7564595292319872, 0.759327947637895, 0.7621732034023299, 0.7649952325135505,
+        0.7677939776299927, 0.7705693879951723, 0.77332141935002, 0.7760500338427814,
+        0.7787551999366251, 0.7814368923150853, 0.7840950917854824, 0.7867297851804484,
+        0.7893409652576984, 0.7919286305981683, 0.7944927855026552, 0.797033439887083,
+        0.7995506091765257, 0.8020443141981011, 0.8045145810728643, 0.8069614411068138,
+        0.8093849306811338, 0.8117850911417769, 0.8141619686885049, 0.8165156142634926,
+        0.8188460834396059, 0.8211534363084474, 0.8234377373682793, 0.825699055411912,
+        0.8279374634146626, 0.830153038422463, 0.8323458614402162, 0.8345160173204758,
+        0.8366635946525436, 0.8387886856520506, 0.8408913860511072, 0.8429717949890906,
+        0.8450300149041438, 0.8470661514254476, 0.849080313266334, 0.8510726121182994,
+        0.8530431625459787, 0.8549920818831308, 0.856919490129693, 0.8588255098499473,
+        0.8607102660718542, 0.8625738861875877, 0.8644164998553199, 0.86623823890229,
+        0.8680392372291961, 0.8698196307159405, 0.8715795571287605, 0.8733191560287716,
+        0.8750385686819542, 0.8767379379705981, 0.8784174083062358, 0.8800771255440751,
+        0.881717236898957, 0.8833378908628432, 0.8849392371238569, 0.8865214264868769,
+        0.8880846107957052, 0.8896289428568052, 0.8911545763646219, 0.8926616658284852,
+        0.8941503665011007, 0.8956208343086255, 0.8970732257823296, 0.8985076979918394,
+        0.8999244084799628, 0.9013235151990846, 0.9027051764491318, 0.9040695508170962,
+        0.9054167971181102, 0.9067470743380619, 0.9080605415777396, 0.9093573579984957,
+        0.9106376827694147, 0.9119016750159733, 0.913149493770177, 0.9143812979221568,
+        0.9155972461732155, 0.9167974969902981, 0.9179822085618772, 0.9191515387552297,
+        0.9203056450750915, 0.921444684623666, 0.9225688140619711, 0.923678189572502,
+        0.9247729668231943, 0.9258533009326599, 0.9269193464366818, 0.9279712572559418,
+        0.9290091866649632, 0.9300332872622463, 0.9310437109415725, 0.9320406088644583,
+        0.9330241314337382, 0.9339944282682497, 0.9349516481786047, 0.9358959391440178,
+        0.9368274482901797, 0.937746321868143, 0.9386527052342055, 0.9395467428307662,
+        0.9404285781681343, 0.9412983538072661, 0.9421562113434128, 0.943002291390652,
+        0.9438367335672888, 0.9446596764820987, 0.9454712577213944, 0.9462716138368962,
+        0.9470608803343846, 0.9478391916631145, 0.9486066812059708, 0.9493634812703462,
+        0.9501097230797222, 0.9508455367659311, 0.9515710513620832, 0.9522863947961373,
+        0.9529916938850991, 0.953687074329826, 0.9543726607104226, 0.9550485764822059,
+        0.9557149439722292, 0.9563718843763389, 0.9570195177567542, 0.957657963040149,
+        0.958287338016223, 0.9589077593367421, 0.9595193425150361, 0.9601222019259352,
+        0.9607164508061334, 0.9613022012549599, 0.9618795642355491, 0.9624486495763885,
+        0.9630095659732387, 0.9635624209914035, 0.9641073210683427, 0.9646443715166122,
+        0.9651736765271193, 0.9656953391726798, 0.9662094614118668, 0.9667161440931359,
+        0.9672154869592196, 0.9677075886517759, 0.9681925467162821, 0.9686704576071616,
+        0.9691414166931357, 0.9696055182627867, 0.9700628555303257, 0.9705135206415526,
+        0.9709576046800019, 0.9713951976732613, 0.9718263885994589, 0.9722512653939042,
+        0.9726699149558817, 0.9730824231555835, 0.9734888748411734, 0.9738893538459781,
+        0.9742839429957948, 0.9746727241163092, 0.9750557780406163, 0.9754331846168374,
+        0.9758050227158277, 0.9761713702389656, 0.9765323041260201, 0.9768879003630876,
+        0.977238233990596, 0.9775833791113652, 0.9779234088987242, 0.9782583956046746,
+        0.9785884105680991, 0.9789135242230069, 0.9792338061068151, 0.9795493248686558,
+        0.979860148277711, 0.9801663432315666, 0.9804679757645813, 0.9807651110562701,
+        0.9810578134396941, 0.9813461464098556, 0.9816301726320947, 0.9819099539504828,
+        0.9821855513962101, 0.9824570251959663, 0.9827244347803064, 0.9829878387920034,
+        0.9832472950943837, 0.9835028607796412, 0.9837545921771287, 0.9840025448616239,
+        0.9842467736615687, 0.9844873326672763, 0.9847242752391085, 0.9849576540156172,
+        0.9851875209216505, 0.9854139271764203, 0.9856369233015303, 0.9858565591289624,
+        0.9860728838090201, 0.9862859458182269, 0.9864957929671789, 0.9867024724083496,
+        0.9869060306438462, 0.9871065135331153, 0.9873039663005987, 0.9874984335433348,
+        0.9876899592385092, 0.9878785867509488, 0.9880643588405618, 0.9882473176697222,
+        0.988427504810596, 0.9886049612524117, 0.9887797274086705, 0.9889518431242998,
+        0.989121347682746, 0.9892882798130072, 0.9894526776966068, 0.989614578974505,
+        0.9897740207539496, 0.9899310396152652, 0.9900856716185804, 0.9902379523104929,
+        0.9903879167306728, 0.9905355994184016, 0.9906810344190509, 0.9908242552904959,
+        0.9909652951094677, 0.9911041864778416, 0.9912409615288624, 0.991375651933307,
+        0.991508288905584, 0.9916389032097691, 0.99176752516558, 0.9918941846542852,
+        0.9920189111245534, 0.9921417335982374, 0.9922626806760979, 0.9923817805434632,
+        0.9924990609758284, 0.9926145493443916, 0.992728272621529, 0.9928402573862087,
+        0.9929505298293435, 0.9930591157590818, 0.9931660406060402, 0.9932713294284737,
+        0.9933750069173874, 0.993477097401588, 0.9935776248526762, 0.993676612889981,
+        0.9937740847854339, 0.9938700634683876, 0.9939645715303737, 0.9940576312298062,
+        0.9941492644966262, 0.994239492936891, 0.9943283378373065, 0.9944158201697042,
+        0.9945019605954639, 0.99458677946988, 0.9946702968464745, 0.994752532481256,
+        0.9948335058369252, 0.9949132360870276, 0.9949917421200529, 0.9950690425434838,
+        0.9951451556877915, 0.9952200996103816, 0.9952938920994885, 0.9953665506780199,
+        0.9954380926073514, 0.9955085348910718, 0.9955778942786808, 0.9956461872692366,
+        0.9957134301149568, 0.995779638824772, 0.9958448291678327, 0.9959090166769687,
+        0.9959722166521043, 0.9960344441636271, 0.9960957140557112, 0.9961560409495986,
+        0.9962154392468332, 0.9962739231324538, 0.9963315065781435, 0.9963882033453355,
+        0.9964440269882786, 0.9964989908570597, 0.9965531081005861, 0.996606391669526,
+        0.9966588543192101, 0.9967105086124928, 0.9967613669225741, 0.9968114414357827,
+        0.9968607441543209, 0.9969092868989714, 0.996957081311767, 0.9970041388586226,
+        0.9970504708319312, 0.9970960883531237, 0.9971410023751924, 0.9971852236851804,
+        0.9972287629066345, 0.9972716305020259, 0.9973138367751344, 0.9973553918734007,
+        0.9973963057902456, 0.9974365883673555, 0.9974762492969358, 0.9975152981239332,
+        0.9975537442482261, 0.9975915969267826, 0.9976288652757896, 0.9976655582727516,
+        0.9977016847585569, 0.997737253439518, 0.9977722728893801, 0.9978067515513016,
+        0.9978406977398067, 0.9978741196427092, 0.9979070253230091, 0.9979394227207621,
+        0.9979713196549205, 0.9980027238251503, 0.9980336428136196, 0.9980640840867627,
+        0.9980940549970168, 0.9981235627845362, 0.9981526145788788, 0.9981812174006701,
+        0.9982093781632422, 0.9982371036742486, 0.9982644006372557, 0.9982912756533122,
+        0.9983177352224935, 0.9983437857454246, 0.9983694335247815, 0.9983946847667687,
+        0.9984195455825771, 0.9984440219898185, 0.9984681199139406, 0.9984918451896204,
+        0.9985152035621374, 0.9985382006887262, 0.9985608421399095, 0.9985831334008111,
+        0.99860507987245, 0.9986266868730151, 0.9986479596391208, 0.9986689033270442,
+        0.9986895230139443, 0.9987098236990626, 0.9987298103049059, 0.9987494876784122,
+        0.9987688605920987, 0.9987879337451923, 0.9988067117647446, 0.9988251992067292,
+        0.9988434005571225, 0.9988613202329697, 0.9988789625834336, 0.9988963318908279,
+        0.998913432371636, 0.9989302681775133, 0.9989468433962756, 0.9989631620528721,
+        0.9989792281103436, 0.9989950454707673, 0.9990106179761868, 0.9990259494095277,
+        0.9990410434955003, 0.9990559039014884, 0.9990705342384247, 0.9990849380616533,
+        0.9990991188717788, 0.9991130801155027, 0.9991268251864478, 0.9991403574259696,
+        0.9991536801239553, 0.9991667965196116, 0.9991797098022396, 0.9991924231119989,
+        0.9992049395406597, 0.9992172621323432, 0.9992293938842519, 0.9992413377473877,
+        0.9992530966272599, 0.9992646733845819, 0.9992760708359583, 0.99928729175456,
+        0.9992983388707912, 0.9993092148729444, 0.9993199224078464, 0.9993304640814944,
+        0.9993408424596821, 0.9993510600686175, 0.999361119395529, 0.9993710228892646,
+        0.9993807729608815, 0.999390371984225, 0.9993998222965015, 0.9994091261988401,
+        0.9994182859568473, 0.9994273038011526, 0.9994361819279461, 0.9994449224995078,
+        0.9994535276447283, 0.9994619994596231, 0.999470340007837, 0.9994785513211426,
+        0.9994866353999299, 0.9994945942136896, 0.999502429701488, 0.9995101437724351,
+        0.9995177383061458, 0.9995252151531937, 0.9995325761355578, 0.9995398230470629,
+        0.9995469576538133, 0.999553981694619, 0.9995608968814162, 0.9995677048996818,
+        0.9995744074088397, 0.9995810060426631, 0.9995875024096693, 0.9995938980935087,
+        0.9996001946533484, 0.9996063936242487, 0.9996124965175355, 0.9996185048211657,
+        0.999624420000087, 0.9996302434965937, 0.9996359767306748, 0.9996416211003589,
+        0.9996471779820519, 0.9996526487308712, 0.999658034680974, 0.9996633371458801,
+        0.9996685574187905, 0.999673696772901, 0.999678756461711, 0.9996837377193268,
+        0.9996886417607616, 0.9996934697822293, 0.9996982229614355, 0.9997029024578629,
+        0.9997075094130521, 0.9997120449508794, 0.9997165101778285, 0.9997209061832603,
+        0.999725234039676, 0.9997294948029782, 0.9997336895127276, 0.9997378191923937,
+        0.9997418848496056, 0.9997458874763949, 0.9997498280494375, 0.9997537075302905,
+        0.9997575268656258, 0.9997612869874604, 0.999764988813382, 0.9997686332467732,
+        0.9997722211770299, 0.9997757534797778, 0.9997792310170855, 0.9997826546376738,
+        0.9997860251771219, 0.9997893434580706, 0.9997926102904224, 0.9997958264715384,
+        0.9997989927864321, 0.9998021100079605, 0.9998051788970115, 0.9998082002026898,
+        0.9998111746624982, 0.9998141030025179, 0.9998169859375846, 0.9998198241714622,
+        0.9998226183970147, 0.9998253692963741, 0.9998280775411068, 0.9998307437923772,
+        0.999833368701108, 0.9998359529081389, 0.999838497044383, 0.9998410017309798,
+        0.9998434675794465, 0.9998458951918273, 0.9998482851608392, 0.9998506380700174,
+        0.9998529544938559, 0.999855234997949, 0.9998574801391281, 0.9998596904655972,
+        0.9998618665170669, 0.9998640088248856, 0.9998661179121688, 0.999868194293927,
+        0.9998702384771907, 0.9998722509611337, 0.9998742322371957, 0.9998761827892009,
+        0.9998781030934762, 0.9998799936189682, 0.9998818548273556, 0.9998836871731639,
+        0.9998854911038741, 0.9998872670600334, 0.9998890154753612, 0.9998907367768561,
+        0.9998924313848989, 0.9998940997133556, 0.9998957421696785, 0.9998973591550046,
+        0.9998989510642543, 0.9999005182862275, 0.999902061203698, 0.999903580193507,
+        0.9999050756266553, 0.9999065478683933, 0.9999079972783104, 0.9999094242104223,
+        0.9999108290132576, 0.9999122120299428, 0.999913573598286, 0.999914914050859,
+        0.9999162337150787, 0.9999175329132868, 0.9999188119628284, 0.9999200711761296,
+        0.9999213108607734, 0.9999225313195752, 0.9999237328506558, 0.9999249157475152,
+        0.9999260802991035, 0.9999272267898912, 0.9999283554999394, 0.9999294667049675,
+        0.9999305606764206, 0.9999316376815357, 0.9999326979834071, 0.9999337418410503,
+        0.9999347695094656, 0.9999357812396994, 0.999936777278907, 0.9999377578704114,
+        0.9999387232537633, 0.9999396736648001, 0.9999406093357022, 0.9999415304950505,
+        0.9999424373678827, 0.9999433301757467, 0.9999442091367559, 0.999945074465642,
+        0.9999459263738073, 0.999946765069377, 0.9999475907572488, 0.999948403639144,
+        0.9999492039136557, 0.9999499917762986, 0.9999507674195557, 0.9999515310329252,
+        0.9999522828029679, 0.9999530229133511, 0.9999537515448946, 0.9999544688756152,
+        0.9999551750807685, 0.999955870332893, 0.9999565548018523, 0.9999572286548757,
+        0.9999578920565995, 0.9999585451691075, 0.9999591881519702, 0.9999598211622833,
+        0.9999604443547072, 0.9999610578815037, 0.9999616618925737, 0.999962256535494,
+        0.9999628419555525, 0.9999634182957846, 0.9999639856970075, 0.9999645442978549,
+        0.9999650942348108, 0.9999656356422427, 0.9999661686524346, 0.9999666933956189,
+        0.999967210000009, 0.9999677185918296, 0.9999682192953483, 0.9999687122329055,
+        0.9999691975249448, 0.9999696752900418, 0.999970145644933, 0.9999706087045452,
+        0.9999710645820227, 0.9999715133887552, 0.9999719552344052, 0.9999723902269344,
+        0.9999728184726302, 0.9999732400761322, 0.9999736551404568, 0.9999740637670228,
+        0.9999744660556766, 0.9999748621047162, 0.9999752520109146, 0.9999756358695449,
+        0.9999760137744018, 0.9999763858178263, 0.9999767520907266, 0.9999771126826016,
+        0.999977467681562, 0.9999778171743523, 0.9999781612463713, 0.9999784999816937,
+        0.9999788334630905, 0.9999791617720486, 0.9999794849887915, 0.9999798031922985,
+        0.999980116460324, 0.9999804248694166, 0.9999807284949376, 0.9999810274110795,
+        0.9999813216908846, 0.9999816114062618, 0.9999818966280054, 0.9999821774258113,
+        0.9999824538682947, 0.9999827260230063, 0.99998299395645, 0.9999832577340974,
+        0.999983517420405, 0.9999837730788299, 0.999984024771845, 0.9999842725609538,
+        0.9999845165067063, 0.9999847566687137, 0.9999849931056621, 0.9999852258753279,
+        0.9999854550345912, 0.9999856806394499, 0.9999859027450335, 0.9999861214056167,
+        0.9999863366746318, 0.9999865486046831, 0.9999867572475587, 0.9999869626542432,
+        0.9999871648749314, 0.9999873639590386, 0.9999875599552142, 0.9999877529113528,
+        0.9999879428746066, 0.999988129891396, 0.9999883140074217, 0.9999884952676759,
+        0.9999886737164523, 0.9999888493973579, 0.9999890223533238, 0.9999891926266147,
+        0.9999893602588399, 0.9999895252909635, 0.9999896877633143, 0.9999898477155953,
+        0.9999900051868942, 0.9999901602156919, 0.9999903128398728, 0.9999904630967336,
+        0.9999906110229928, 0.999990756654799, 0.9999909000277403, 0.999991041176853,
+        0.9999911801366297, 0.9999913169410283, 0.9999914516234798, 0.9999915842168967,
+        0.9999917147536812, 0.9999918432657326, 0.9999919697844561, 0.999992094340769,
+        0.9999922169651096, 0.9999923376874439, 0.9999924565372731, 0.999992573543641,
+        0.9999926887351408, 0.9999928021399221, 0.9999929137856982, 0.9999930236997525,
+        0.9999931319089448, 0.9999932384397188, 0.9999933433181079, 0.9999934465697415,
+        0.999993548219852, 0.9999936482932799, 0.9999937468144805, 0.9999938438075302,
+        0.9999939392961315, 0.9999940333036195, 0.9999941258529672, 0.9999942169667917,
+        0.9999943066673587, 0.9999943949765889, 0.9999944819160631, 0.9999945675070271,
+        0.9999946517703973, 0.9999947347267657, 0.9999948163964048, 0.9999948967992729,
+        0.9999949759550184, 0.9999950538829854, 0.9999951306022172, 0.9999952061314628,
+        0.9999952804891794, 0.9999953536935386, 0.9999954257624297, 0.9999954967134648,
+        0.9999955665639826, 0.9999956353310533, 0.9999957030314817, 0.9999957696818125,
+        0.9999958352983336, 0.99999589989708, 0.9999959634938385, 0.9999960261041505,
+        0.9999960877433169, 0.9999961484264007, 0.9999962081682318, 0.9999962669834095,
+        0.9999963248863073, 0.9999963818910753, 0.9999964380116442, 0.9999964932617288,
+        0.9999965476548309, 0.9999966012042433, 0.999996653923052, 0.9999967058241408,
+        0.999996756920193, 0.9999968072236953, 0.9999968567469413, 0.9999969055020329,
+        0.9999969535008852, 0.9999970007552281, 0.9999970472766095, 0.9999970930763986,
+        0.9999971381657875, 0.9999971825557954, 0.9999972262572703, 0.9999972692808919,
+        0.9999973116371745, 0.9999973533364689, 0.9999973943889657, 0.9999974348046974,
+        0.9999974745935407, 0.9999975137652193, 0.9999975523293059, 0.9999975902952247,
+        0.9999976276722542, 0.9999976644695283, 0.9999977006960399, 0.9999977363606416,
+        0.9999977714720494, 0.9999978060388439, 0.9999978400694725, 0.9999978735722515,
+        0.9999979065553686, 0.999997939026884, 0.9999979709947335, 0.999998002466729,
+        0.999998033450562, 0.9999980639538042, 0.9999980939839099, 0.9999981235482183,
+        0.999998152653954, 0.99999818130823, 0.999998209518049, 0.9999982372903047,
+        0.9999982646317844, 0.9999982915491697, 0.9999983180490388, 0.9999983441378677,
+        0.9999983698220322, 0.9999983951078089, 0.999998420001377, 0.9999984445088204,
+        0.9999984686361281, 0.9999984923891962, 0.99999851577383, 0.9999985387957439,
+        0.9999985614605641, 0.9999985837738294, 0.9999986057409931, 0.9999986273674233,
+        0.9999986486584052, 0.9999986696191419, 0.9999986902547557, 0.9999987105702898,
+        0.9999987305707089, 0.9999987502609007, 0.9999987696456771, 0.9999987887297757,
+        0.9999988075178599, 0.9999988260145214, 0.9999988442242803, 0.999998862151587,
+        0.9999988798008224, 0.9999988971762998, 0.9999989142822654, 0.9999989311228996,
+        0.9999989477023179, 0.9999989640245721, 0.9999989800936512, 0.999998995913482,
+        0.9999990114879307, 0.9999990268208032, 0.999999041915847, 0.9999990567767507,
+        0.9999990714071463, 0.9999990858106091, 0.9999990999906591, 0.9999991139507616,
+        0.9999991276943282, 0.9999991412247177, 0.9999991545452366, 0.9999991676591402,
+        0.9999991805696334, 0.9999991932798713, 0.99999920579296, 0.9999992181119575,
+        0.9999992302398744, 0.9999992421796745, 0.9999992539342757, 0.9999992655065506,
+        0.9999992768993274, 0.9999992881153902, 0.99999929915748, 0.9999993100282953,
+        0.9999993207304928, 0.9999993312666879, 0.9999993416394555, 0.9999993518513304,
+        0.9999993619048084, 0.9999993718023463, 0.9999993815463629, 0.9999993911392395,
+        0.9999994005833205, 0.9999994098809137, 0.9999994190342913, 0.9999994280456905,
+        0.9999994369173133, 0.9999994456513278, 0.9999994542498685, 0.9999994627150366,
+        0.9999994710489011, 0.9999994792534984, 0.9999994873308338, 0.999999495282881,
+        0.9999995031115836, 0.9999995108188546, 0.9999995184065777, 0.9999995258766072,
+        0.9999995332307687, 0.9999995404708591, 0.9999995475986482, 0.9999995546158775,
+        0.9999995615242623, 0.9999995683254906, 0.9999995750212247, 0.9999995816131007,
+        0.9999995881027297, 0.9999995944916977, 0.9999996007815661, 0.9999996069738718,
+        0.9999996130701283, 0.9999996190718252, 0.9999996249804296, 0.9999996307973852,
+        0.9999996365241135, 0.9999996421620143, 0.9999996477124651, 0.9999996531768226,
+        0.999999658556422, 0.9999996638525781, 0.9999996690665852, 0.9999996741997175,
+        0.9999996792532293, 0.9999996842283558, 0.9999996891263129, 0.9999996939482974,
+        0.9999996986954877, 0.999999703369044, 0.9999997079701084, 0.9999997124998055,
+        0.9999997169592421, 0.9999997213495081, 0.9999997256716764, 0.9999997299268031,
+        0.9999997341159284, 0.9999997382400758, 0.9999997423002533, 0.999999746297453,
+        0.9999997502326521, 0.9999997541068119, 0.9999997579208793, 0.9999997616757865,
+        0.999999765372451, 0.9999997690117763, 0.9999997725946518, 0.999999776121953,
+        0.9999997795945421, 0.9999997830132675, 0.9999997863789649, 0.9999997896924566,
+        0.9999997929545527, 0.9999997961660501, 0.9999997993277336, 0.9999998024403761,
+        0.9999998055047382, 0.9999998085215688, 0.9999998114916051, 0.9999998144155728,
+        0.9999998172941869, 0.9999998201281504, 0.9999998229181561, 0.9999998256648859,
+        0.999999828369011, 0.9999998310311922, 0.99999983365208, 0.999999836232315,
+        0.999999838772528, 0.9999998412733395, 0.9999998437353605, 0.9999998461591932,
+        0.9999998485454296, 0.9999998508946528, 0.9999998532074371, 0.9999998554843477,
+        0.9999998577259408, 0.9999998599327645, 0.9999998621053581, 0.9999998642442522,
+        0.9999998663499698, 0.9999998684230257, 0.9999998704639261, 0.9999998724731699,
+        0.9999998744512483, 0.9999998763986444, 0.9999998783158345, 0.9999998802032868,
+        0.9999998820614627, 0.9999998838908163, 0.9999998856917947, 0.9999998874648379,
+    },
+    [Math::DistortionCurve::DIST_CURVE_SMOOTH_SHARP] = {
+        0.0, 2.7823437626284396e-17, 8.903500040411007e-16, 6.761095343187109e-15,
+        2.849120012931522e-14, 8.694824258213874e-14, 2.1635505098198748e-13, 4.676285161849618e-13,
+        9.11718404138087e-13, 1.6429461683944674e-12, 2.7823437626284398e-12, 4.480992453150728e-12,
+        6.923361631423599e-12, 1.0330647626576013e-11, 1.496411251791878e-11, 2.1128422947459714e-11,
+        2.917498893241879e-11, 3.9505302677743284e-11, 5.257427738862296e-11, 6.889358608300517e-11,
+        8.903500040411007e-11, 1.1363372943294574e-10, 1.433917585008233e-10, 1.790811880018722e-10,
+        2.2154757220555518e-10, 2.7171325806918357e-10, 3.305807240504324e-10, 3.992359189198556e-10,
+        4.788516005734009e-10, 5.706906748449256e-10, 6.761095343187108e-10, 7.965613971419776e-10,
+        9.335996458374012e-10, 1.088881166115627e-09, 1.264169685687785e-09, 1.4613391130780059e-09,
+        1.6823768764359346e-09, 1.9293872623492474e-09, 2.2045947546561653e-09, 2.510347373257971e-09,
+        2.8491200129315223e-09, 3.223517782141768e-09, 3.6362793418542636e-09, 4.090280244347685e-09,
+        4.588536272026346e-09, 5.134206776232711e-09, 5.73059801605991e-09, 6.381166497164258e-09,
+        7.089522310577766e-09, 7.859432471520655e-09, 8.694824258213874e-09, 9.599788550691618e-09,
+        1.0578583169613837e-08, 1.1635636215078754e-08, 1.2775549405435379e-08, 1.4003101416096027e-08,
+        1.532325121834883e-08, 1.6741141418170256e-08, 1.826210159503762e-08, 1.9891651640741595e-08,
+        2.1635505098198747e-08, 2.3499572500264023e-08, 2.5489964708543282e-08, 2.7612996252205813e-08,
+        2.987518866679684e-08, 3.228327383305004e-08, 3.484419731570006e-08, 3.756512170229505e-08,
+        4.045342994200912e-08, 4.3516728684454943e-08, 4.676285161849619e-08, 5.0199862811060075e-08,
+        5.383606004594991e-08, 5.7679978162657534e-08, 6.174039239517592e-08, 6.602632171081161e-08,
+        7.054703214899729e-08, 7.53120401601043e-08, 8.033111594425507e-08, 8.561428679013578e-08,
+        9.117184041380871e-08, 9.70143282975249e-08, 1.0315256902853658e-07, 1.0959765163790969e-07,
+        1.1636093893933644e-07, 1.2345407086794776e-07, 1.3088896781912593e-07, 1.3867783398731693e-07,
+        1.4683316070484306e-07, 1.5536772978071552e-07, 1.6429461683944675e-07, 1.7362719465986306e-07,
+        1.8337913651391713e-07, 1.9356441950550054e-07, 2.0419732790925626e-07, 2.1529245650939114e-07,
+        2.268647139384885e-07, 2.389293260163205e-07, 2.5150183908866095e-07, 2.645981233660974e-07,
+        2.78234376262844e-07, 2.924271257355539e-07, 3.071932336221318e-07, 3.2254989898054634e-07,
+        3.385146614276428e-07, 3.551054044779554e-07, 3.723403588825201e-07, 3.902381059676868e-07,
+        4.0881758097393213e-07, 4.2809807639467165e-07, 4.4809924531507287e-07, 4.688411047508671e-07,
+        4.903440389871625e-07, 5.126288029172566e-07, 5.357165253814482e-07, 5.596287125058506e-07,
+        5.843872510412038e-07, 6.100144117016869e-07, 6.36532852503731e-07, 6.639656221048314e-07,
+        6.923361631423599e-07, 7.216683155723779e-07, 7.519863200084487e-07, 7.833148210604496e-07,
+        8.15678870673385e-07, 8.491039314661986e-07, 8.83615880070586e-07, 9.192410104698072e-07,
+        9.560060373374988e-07, 9.939380993764875e-07, 1.0330647626576012e-06, 1.073414023958483e-06,
+        1.115014314102402e-06, 1.1578945012970678e-06, 1.2020838944734416e-06, 1.2476122466245486e-06,
+        1.294509758144292e-06, 1.3428070801662636e-06, 1.3925353179025582e-06, 1.4437260339825842e-06,
+        1.496411251791878e-06, 1.5506234588109148e-06, 1.6063956099539224e-06, 1.6637611309076935e-06,
+        1.722753921470397e-06, 1.7834083588903925e-06, 1.845759301205041e-06, 1.909842090579519e-06,
+        1.9756925566456294e-06, 2.043347019840615e-06, 2.1128422947459716e-06, 2.1842156934262586e-06,
+        2.2575050287679133e-06, 2.3327486178180633e-06, 2.4099852851233374e-06, 2.48925436606868e-06,
+        2.5705957102161623e-06, 2.654049684643796e-06, 2.739657177284345e-06, 2.827459600264137e-06,
+        2.917498893241879e-06, 3.009817526747466e-06, 3.1044585055207967e-06, 3.201465371850585e-06,
+        3.3008822089131704e-06, 3.4027536441113343e-06, 3.50712485241311e-06, 3.614041559690595e-06,
+        3.723550046058766e-06, 3.835697149214288e-06, 3.950530267774328e-06, 4.068097364615372e-06,
+        4.18844697021203e-06, 4.311628185975851e-06, 4.437690687594142e-06, 4.566684728368768e-06,
+        4.698661142554978e-06, 4.833671348700208e-06, 4.971767352982897e-06, 5.113001752551299e-06,
+        5.257427738862296e-06, 5.40509910102021e-06, 5.556070229115618e-06, 5.710396117564158e-06,
+        5.868132368445348e-06, 6.029335194841398e-06, 6.194061424176017e-06, 6.362368501553234e-06,
+        6.5343144930962e-06, 6.7099580892860126e-06, 6.8893586083005165e-06, 7.072575999353127e-06,
+        7.259670846031632e-06, 7.450704369637014e-06, 7.645738432522256e-06, 7.84483554143116e-06,
+        8.04805885083715e-06, 8.255472166282094e-06, 8.467139947715116e-06, 8.6831273128314e-06,
+        8.903500040411007e-06, 9.128324573657696e-06, 9.357668023537725e-06, 9.591598172118665e-06,
+        9.830183475908217e-06, 1.0073493069193026e-05, 1.0321596767377483e-05, 1.0574565070322552e-05,
+        1.083246916568457e-05, 1.1095380932254066e-05, 1.1363372943294573e-05, 1.163651846988144e-05,
+        1.1914891484240644e-05, 1.2198566663087599e-05, 1.2487619390965977e-05, 1.2782125763586516e-05,
+        1.3082162591165828e-05, 1.3387807401765216e-05, 1.3699138444629493e-05, 1.401623469352578e-05,
+        1.4339175850082332e-05, 1.4668042347127338e-05, 1.5002915352027748e-05, 1.5343876770028072e-05,
+        1.56910092475892e-05, 1.604439617572722e-05, 1.640412169335221e-05, 1.6770270690607076e-05,
+        1.7142928812206342e-05, 1.7522182460774984e-05, 1.790811880018722e-05, 1.8300825758905343e-05,
+        1.870039203331852e-05, 1.9106907091081613e-05, 1.952046117445398e-05, 1.9941145303638307e-05,
+        2.0369051280119393e-05, 2.0804271690002994e-05, 2.1246899907354604e-05, 2.1697030097538298e-05,
+        2.2154757220555517e-05, 2.26201770343839e-05, 2.3093386098316093e-05, 2.357448177629855e-05,
+        2.406356224027036e-05, 2.4560726473502044e-05, 2.5066074273934388e-05, 2.557970625751724e-05,
+        2.610172386154832e-05, 2.6632229348012053e-05, 2.7171325806918358e-05, 2.771911715964147e-05,
+        2.8275708162258752e-05, 2.8841204408889518e-05, 2.941571233503383e-05, 2.9999339220911308e-05,
+        3.059219319479996e-05, 3.1194383236374994e-05, 3.18060191800476e-05, 3.24272117183038e-05,
+        3.305807240504324e-05, 3.369871365891801e-05, 3.434924876667145e-05, 3.5009791886476975e-05,
+        3.5680458051276864e-05, 3.6361363172121106e-05, 3.705262404150617e-05, 3.775435833671387e-05,
+        3.846668462315013e-05, 3.9189722357683815e-05, 3.9923591891985555e-05, 4.066841447586654e-05,
+        4.142431226061734e-05, 4.219140830234672e-05, 4.2969826565320435e-05, 4.375969192530008e-05,
+        4.456113017288186e-05, 4.537426801683543e-05, 4.6199233087442694e-05, 4.7036153939836635e-05,
+        4.7885160057340096e-05, 4.874638185480462e-05, 4.9619950681949274e-05, 5.050599882669941e-05,
+        5.140465951852552e-05, 5.231606693178205e-05, 5.324035618904619e-05, 5.4177663364456695e-05,
+        5.5128125487052706e-05, 5.609188054411255e-05, 5.706906748449256e-05, 5.8059826221965886e-05,
+        5.9064297638561315e-05, 6.0082623587902064e-05, 6.111494689854461e-05, 6.21614113773175e-05,
+        6.322216181266014e-05, 6.429734397796166e-05, 6.538710463489968e-05, 6.649159153677914e-05,
+        6.761095343187109e-05, 6.874534006675154e-05, 6.989490218964027e-05, 7.10597915537396e-05,
+        7.224016092057323e-05, 7.343616406332507e-05, 7.464795577017803e-05, 7.587569184765282e-05,
+        7.71195291239468e-05, 7.837962545227275e-05, 7.965613971419776e-05, 8.09492318229819e-05,
+        8.225906272691719e-05, 8.358579441266633e-05, 8.492958990860147e-05, 8.629061328814316e-05,
+        8.766902967309904e-05, 8.906500523700266e-05, 9.047870720845239e-05, 9.19103038744501e-05,
+        9.335996458374012e-05, 9.48278597501479e-05, 9.631416085591892e-05, 9.781904045505747e-05,
+        9.93426721766655e-05, 0.00010088523072828138, 0.00010244689189921872, 0.00010402783256390521,
+        0.00010562823068522145, 0.00010724826531783969, 0.0001088881166115627, 0.00011054796581466256,
+        0.00011222799527721952, 0.00011392838845446071, 0.00011564932991009904, 0.00011739100531967202,
+        0.00011915360147388051, 0.00012093730628192754, 0.0001227423087748572, 0.00012456879910889335,
+        0.0001264169685687785, 0.00012828700957111263, 0.0001301791156676919, 0.00013209348154884763,
+        0.00013403030304678495, 0.0001359897771389217, 0.00013797210195122723, 0.00013997747676156125,
+        0.00014200610200301253, 0.0001440581792672378, 0.00014613391130780058, 0.00014823350204350993,
+        0.0001503571565617593, 0.00015250508112186532, 0.00015467748315840666, 0.00015687457128456275,
+        0.0001590965552954527, 0.00016134364617147404, 0.00016361605608164156, 0.00016591399838692612,
+        0.00016823768764359347, 0.000170587339606543, 0.00017296317123264673, 0.00017536540068408785,
+        0.00017779424733169977, 0.0001802499317583048, 0.00018273267576205304, 0.00018524270235976113,
+        0.00018778023579025114, 0.00019034550151768927, 0.00019293872623492474, 0.0001955601378668286,
+        0.00019820996557363255, 0.00020088843975426773, 0.00020359579204970348, 0.00020633225534628626,
+        0.0002090980637790784, 0.00021189345273519696, 0.0002147186588571524, 0.0002175739200461876,
+        0.00022045947546561653, 0.00022337556554416312, 0.00022632243197930006, 0.00022930031774058755,
+        0.00023230946707301223, 0.00023535012550032593, 0.00023842253982838446, 0.00024152695814848646,
+        0.0002446636298407122, 0.0002478328055772624, 0.0002510347373257971, 0.00025426967835277424,
+        0.0002575378832267888, 0.00026083960782191136, 0.000264175109321027, 0.0002675446462191743,
+        0.0002709484783268837, 0.0002743868667735168, 0.0002778600740106048, 0.0002813683638151875,
+        0.00028491200129315223, 0.00028849125288257234, 0.0002921063863570463, 0.00029575767082903626,
+        0.0002994453767532072, 0.0003031697759297653, 0.00030693114150779727, 0.00031072974798860865,
+        0.00031456587122906295, 0.0003184397884449204, 0.0003223517782141768, 0.00032630212048040207,
+        0.00033029109655607946, 0.000334318989125944, 0.00033838608225032166, 0.00034249266136846776,
+        0.0003466390133019062, 0.000350825426257768, 0.0003550521898321301, 0.0003593195950133544,
+        0.00036362793418542633, 0.00036797750113129387, 0.00037236859103620607, 0.0003768015004910523,
+        0.0003812765274957006, 0.0003857939714623368, 0.00039035413321880316, 0.0003949573150119374,
+        0.0003996038205109113, 0.0004042939548105695, 0.00040902802443476853, 0.00041380633733971537,
+        0.0004186292029173065, 0.00042349693199846645, 0.0004284098368564869, 0.00043336823121036536,
+        0.00043837243022814377, 0.0004434227505302477, 0.000448519510192825, 0.00045366302875108434,
+        0.0004588536272026346, 0.0004640916280108231, 0.0004693773551080748, 0.00047471113389923095,
+        0.0004800932912648879, 0.000485524155564736, 0.0004910040566408983, 0.0004965333258212694,
+        0.0005021122959228545, 0.0005077413012551076, 0.0005134206776232711, 0.0005191507623317138,
+        0.0005249318941872707, 0.0005307644135025808, 0.0005366486620994264, 0.000542584983312072,
+        0.0005485737219906029, 0.0005546152245042643, 0.0005607098387447995, 0.0005668579141297894,
+        0.000573059801605991, 0.0005793158536526764, 0.000585626424284971, 0.0005919918690571932,
+        0.0005984125450661927, 0.0006048888109546892, 0.0006114210269146116, 0.0006180095546904366,
+        0.0006246547575825274, 0.0006313570004504729, 0.0006381166497164258, 0.0006449340733684424,
+        0.0006518096409638206, 0.0006587437236324391, 0.0006657366940800958, 0.0006727889265918473,
+        0.0006799007970353473, 0.0006870726828641853, 0.0006943049631212255, 0.0007015980184419459,
+        0.0007089522310577765, 0.000716367984799439, 0.0007238456651002848, 0.0007313856589996342,
+        0.000738988355146115, 0.0007466541438010016, 0.0007543834168415536, 0.0007621765677643548,
+        0.0007700339916886515, 0.0007779560853596921, 0.0007859432471520654, 0.0007939958770730394,
+        0.0008021143767659004, 0.0008102991495132915, 0.0008185506002405516, 0.0008268691355190542,
+        0.0008352551635695463, 0.0008437090942654867, 0.0008522313391363857, 0.0008608223113711431,
+        0.0008694824258213875, 0.0008782120990048146, 0.000887011749108527, 0.0008958817959923717,
+        0.0009048226611922801, 0.0009138347679236059, 0.0009229185410844646, 0.0009320744072590718,
+        0.0009413027947210825, 0.0009506041334369293, 0.0009599788550691619, 0.0009694273929797851,
+        0.0009789501822335988, 0.000988547659601536, 0.0009982202635639998, 0.0010079684343142078,
+        0.0010177926137615232, 0.0010276932455348016, 0.0010376707749857215, 0.0010477256491921326,
+        0.0010578583169613836, 0.0010680692288336732, 0.0010783588370853762, 0.0010887275957323951,
+        0.0010991759605334865, 0.0011097043889936112, 0.0011203133403672632, 0.0011310032756618174,
+        0.0011417746576408597, 0.0011526279508275348, 0.0011635636215078754, 0.001174582137734151,
+        0.0011856839693281974, 0.001196869587884764, 0.0012081394667748438, 0.001219494081149022,
+        0.0012309339079408042, 0.0012424594258699663, 0.001254071115445882, 0.0012657694589708736,
+        0.0012775549405435378, 0.0012894280460620977, 0.0013013892632277293, 0.0013134390815479117,
+        0.001325577992339755, 0.0013378064887333498, 0.0013501250656750951, 0.0013625342199310487,
+        0.001375034450090254, 0.0013876262565680909, 0.0014003101416096026, 0.001413086609292846,
+        0.0014259561655322196, 0.0014389193180818127, 0.0014519765765387339, 0.0014651284523464604,
+        0.0014783754587981662, 0.001491718111040072, 0.0015051569260747723, 0.0015186924227645858,
+        0.001532325121834883, 0.0015460555458774365, 0.001559884219353748, 0.0015738116685983987,
+        0.0015878384218223768, 0.0016019650091164276, 0.001616191962454381, 0.0016305198156965019,
+        0.0016449491045928165, 0.001659480366786465, 0.0016741141418170256, 0.001688850971123868,
+        0.0017036913980494782, 0.0017186359678428105, 0.0017336852276626142, 0.0017488397265807841,
+        0.0017641000155856866, 0.0017794666475855125, 0.0017949401774116015, 0.0018105211618217954,
+        0.001826210159503762, 0.001842007731078349, 0.0018579144391029083, 0.0018739308480746491,
+        0.001890057524433962, 0.0019062950365677728, 0.001922643954812866, 0.0019391048514592394,
+        0.0019556783007534276, 0.0019723648789018544, 0.00198916516407416, 0.00200607973640655,
+        0.0020231091780051245, 0.0020402540729492274, 0.002057515007294773, 0.002074892569077599,
+        0.0020923873483167897, 0.002109999937018031, 0.0021277309291769324, 0.0021455809207823833,
+        0.002163550509819875, 0.0021816402962748544, 0.0021998508821360493, 0.002218182871398821,
+        0.002236636870068489, 0.002255213486163682, 0.002273913329719667, 0.0022927370127916982,
+        0.0023116851494583432, 0.0023307583558248367, 0.002349957250026402, 0.00236928245223161,
+        0.002388734584645697, 0.002408314271513922, 0.00242802213912489, 0.0024478588158139063,
+        0.0024678249319662975, 0.00248792112002077, 0.002508148014472728, 0.002528506251877635,
+        0.002548996470854328, 0.002569619312088381, 0.002590375418335421, 0.002611265434424487,
+        0.00263229000726135, 0.002653449785831872, 0.0026747454212053224, 0.002696177566537739,
+        0.002717746877075247, 0.0027394540101574162, 0.002761299625220581, 0.002783284383801199,
+        0.002805408949539169, 0.002827673988181191, 0.002850080167584085, 0.0028726281577181483,
+        0.0028953186306704764, 0.0029181522606483196, 0.0029411297239824033, 0.0029642516991302877,
+        0.002987518866679684, 0.0030109319093518144, 0.0030344915120047327, 0.00305819836163668,
+        0.0030820531473894053, 0.0031060565605515247, 0.003130209294561839, 0.0031545120450126936,
+        0.003178965509653296, 0.003203570388393076, 0.003228327383305004, 0.003253237198628949,
+        0.003278300540774999, 0.003303518118326818, 0.003328890642044967, 0.0033544188248702607,
+        0.0033801033819270865, 0.003405945030526766, 0.00343194449017087, 0.0034581024825545807,
+        0.0034844197315700063, 0.003510896963309546, 0.003537534906069202, 0.0035643342903519445,
+        0.0035912958488710247, 0.0036184203165533385, 0.0036457084305427426, 0.0036731609302034143,
+        0.0037007785571231693, 0.003728562055116823, 0.0037565121702295046, 0.0037846296507400225,
+        0.0038129152471641763, 0.003841369712258121, 0.0038699938010216812, 0.003898788270701716,
+        0.0039277538807954305, 0.00395689139305374, 0.003986201571484587, 0.004015685182356301,
+        0.004045342994200912, 0.004075175777817521, 0.004105184306275604, 0.0041353693549183845,
+        0.004165731701366141, 0.004196272125519576, 0.004226991409563124, 0.004257890337968323,
+        0.004288969697497118, 0.0043202302772052375, 0.004351672868445494, 0.0043832982648711605,
+        0.004415107262439271, 0.004447100659414, 0.00447927925636996, 0.004511643856195578,
+        0.004544195264096401, 0.004576934287598466, 0.0046098617365516095, 0.004642978423132834,
+        0.004676285161849618, 0.004709782769543288, 0.004743472065392318, 0.004777353870915711,
+        0.0048114290099762974, 0.004845698308784111, 0.00488016259589969, 0.004914822702237457,
+        0.004949679461069013, 0.004984733708026522, 0.005019986281106008, 0.00505543802067073,
+        0.005091089769454486, 0.005126942372564989, 0.005162996677487169, 0.005199253534086544,
+        0.00523571379461253, 0.005272378313701808, 0.005309247948381636, 0.005346323558073213,
+        0.005383606004594991, 0.005421096152166045, 0.005458794867409376, 0.00549670301935529,
+        0.005534821479444695, 0.005573151121532479, 0.005611692821890811, 0.00565044745921252,
+        0.005689415914614393, 0.00572859907164055, 0.005767997816265753, 0.005807613036898774,
+        0.005847445624385697, 0.005887496472013302, 0.005927766475512356, 0.005968256533060999,
+        0.0060089675452880366, 0.006049900415276322, 0.006091056048566057, 0.006132435353158163,
+        0.006174039239517592, 0.006215868620576691, 0.0062579244117385155, 0.006300207530880195,
+        0.006342718898356242, 0.006385459437001925, 0.006428430072136567, 0.006471631731566931,
+        0.0065150653455905115, 0.0065587318469989145, 0.00660263217108116, 0.006646767255627059,
+        0.006691138040930509, 0.0067357454697928795, 0.006780590487526303, 0.0068256740419570605,
+        0.006870997083428877, 0.006916560564806301, 0.006962365441478003, 0.007008412671360155,
+        0.007054703214899729, 0.007101238035077875, 0.007148018097413221, 0.00719504436996525,
+        0.007242317823337602, 0.00728983943068145, 0.0073376101676988015, 0.007385631012645872,
+        0.007433902946336391, 0.007482426952144975, 0.00753120401601043, 0.007580235126439126,
+        0.007629521274508303, 0.007679063453869441, 0.007728862660751567, 0.007778919893964628,
+        0.00782923615490279, 0.007879812447547827, 0.007930649778472397, 0.007981749156843453,
+        0.008033111594425508, 0.008084738105584039, 0.008136629707288776, 0.008188787419117079,
+        0.008241212263257242, 0.008293905264511866, 0.008346867450301164, 0.008400099850666335,
+        0.008453603498272864, 0.008507379428413907, 0.008561428679013577, 0.008615752290630335,
+        0.008670351306460279, 0.008725226772340533, 0.008780379736752537, 0.00883581125082543,
+        0.008891522368339353, 0.008947514145728813, 0.009003787642086, 0.009060343919164156,
+        0.009117184041380871, 0.009174309075821474, 0.009231720092242315, 0.009289418163074162,
+        0.00934740436342548, 0.009405679771085834, 0.00946424546652916, 0.00952310253291717,
+        0.00958225205610263, 0.009641695124632754, 0.00970143282975249, 0.009761466265407914,
+        0.009821796528249513, 0.009882424717635573, 0.009943351935635477, 0.010004579287033081,
+        0.010066107879330015, 0.010127938822749063, 0.010190073230237453, 0.010252512217470257,
+        0.010315256902853658, 0.010378308407528361, 0.010441667855372866, 0.01050533637300687,
+        0.010569315089794543, 0.010633605137847923, 0.010698207652030209, 0.010763123769959141,
+        0.010828354632010293, 0.010893901381320466, 0.010959765163790968, 0.011025947128091013,
+        0.011092448425660999, 0.011159270210715905, 0.011226413640248576, 0.011293879874033113,
+        0.011361670074628164, 0.011429785407380306, 0.01149822704042734, 0.011566996144701682,
+        0.011636093893933643, 0.011705521464654825, 0.011775280036201404, 0.011845370790717527,
+        0.011915794913158594, 0.011986553591294653, 0.012057648015713674, 0.01212907937982496,
+        0.01220084887986242, 0.01227295771488796, 0.012345407086794777, 0.012418198200310746,
+        0.012491332263001701, 0.012564810485274842, 0.012638634080381997, 0.012712804264423042,
+        0.012787322256349161, 0.012862189277966257, 0.012937406553938224, 0.01301297531179035,
+        0.013088896781912593, 0.013165172197562981, 0.013241802794870892, 0.01331878981284045,
+        0.013396134493353808, 0.01347383808117454, 0.013551901823950926, 0.013630326972219354,
+        0.013709114779407582, 0.013788266501838162, 0.013867783398731692, 0.01394766673221024,
+        0.0140279177673006, 0.014108537771937716, 0.014189528016967927, 0.014270889776152405,
+        0.0143526243261704, 0.014434732946622661, 0.014517216920034699, 0.014600077531860206,
+        0.014683316070484308, 0.014766933827226984, 0.01485093209634634, 0.014935312175042001,
+        0.015020075363458394, 0.015105222964688155, 0.01519075628477539, 0.015276676632719095,
+        0.015362985320476414, 0.015449683662966054, 0.015536772978071552, 0.015624254586644688,
+        0.015712129812508746, 0.015800399982461927, 0.015889066426280622, 0.015978130476722814,
+        0.016067593469531342, 0.016157456743437333, 0.016247721640163443, 0.016338389504427283,
+        0.016429461683944675, 0.01652093952943308, 0.016612824394614843, 0.01670511763622063,
+        0.016797820613992664, 0.016890934690688163, 0.016984461232082585, 0.017078401606973062,
+        0.017172757187181645, 0.01726752934755873, 0.017362719465986304, 0.017458328923381394,
+        0.017554359103699294, 0.017650811393936996, 0.017747687184136458, 0.017844987867387998,
+        0.017942714839833583, 0.01804086950067023, 0.01813945325215326, 0.018238467499599738,
+        0.018337913651391712, 0.01843779311897964, 0.018538107316885644, 0.018638857662706936,
+        0.01874004557711907, 0.018841672483879374, 0.018943739809830183, 0.019046248984902286,
+        0.019149201442118166, 0.01925259861759543, 0.019356441950550054, 0.019460732883299827,
+        0.01956547286126757, 0.01967066333298461, 0.01977630575009397, 0.019882401567353863,
+        0.019988952242640877, 0.020095959236953464, 0.020203424014415133, 0.020311348042277924,
+        0.020419732790925627, 0.02052857973387723, 0.020637890347790157, 0.0207476661124637,
+        0.02085790851084226, 0.020968619029018795, 0.02107979915623805, 0.021191450384899994,
+        0.021303574210563066, 0.02141617213194761, 0.021529245650939114, 0.021642796272591653,
+        0.021756825505131114, 0.021871334859958656, 0.02198632585165393, 0.022101799997978528,
+        0.022217758819879217, 0.022334203841491384, 0.02245113659014227, 0.022568558596354402,
+        0.02268647139384885, 0.022804876519548652, 0.02292377551358205, 0.023043169919285945,
+        0.023163061283209115, 0.023283451155115674, 0.023404341087988296, 0.02352573263803166,
+        0.02364762736467568, 0.023770026830578973, 0.023892932601632052, 0.024016346246960807,
+        0.024140269338929717, 0.0242647034531453, 0.024389650168459353, 0.02451511106697238,
+        0.024641087734036848, 0.024767581758260607, 0.024894594731510147, 0.025022128248914022,
+        0.025150183908866093, 0.025278763313028974, 0.025407868066337262, 0.02553749977700098,
+        0.025667660056508813, 0.025798350519631554, 0.025929572784425328, 0.02606132847223505,
+        0.026193619207697652, 0.02632644661874552, 0.026459812336609736, 0.026593717995823527,
+        0.02672816523422548, 0.026863155692963013, 0.026998691016495574, 0.02713477285259813,
+        0.027271402852364342, 0.027408582670210076, 0.02754631396387658, 0.02768459839443396,
+        0.0278234376262844, 0.02796283332716561, 0.028102787168154068, 0.02824330082366845,
+        0.028384375971472864, 0.02852601429268031, 0.028668217471755894, 0.028810987196520293,
+        0.028954325158152962, 0.029098233051195608, 0.029242712573555388, 0.0293877654265084,
+        0.029533393314702866, 0.02967959794616262, 0.029826381032290298, 0.029973744287870835,
+        0.03012168943107464, 0.03027021818346109, 0.03041933226998174, 0.030569033418983756,
+        0.03071932336221318, 0.030870203834818345, 0.031021676575353124, 0.03117374332578038,
+        0.03132640583147516, 0.031479665841228195, 0.03163352510724915, 0.031787985385169894,
+        0.031943048434047994, 0.03209871601636997, 0.03225498989805465, 0.032411871848456425,
+        0.03256936364036874, 0.03272746705002734, 0.03288618385711365, 0.03304551584475798,
+        0.03320546479954309, 0.03336603251150736, 0.03352722077414824, 0.03368903138442539,
+        0.033851466142764276, 0.034014526853059376, 0.03417821532267754, 0.03434253336246122,
+        0.03450748278673204, 0.034673065413293944, 0.034839283063436643, 0.035006137561938794,
+        0.03517363073707157, 0.03534176442060183, 0.03551054044779556, 0.035679960657421045,
+        0.03585002689175242, 0.0360207409965729, 0.036192104821178156, 0.03636412021837951,
+        0.03653678904450751, 0.036710113159415116, 0.036884094426481114, 0.037058734712613284,
+        0.03723403588825201, 0.03740999982737342, 0.037586628407492835, 0.03776392350966793,
+        0.03794188701850232, 0.038120520822148736, 0.03829982681231245, 0.038479806884254446,
+        0.038660462936795, 0.038841796872316876, 0.0390238105967687, 0.0392065060196682,
+        0.03938988505410573, 0.03957394961674749, 0.03975870162783892, 0.03994414301120787,
+        0.040130275694268226, 0.040317101608023036, 0.040504622687067955, 0.04069284086959441,
+        0.04088175809739321, 0.04107137631585769, 0.04126169747398713, 0.041452723524389966,
+        0.04164445642328734, 0.04183689813051629, 0.04203005060953317, 0.04222391582741683,
+        0.04241849575487216, 0.04261379236623333, 0.04280980763946719, 0.04300654355617639,
+        0.043204002101603044, 0.043402185264631854, 0.04360109503779356, 0.043800733417268076,
+        0.044001102402888126, 0.04420220399814239, 0.04440404021017891, 0.04460661304980829,
+        0.044809924531507284, 0.04501397667342195, 0.04521877149737107, 0.04542431102884937,
+        0.04563059729703103, 0.04583763233477292, 0.04604541817861801, 0.046253956868798504,
+        0.046463250449239483, 0.046673300967562045, 0.046884110475086734, 0.0470956810268367,
+        0.04730801468154132, 0.04752111350163934, 0.047734979553282306, 0.047949614906337736,
+        0.048165021634392714, 0.04838120181475706, 0.048598157528466746, 0.04881589086028707,
+        0.04903440389871626, 0.049253698735988616, 0.04947377746807797, 0.049694642194700815,
+        0.049916295019319934, 0.05013873804914755, 0.05036197339514876, 0.050586003172044675,
+        0.05081082949831606, 0.05103645449620647, 0.05126288029172568, 0.051490109014652875,
+        0.051718142798540194, 0.05194698378071595, 0.05217663410228806, 0.05240709590814712,
+        0.05263837134697013, 0.052870462571223575, 0.05310337173716688, 0.05333710100485555,
+        0.05357165253814482, 0.05380702850469277, 0.054043231075963774, 0.054280262427231656,
+        0.0545181247375833, 0.054756820189921805, 0.054996350970969936, 0.05523671927127323,
+        0.055477927285203656, 0.05571997721096276, 0.05596287125058509, 0.05620661160994133,
+        0.05645120049874197, 0.056696640130540404, 0.0569429327227364, 0.05719008049657921,
+        0.05743808567717125, 0.057686950493471195, 0.05793667717829745, 0.058187267968331256,
+        0.05843872510412038, 0.05869105083008219, 0.05894424739450717, 0.05919831704956195,
+        0.05945326205129307, 0.05970908465963003, 0.05996578713838877, 0.060223371755274785,
+        0.060481840781886786, 0.06074119649371982, 0.06100144117016873, 0.06126257709453125,
+        0.061524606554011714, 0.06178753183972413, 0.06205135524669566, 0.062316079073869726,
+        0.06258170562410968, 0.0628482372042019, 0.06311567612485934, 0.06338402470072448,
+        0.06365328525037312, 0.06392346009631746, 0.0641945515650096, 0.06446656198684454,
+        0.06473949369616398, 0.06501334903125934, 0.06528813033437528, 0.06556383995171275,
+        0.06584048023343274, 0.06611805353365932, 0.06639656221048316, 0.0666760086259646,
+        0.06695639514613727, 0.06723772414101138, 0.06751999798457699, 0.0678032190548072,
+        0.06808738973366184, 0.06837251240709054, 0.06865858946503627, 0.06894562330143829,
+        0.069233616314236, 0.06952257090537195, 0.06981248948079534, 0.07010337445046509,
+        0.07039522822835358, 0.07068805323244969, 0.07098185188476228, 0.07127662661132335,
+        0.07157237984219164, 0.07186911401145579, 0.07216683155723783, 0.07246553492169615,
+        0.07276522655102935, 0.07306590889547923, 0.07336758440933434, 0.073670255550933,
+        0.07397392478266698, 0.07427859457098475, 0.07458426738639477, 0.07489094570346864,
+        0.07519863200084487, 0.07550732876123188, 0.07581703847141152, 0.07612776362224213,
+        0.0764395067086623, 0.07675227022969387, 0.0770660566884455, 0.07738086859211568,
+        0.07769670845199649, 0.07801357878347663, 0.078331482106045, 0.07865042094329362,
+        0.07897039782292152, 0.07929141527673769, 0.07961347584066464, 0.07993658205474138,
+        0.0802607364631273, 0.0805859416141051, 0.08091220006008432, 0.08123951435760442,
+        0.0815678870673385, 0.08189732075409642, 0.0822278179868282, 0.08255938133862711,
+        0.08289201338673347, 0.08322571671253765, 0.08356049390158359, 0.0838963475435718,
+        0.0842332802323632, 0.08457129456598216, 0.0849103931466199, 0.08525057858063764,
+        0.08559185347857032, 0.08593422045512965, 0.08627768212920765, 0.0866222411238796,
+        0.08696790006640791, 0.0873146615882451, 0.08766252832503732, 0.0880115029166274,
+        0.0883615880070586, 0.08871278624457768, 0.08906510028163837, 0.08941853277490443,
+        0.08977308638525341, 0.09012876377777973, 0.09048556762179812, 0.0908435005908467,
+        0.09120256536269072, 0.09156276461932569, 0.09192410104698075, 0.0922865773361218,
+        0.09265019618145524, 0.09301496028193104, 0.09338087234074623, 0.09374793506534786,
+        0.0941161511674369, 0.09448552336297127, 0.09485605437216921, 0.09522774691951244,
+        0.09560060373374989, 0.09597462754790077, 0.09634982109925806, 0.09672618712939152,
+        0.09710372838415145, 0.09748244761367184, 0.09786234757237376, 0.09824343101896842,
+        0.09862570071646097, 0.09900915943215355, 0.09939380993764879, 0.09977965500885275,
+        0.10016669742597885, 0.1005549399735508, 0.1009443854404062, 0.10133503661969939,
+        0.10172689630890547, 0.10211996730982317, 0.10251425242857844, 0.10290975447562738,
+        0.10330647626576013, 0.10370442061810388, 0.10410359035612637, 0.10450398830763885,
+        0.10490561730479997, 0.10530848018411876, 0.10571257978645818, 0.10611791895703805,
+        0.10652450054543894, 0.10693232740560518, 0.10734140239584834, 0.10775172837885022,
+        0.10816330822166677, 0.108576144795731, 0.10899024097685651, 0.10940559964524058,
+        0.10982222368546785, 0.11024011598651348, 0.11065927944174658, 0.11107971694893319,
+        0.1115014314102402, 0.11192442573223829, 0.11234870282590548, 0.11277426560663004,
+        0.11320111699421447, 0.11362925991287842, 0.11405869729126222, 0.11448943206242984,
+        0.11492146716387279, 0.1153548055375131, 0.11578945012970683, 0.11622540389124707,
+        0.11666266977736776, 0.11710125074774674, 0.11754114976650926, 0.11798236980223087,
+        0.11842491382794142, 0.11886878482112798, 0.11931398576373833, 0.11976051964218401,
+        0.12020838944734415, 0.12065759817456845, 0.12110814882368072, 0.12156004439898184,
+        0.12201328790925364, 0.1224678823677619, 0.12292383079225987, 0.12338113620499118,
+        0.1238398016326938, 0.12429983010660302, 0.12476122466245491, 0.1252239883404893,
+        0.12568812418545378, 0.12615363524660644, 0.1266205245777197, 0.12708879523708297,
+        0.12755845028750679, 0.12802949279632567, 0.12850192583540163, 0.12897575248112716,
+        0.1294509758144292, 0.129927598920772, 0.13040562489016067, 0.1308850568171442,
+        0.13136589780081934, 0.13184815094483346, 0.1323318193573883, 0.13281690615124267,
+        0.13330341444371652, 0.1337913473566939, 0.13428070801662642, 0.13477149955453624,
+        0.13526372510601997, 0.13575738781125166, 0.13625249081498633, 0.1367490372665628,
+        0.1372470303199078, 0.1377464731335388, 0.1382473688705676, 0.1387497206987032,
+        0.13925353179025582, 0.1397588053221398, 0.14026554447587714, 0.14077375243760037,
+        0.14128343239805669, 0.1417945875526107, 0.142307221101248, 0.14282133624857818,
+        0.14333693620383872, 0.14385402418089793, 0.1443726033982585, 0.14489267707906037,
+        0.14541424845108483, 0.14593732074675728, 0.14646189720315092, 0.14698798106198951,
+        0.1475155755696515, 0.14804468397717288, 0.1485753095402507, 0.14910745551924598,
+        0.1496411251791878, 0.15017632178977608, 0.1507130486253852, 0.15125130896506686,
+        0.15179110609255417, 0.1523324432962644, 0.15287532386930275, 0.15341975110946493,
+        0.15396572831924152, 0.15451325880582062, 0.15506234588109155, 0.15561299286164756,
+        0.1561652030687901, 0.15671897982853147, 0.1572743264715986, 0.15783124633343568,
+        0.15838974275420842, 0.1589498190788068, 0.1595114786568487, 0.1600747248426827,
+        0.16063956099539226, 0.16120599047879836, 0.16177401666146335, 0.16234364291669356,
+        0.16291487262254356, 0.16348770916181887, 0.16406215592207965, 0.16463821629564346,
+        0.16521589367958942, 0.1657951914757609, 0.1663761130907694, 0.16695866193599707,
+        0.16754284142760095, 0.16812865498651586, 0.16871610603845785, 0.1693051980139272,
+        0.16989593434821235, 0.17048831848139281, 0.1710823538583428, 0.171678043928734,
+        0.1722753921470397, 0.1728744019725376, 0.17347507686931343, 0.17407742030626372,
+        0.17468143575710005, 0.17528712670035168, 0.1758944966193693, 0.17650354900232776,
+        0.17711428734223025, 0.17772671513691107, 0.17834083588903932, 0.17895665310612152,
+        0.17957417030050596, 0.1801933909893854, 0.18081431869480064, 0.18143695694364342,
+        0.18206130926766056, 0.1826873792034566, 0.1833151702924976, 0.1839446860811139,
+        0.1845759301205041, 0.18520890596673817, 0.18584361718076076, 0.18648006732839412,
+        0.18711825998034232, 0.1877581987121939, 0.18839988710442565, 0.18904332874240523,
+        0.1896885272163954, 0.19033548612155693, 0.19098420905795196, 0.19163469963054705,
+        0.19228696144921717, 0.19294099812874854, 0.19359681328884232, 0.19425441055411719,
+        0.1949137935541138, 0.19557496592329732, 0.1962379313010612, 0.19690269333172988,
+        0.19756925566456293, 0.19823762195375794, 0.1989077958584541, 0.19957978104273494,
+        0.2002535811756325, 0.20092919993113015, 0.20160664098816625, 0.20228590803063679,
+        0.20296700474739973, 0.2036499348322777, 0.2043347019840616, 0.20502130990651332,
+        0.20570976230837015, 0.20640006290334734, 0.2070922154101418, 0.20778622355243484,
+        0.20848209105889637, 0.20917982166318774, 0.20987941910396526, 0.21058088712488304,
+        0.21128422947459713, 0.21198944990676835, 0.2126965521800659, 0.21340554005817,
+        0.2141164173097763, 0.21482918770859855, 0.21554385503337214, 0.21626042306785698,
+        0.2169788956008417, 0.21769927642614628, 0.21842156934262594, 0.21914577815417352,
+        0.21987190666972406, 0.22059995870325735, 0.22132993807380164, 0.2220618486054363,
+        0.2227956941272961, 0.22353147847357407, 0.22426920548352497, 0.22500887900146804,
+        0.22575050287679133, 0.22649408096395443, 0.227239617122492, 0.22798711521701664,
+        0.22873657911722306, 0.2294880126978908, 0.230241419838888, 0.23099680442517387,
+        0.23175417034680326, 0.23251352149892915, 0.23327486178180643, 0.2340381951007945,
+        0.23480352536636165, 0.23557085649408777, 0.23634019240466791, 0.2371115370239151,
+        0.23788489428276452, 0.2386602681172763, 0.2394376624686392, 0.24021708128317315,
+        0.24099852851233375, 0.24178200811271477, 0.24256752404605203, 0.2433550802792259,
+        0.24414468078426568, 0.24493632953835234, 0.2457300305238221, 0.24652578772816922,
+        0.24732360514405013, 0.24812348676928636, 0.24892543660686808, 0.2497294586649567,
+        0.2505355569568893, 0.2513437355011814, 0.25215399832153046, 0.2529663494468185,
+        0.2537807929111167, 0.254597332753688, 0.2554159730189905, 0.25623671775668033,
+        0.25705957102161625, 0.25788453687386176, 0.25871161937868925, 0.25954082260658246,
+        0.2603721506332408, 0.2612056075395822, 0.26204119741174653, 0.26287892434109844,
+        0.26371879242423174, 0.2645608057629718, 0.2654049684643797, 0.26625128464075437,
+        0.26709975840963723, 0.26795039389381486, 0.26880319522132273, 0.26965816652544744,
+        0.27051531194473166, 0.2713746356229765, 0.27223614170924504, 0.27309983435786533,
+        0.2739657177284345, 0.27483379598582147, 0.2757040733001707, 0.2765765538469048,
+        0.2774512418067289, 0.2783281413656333, 0.27920725671489705, 0.2800885920510908,
+        0.2809721515760812, 0.2818579394970331, 0.2827459600264138, 0.2836362173819954,
+        0.2845287157868593, 0.2854234594693985, 0.286320452663322, 0.28721969960765664,
+        0.288121204546752, 0.28902497173028285, 0.289931005413253, 0.2908393098559976,
+        0.2917498893241879, 0.2926627480888337, 0.2935778904262872, 0.2944953206182452,
+        0.2954150429517541, 0.2963370617192121, 0.2972613812183732, 0.2981880057523493,
+        0.2991169396296154, 0.3000481871640115, 0.3009817526747467, 0.3019176404864017,
+        0.30285585492893313, 0.3037964003376765, 0.30473928105334946, 0.30568450142205467,
+        0.3066320657952842, 0.30758197852992203, 0.30853424398824814, 0.3094888665379404,
+        0.3104458505520797, 0.3114052004091522, 0.31236692049305326, 0.31333101519308965,
+        0.3142974889039844, 0.3152663460258792, 0.31623759096433834, 0.3172112281303508,
+        0.31818726194033525, 0.3191656968161423, 0.3201465371850586, 0.32112978747980875,
+        0.32211545213856047, 0.32310353560492683, 0.32409404232797, 0.3250869767622039,
+        0.3260823433675985, 0.32708014660958284, 0.32808039095904823, 0.32908308089235094,
+        0.33008822089131706, 0.33109581544324457, 0.33210586904090755, 0.3331183861825582,
+        0.3341333713719317, 0.335150829118249, 0.33617076393621986, 0.337193180346046,
+        0.33821808287342536, 0.33924547604955474, 0.34027536441113354, 0.34130775250036616,
+        0.3423426448649667, 0.34338004605816136, 0.3444199606386925, 0.3454623931708206,
+        0.3465073482243294, 0.34755483037452795, 0.3486048442022549, 0.3496573942938804,
+        0.350712485241311, 0.3517701216419923, 0.3528303080989124, 0.35389304922060466,
+        0.35495834962115197, 0.3560262139201896, 0.357096646742909, 0.3581696527200596,
+        0.3592452364879544, 0.36032340268847185, 0.3614041559690596, 0.3624875009827374,
+        0.36357344238810124, 0.3646619848493261, 0.3657531330361698, 0.36684689162397516,
+        0.3679432652936749, 0.3690422587317941, 0.37014387663045384, 0.37124812368737375,
+        0.37235500460587656, 0.37346452409489084, 0.3745766868689544, 0.37569149764821697,
+        0.3768089611584449, 0.3779290821310235, 0.37905186530296087, 0.3801773154168903,
+        0.381305437221075, 0.38243623546941063, 0.3835697149214289, 0.38470588034229997,
+        0.38584473650283757, 0.38698628817950087, 0.38813054015439874, 0.3892774972152918,
+        0.3904271641555974, 0.39157954577439197, 0.39273464687641474, 0.3938924722720702,
+        0.39505302677743287, 0.3962163152142497, 0.39738234240994386, 0.39855111319761705,
+        0.39972263241605444, 0.4008969049097269, 0.40207393552879495, 0.4032537291291109,
+        0.4044362905722239, 0.4056216247253823, 0.40680973646153734, 0.40800063065934544,
+        0.40919431220317315, 0.41039078598309964, 0.41159005689492023, 0.4127921298401489,
+        0.41399700972602316, 0.41520470146550625, 0.4164152099772912, 0.4176285401858028,
+        0.41884469702120297, 0.4200636854193925, 0.4212855103220154, 0.4225101766764609,
+        0.42373768943586854, 0.42496805355913025, 0.4262012740108944, 0.42743735576156805,
+        0.42867630378732186, 0.42991812307009214, 0.43116281859758526, 0.4324103953632794,
+        0.43366085836642965, 0.43491421261207047, 0.4361704631110193, 0.43742961487987897,
+        0.4386916729410426, 0.439956642322696, 0.4412245280588212, 0.44249533518919903,
+        0.44376906875941413, 0.44504573382085694, 0.44632533543072767, 0.44760787865203866,
+        0.4488933685536192, 0.45018181021011805, 0.4514732087020069, 0.4527675691155829,
+        0.45406489654297366, 0.45536519608213943, 0.45666847283687695, 0.45797473191682164,
+        0.4592839784374528, 0.46059621752009555, 0.46191145429192515, 0.46322969388596863,
+        0.46455094144111037, 0.46587520210209404, 0.4672024810195266, 0.46853278334988024,
+        0.46986611425549785, 0.4712024789045949, 0.4725418824712635, 0.4738843301354746,
+        0.47522982708308287, 0.47657837850582907, 0.47792998960134403, 0.47928466557315047,
+        0.4806424116306686, 0.4820032329892178, 0.483367134870021, 0.4847341225002062,
+        0.4861042011128125, 0.48747737594679136, 0.48885365224701105, 0.49023303526425865,
+        0.49161553025524524, 0.49300114248260785, 0.49438987721491373, 0.4957817397266621,
+        0.49717673529828965, 0.4985748692161725, 0.49997614677263, 0.5013805732659272,
+        0.5027881540002799, 0.5041988942858563, 0.5056127994387817, 0.5070298747811403,
+        0.5084501256409799, 0.5098735573523151, 0.51130017525513, 0.5127299846953813,
+        0.514162991025003, 0.5155991996019085, 0.5170386157899947, 0.5184812449591442,
+        0.5199270924852302, 0.5213761637501187, 0.522828464141673, 0.5242839990537546,
+        0.5257427738862296, 0.5272047940449701, 0.5286700649418585, 0.5301385919947894,
+        0.531610380627675, 0.5330854362704468, 0.5345637643590602, 0.5360453703354957,
+        0.5375302596477652, 0.5390184377499132, 0.5405099101020212, 0.5420046821702095,
+        0.5435027594266427, 0.5450041473495318, 0.546508851423138, 0.5480168771377746,
+        0.5495282299898127, 0.5510429154816828, 0.5525609391218793, 0.5540823064249619,
+        0.5556070229115617, 0.5571350941083824, 0.5586665255482046, 0.5602013227698883,
+        0.5617394913183774, 0.5632810367447024, 0.5648259646059839, 0.5663742804654351,
+        0.5679259898923666, 0.5694810984621889, 0.5710396117564159, 0.5726015353626676,
+        0.5741668748746747, 0.5757356358922809, 0.5773078240214473, 0.5788834448742537,
+        0.5804625040689043, 0.58204500722973, 0.5836309599871916, 0.5852203679778829,
+        0.5868132368445348, 0.5884095722360184, 0.5900093798073485, 0.5916126652196854,
+        0.5932194341403406, 0.5948296922427788, 0.596443445206622, 0.5980606987176507,
+        0.5996814584678103, 0.6013057301552126, 0.60293351948414, 0.6045648321650469,
+        0.6061996739145659, 0.6078380504555092, 0.6094799675168732, 0.6111254308338395,
+        0.6127744461477813, 0.6144270192062649, 0.6160831557630537, 0.6177428615781103,
+        0.6194061424176017, 0.6210730040539018, 0.6227434522655945, 0.6244174928374764,
+        0.6260951315605623, 0.6277763742320865, 0.6294612266555075, 0.6311496946405092,
+        0.6328417840030071, 0.6345375005651499, 0.6362368501553236, 0.6379398386081531,
+        0.6396464717645081, 0.6413567554715051, 0.6430706955825108, 0.6447882979571447,
+        0.6465095684612843, 0.6482345129670667, 0.6499631373528936, 0.6516954475034318,
+        0.65343144930962, 0.6551711486686702, 0.6569145514840714, 0.658661663665592,
+        0.660412491129285, 0.6621670397974904, 0.6639253155988384, 0.665687324468252,
+        0.6674530723469523, 0.6692225651824605, 0.6709958089286014, 0.6727728095455063,
+        0.6745535729996176, 0.676338105263691, 0.6781264123167998, 0.6799185001443364,
+        0.6817143747380181, 0.6835140420958888, 0.6853175082223235, 0.6871247791280293,
+        0.6889358608300516, 0.6907507593517763, 0.6925694807229329, 0.6943920309795969,
+        0.6962184161641957, 0.6980486423255097, 0.699882715518677, 0.7017206418051949,
+        0.7035624272529257, 0.7054080779360984, 0.7072575999353129, 0.7091109993375414,
+        0.710968282236135, 0.7128294547308242, 0.7146945229277243, 0.7165634929393362,
+        0.7184363708845526, 0.7203131628886595, 0.7221938750833409, 0.7240785136066794,
+        0.7259670846031632, 0.7278595942236871, 0.7297560486255569, 0.7316564539724908,
+        0.7335608164346256, 0.7354691421885183, 0.7373814374171502, 0.7392977083099284,
+        0.7412179610626917, 0.7431422018777127, 0.7450704369637016, 0.7470026725358077,
+        0.7489389148156255, 0.7508791700311964, 0.7528234444170131, 0.7547717442140203,
+        0.7567240756696217, 0.7586804450376814, 0.7606408585785271, 0.7626053225589532,
+        0.7645738432522257, 0.7665464269380842, 0.7685230799027458, 0.7705038084389074,
+        0.7724886188457509, 0.774477517428945, 0.7764705105006496, 0.7784676043795173,
+        0.7804688053906993, 0.7824741198658469, 0.7844835541431162, 0.786497114567169,
+        0.7885148074891791, 0.7905366392668342, 0.7925626162643394, 0.7945927448524196,
+        0.7966270314083247, 0.7986654823158317, 0.8007081039652487, 0.8027549027534167,
+        0.804805885083715, 0.8068610573660637, 0.8089204260169272, 0.8109839974593159,
+        0.8130517781227924, 0.8151237744434728, 0.8171999928640313, 0.8192804398337015,
+        0.821365121808282, 0.8234540452501391, 0.8255472166282097, 0.827644642418004,
+        0.8297463291016105, 0.8318522831676985, 0.8339625111115216, 0.8360770194349197,
+        0.8381958146463249, 0.8403189032607626, 0.8424462917998566, 0.84457798679183,
+        0.8467139947715115, 0.8488543222803369, 0.8509989758663529, 0.8531479620842195,
+        0.8553012874952154, 0.8574589586672398, 0.8596209821748164, 0.8617873645990952,
+        0.8639581125278584, 0.866133232555522, 0.8683127312831401, 0.870496615318406,
+        0.872684891275659, 0.8748775657758853, 0.8770746454467224, 0.8792761369224611,
+        0.8814820468440505, 0.8836923818591008, 0.8859071486218867, 0.8881263537933489,
+        0.8903500040411008, 0.8925781060394292, 0.8948106664692995, 0.8970476920183564,
+        0.8992891893809302, 0.9015351652580385, 0.9037856263573903, 0.9060405793933878,
+        0.9083000310871316, 0.9105639881664236, 0.9128324573657699, 0.9151054454263833,
+        0.9173829590961886, 0.919665005129825, 0.9219515902886494, 0.9242427213407385,
+        0.9265384050608948, 0.928838648230648, 0.9311434576382595, 0.9334528400787231,
+        0.9357668023537724, 0.9380853512718814, 0.9404084936482688, 0.9427362363048997,
+        0.9450685860704917, 0.9474055497805165, 0.9497471342772038, 0.952093346409543,
+        0.9544441930332895, 0.956799681010966, 0.9591598172118667, 0.9615246085120587,
+        0.9638940617943885, 0.9662681839484832, 0.9686469818707549, 0.971030462464402,
+        0.9734186326394156, 0.9758114993125805, 0.9782090694074802, 0.9806113498544976,
+        0.9830183475908217, 0.9854300695604489, 0.987846522714187, 0.9902677140096573,
+        0.9926936504113, 0.9951243388903762, 0.9975597864249721, 1.0,
+    },
+    [Math::DistortionCurve::DIST_CURVE_SHARP_SMOOTH] = {
+        0.0, 0.15428307192027016, 0.1919042389261802, 0.2174146998521333,
+        0.23721958547674488, 0.25361246930949993, 0.26770466768268925, 0.2801268745533665,
+        0.29127451206588423, 0.3014132436395518, 0.31073089585547786, 0.3193655829740233,
+        0.32742208372624376, 0.3349819332740637, 0.3421099328797141, 0.34885851002893037,
+        0.3552707326157236, 0.3613824495640808, 0.3672238467988334, 0.3728206013898501,
+        0.3781947530319128, 0.3833653725678745, 0.38834908210731545, 0.3931604648464812,
+        0.39781239169887783, 0.4023162843438712, 0.4066823290885647, 0.4109196522567636,
+        0.41503646517898074, 0.41904018493816547, 0.4229375356126056, 0.4267346337045803,
+        0.43043706065037013, 0.43404992470396775, 0.43757791402355956, 0.44102534243095953,
+        0.4443961890338585, 0.4476941326801232, 0.450922582038468, 0.4540847019602116,
+        0.45718343666468186, 0.46022153020019835, 0.4632015445588862, 0.46612587576337533,
+        0.4689967681939798, 0.47181632738412743, 0.4745865314779579, 0.47730924151580006,
+        0.4799862106896516, 0.4826190926909671, 0.4852094492563558, 0.4877587570026496,
+        0.4902684136307981, 0.4927397435678124, 0.49517400310723597, 0.4975723851011168,
+        0.4999360232500052, 0.5022659960319344, 0.5045633303065278, 0.5068290046261991,
+        0.5090639522827839, 0.5112690641147726, 0.5134451910975489, 0.5155931467366193,
+        0.5177137092816863, 0.5198076237775551, 0.5218756039662061, 0.5239183340529152,
+        0.5259364703480133, 0.5279306427947296, 0.5299014563925531, 0.5318494925246394,
+        0.5337753101969838, 0.5356794471963648, 0.5375624211734165, 0.5394247306566115,
+        0.5412668560024206, 0.5430892602864489, 0.5448923901399282, 0.5466766765355746,
+        0.5484425355264707, 0.5501903689413338, 0.551920565039245, 0.5536334991266698,
+        0.5553295341393646, 0.5570090211915617, 0.5586723000946342, 0.5603196998472699,
+        0.5619515390990268, 0.5635681265890018, 0.5651697615612108, 0.5667567341581611,
+        0.5683293257939864, 0.5698878095084162, 0.5714324503027575, 0.5729635054589847,
+        0.5744812248429544, 0.5759858511926917, 0.577477620392628, 0.5789567617346117,
+        0.5804234981664554, 0.5818780465287334, 0.5833206177804954, 0.5847514172145173,
+        0.5861706446626724, 0.5875784946919649, 0.5889751567917355, 0.5903608155525163,
+        0.5917356508369811, 0.5930998379434098, 0.5944535477620609, 0.5957969469248217,
+        0.5971301979484801, 0.5984534593719479, 0.5997668858877399, 0.6010706284679962,
+        0.6023648344853232, 0.6036496478287047, 0.6049252090147273, 0.6061916552943469,
+        0.6074491207554097, 0.608697736421132, 0.6099376303447289, 0.6111689277003733,
+        0.6123917508706557, 0.6136062195307063, 0.6148124507291332, 0.616010558965921,
+        0.6172006562674259, 0.6183828522585987, 0.619557254232558, 0.6207239672176313,
+        0.6218830940419726, 0.6230347353958644, 0.624178989891802, 0.6253159541224552,
+        0.6264457227165986, 0.6275683883930939, 0.6286840420130084, 0.6297927726299448,
+        0.6308946675386571, 0.6319898123220223, 0.6330782908964364, 0.6341601855556943,
+        0.6352355770134195, 0.6363045444440972, 0.637367165522768, 0.6384235164634341,
+        0.6394736720562291, 0.6405177057033978, 0.6415556894541328, 0.6425876940383113,
+        0.6436137888991744, 0.6446340422249875, 0.6456485209797214, 0.6466572909327888,
+        0.6476604166878741, 0.6486579617108862, 0.649649988357069, 0.6506365578972984,
+        0.6516177305435968, 0.6525935654738925, 0.6535641208560491, 0.6545294538711939,
+        0.655489620736368, 0.6564446767265213, 0.6573946761958774, 0.6583396725986879,
+        0.6592797185093976, 0.6602148656422427, 0.6611451648702975, 0.6620706662439922,
+        0.6629914190091161, 0.663907471624326, 0.6648188717781747, 0.6657256664056755,
+        0.6666279017044189, 0.6675256231502548, 0.6684188755125549, 0.6693077028690695,
+        0.6701921486203904, 0.6710722555040328, 0.6719480656081493, 0.6728196203848862,
+        0.6736869606633945, 0.6745501266625048, 0.6754091580030791, 0.6762640937200458,
+        0.6771149722741319, 0.6779618315632976, 0.6788047089338853, 0.67964364119149,
+        0.6804786646115601, 0.6813098149497365, 0.6821371274519373, 0.6829606368641972,
+        0.6837803774422668, 0.68459638296098, 0.6854086867233958, 0.6862173215697219,
+        0.687022319886025, 0.6878237136127349, 0.6886215342529481, 0.6894158128805369,
+        0.690206580148068, 0.6909938662945382, 0.6917777011529306, 0.6925581141575976,
+        0.6933351343514736, 0.6941087903931243, 0.6948791105636358, 0.695646122773348,
+        0.6964098545684368, 0.6971703331373496, 0.697927585317096, 0.6986816375994012,
+        0.699432516136722, 0.7001802467481316, 0.7009248549250758, 0.7016663658370031,
+        0.7024048043368745, 0.7031401949665526, 0.7038725619620768, 0.7046019292588247,
+        0.7053283204965642, 0.7060517590243987, 0.7067722679056073, 0.7074898699223849,
+        0.708204587580482, 0.7089164431137479, 0.7096254584885812, 0.7103316554082867,
+        0.7110350553173447, 0.7117356794055912, 0.7124335486123143, 0.7131286836302673,
+        0.7138211049096, 0.7145108326617127, 0.7151978868630305, 0.7158822872587054,
+        0.7165640533662423, 0.7172432044790548, 0.7179197596699507, 0.7185937377945492,
+        0.7192651574946306, 0.7199340372014226, 0.720600395138821, 0.7212642493265498,
+        0.7219256175832598, 0.722584517529568, 0.7232409665910396, 0.7238949820011129,
+        0.7245465808039686, 0.7251957798573464, 0.7258425958353072, 0.7264870452309447,
+        0.727129144359046, 0.7277689093587036, 0.7284063561958788, 0.7290415006659168,
+        0.7296743583960181, 0.7303049448476628, 0.7309332753189921, 0.7315593649471449,
+        0.7321832287105547, 0.7328048814312036, 0.7334243377768359, 0.7340416122631328,
+        0.7346567192558484, 0.7352696729729076, 0.7358804874864671, 0.73648917672494,
+        0.7370957544749857, 0.7377002343834637, 0.7383026299593548, 0.7389029545756485,
+        0.7395012214711975, 0.7400974437525406, 0.7406916343956945, 0.7412838062479151,
+        0.7418739720294281, 0.7424621443351311, 0.7430483356362666, 0.7436325582820669,
+        0.7442148245013711, 0.744795146404216, 0.7453735359833987, 0.745950005116016,
+        0.7465245655649753, 0.7470972289804827, 0.7476680069015065, 0.7482369107572151,
+        0.7488039518683938, 0.749369141448836, 0.7499324906067152, 0.7504940103459308,
+        0.7510537115674356, 0.7516116050705404, 0.7521677015541979, 0.7527220116182666,
+        0.753274545764754, 0.7538253143990413, 0.7543743278310866, 0.7549215962766118,
+        0.7554671298582691, 0.7560109386067898, 0.7565530324621154, 0.7570934212745107,
+        0.7576321148056608, 0.7581691227297496, 0.7587044546345221, 0.7592381200223323,
+        0.7597701283111722, 0.7603004888356873, 0.760829210848176, 0.7613563035195734,
+        0.7618817759404211, 0.7624056371218217, 0.76292789599638, 0.7634485614191288,
+        0.7639676421684418, 0.7644851469469331, 0.7650010843823428, 0.7655154630284096,
+        0.7660282913657311, 0.7665395778026113, 0.7670493306758949, 0.7675575582517908,
+        0.7680642687266828, 0.7685694702279285, 0.7690731708146471, 0.7695753784784956,
+        0.7700761011444337, 0.7705753466714786, 0.771073122853448, 0.7715694374196922,
+        0.7720642980358183, 0.7725577123044008, 0.773049687765685, 0.7735402318982779,
+        0.7740293521198329, 0.7745170557877208, 0.7750033501996949, 0.775488242594545,
+        0.7759717401527428, 0.7764538499970789, 0.7769345791932896, 0.7774139347506772,
+        0.77789192362272, 0.7783685527076746, 0.7788438288491702, 0.7793177588367952,
+        0.7797903494066742, 0.7802616072420393, 0.7807315389737922, 0.78120015118106,
+        0.7816674503917419, 0.7821334430830506, 0.7825981356820445, 0.783061534566155,
+        0.7835236460637043, 0.7839844764544187, 0.7844440319699341, 0.7849023187942938,
+        0.7853593430644427, 0.7858151108707117, 0.7862696282572982, 0.7867229012227392,
+        0.7871749357203786, 0.7876257376588286, 0.7880753129024248, 0.788523667271676,
+        0.7889708065437073, 0.789416736452699, 0.7898614626903182, 0.7903049909061464,
+        0.7907473267081007, 0.7911884756628501, 0.7916284432962267, 0.7920672350936314,
+        0.7925048565004345, 0.7929413129223712, 0.7933766097259332, 0.7938107522387539,
+        0.7942437457499896, 0.7946755955106963, 0.7951063067342011, 0.7955358845964697,
+        0.7959643342364688, 0.7963916607565245, 0.796817869222676, 0.7972429646650255,
+        0.7976669520780834, 0.7980898364211088, 0.7985116226184475, 0.7989323155598644,
+        0.7993519201008725, 0.7997704410630576, 0.8001878832343998, 0.8006042513695907,
+        0.8010195501903465, 0.8014337843857184, 0.8018469586123982, 0.8022590774950206,
+        0.8026701456264624, 0.8030801675681382, 0.8034891478502917, 0.8038970909722843,
+        0.8043040014028809, 0.8047098835805303, 0.8051147419136455, 0.8055185807808773,
+        0.8059214045313879, 0.8063232174851188, 0.8067240239330571, 0.8071238281374982,
+        0.8075226343323061, 0.8079204467231694, 0.808317269487856, 0.8087131067764637,
+        0.8091079627116684, 0.8095018413889696, 0.8098947468769332, 0.8102866832174309,
+        0.8106776544258777, 0.8110676644914664, 0.8114567173773993, 0.8118448170211178,
+        0.8122319673345288, 0.8126181722042295, 0.8130034354917284, 0.8133877610336653,
+        0.8137711526420275, 0.8141536141043648, 0.8145351491840018, 0.814915761620247,
+        0.815295455128601, 0.8156742334009612, 0.8160521001058253, 0.8164290588884922,
+        0.8168051133712596, 0.8171802671536224, 0.8175545238124649, 0.8179278869022545,
+        0.818300359955232, 0.818671946481599, 0.8190426499697043, 0.8194124738862286,
+        0.8197814216763661, 0.8201494967640054, 0.8205167025519071, 0.8208830424218811,
+        0.821248519734961, 0.8216131378315766, 0.8219769000317252, 0.8223398096351408,
+        0.8227018699214612, 0.8230630841503944, 0.8234234555618818, 0.8237829873762609,
+        0.8241416827944258, 0.8244995449979857, 0.8248565771494233, 0.825212782392249,
+        0.8255681638511562, 0.825922724632173, 0.8262764678228135, 0.8266293964922272,
+        0.8269815136913466, 0.8273328224530339, 0.8276833257922255, 0.8280330267060756,
+        0.8283819281740986, 0.8287300331583087, 0.8290773446033596, 0.8294238654366827,
+        0.8297695985686221, 0.8301145468925712, 0.8304587132851048, 0.8308021006061127,
+        0.8311447116989298, 0.8314865493904663, 0.8318276164913357, 0.8321679157959827,
+        0.8325074500828081, 0.832846222114294, 0.8331842346371275, 0.8335214903823224,
+        0.8338579920653402, 0.8341937423862107, 0.8345287440296498, 0.8348629996651776,
+        0.8351965119472347, 0.835529283515297, 0.8358613169939909, 0.8361926149932049,
+        0.836523180108203, 0.8368530149197352, 0.8371821219941462, 0.8375105038834859,
+        0.8378381631256162, 0.8381651022443178, 0.838491323749396, 0.8388168301367857,
+        0.8391416238886542, 0.8394657074735056, 0.8397890833462807, 0.840111753948459,
+        0.8404337217081584, 0.8407549890402338, 0.8410755583463754, 0.8413954320152057,
+        0.8417146124223756, 0.8420331019306602, 0.8423509028900521, 0.8426680176378567,
+        0.8429844484987827, 0.8433001977850362, 0.8436152677964095, 0.8439296608203731,
+        0.8442433791321639, 0.844556424994874, 0.8448688006595385, 0.8451805083652221,
+        0.8454915503391057, 0.8458019287965716, 0.846111645941287, 0.8464207039652896,
+        0.8467291050490693, 0.8470368513616509, 0.8473439450606755, 0.8476503882924814,
+        0.8479561831921847, 0.8482613318837575, 0.8485658364801076, 0.848869699083156,
+        0.849172921783914, 0.8494755066625604, 0.8497774557885168, 0.8500787712205232,
+        0.8503794550067122, 0.8506795091846832, 0.8509789357815757, 0.8512777368141415,
+        0.8515759142888173, 0.8518734702017955, 0.8521704065390951, 0.8524667252766321,
+        0.8527624283802886, 0.8530575178059817, 0.8533519954997321, 0.8536458633977316,
+        0.8539391234264104, 0.8542317775025032, 0.8545238275331157, 0.8548152754157899,
+        0.8551061230385685, 0.8553963722800598, 0.8556860250095011, 0.8559750830868218,
+        0.8562635483627064, 0.8565514226786562, 0.8568387078670514, 0.857125405751212,
+        0.8574115181454578, 0.8576970468551692, 0.8579819936768467, 0.8582663603981692,
+        0.8585501487980534, 0.8588333606467113, 0.8591159977057083, 0.8593980617280198,
+        0.8596795544580877, 0.8599604776318774, 0.8602408329769324, 0.8605206222124302,
+        0.860799847049237, 0.8610785091899619, 0.8613566103290103, 0.8616341521526382,
+        0.8619111363390047, 0.8621875645582245, 0.86246343847242, 0.8627387597357732,
+        0.8630135299945767, 0.8632877508872847, 0.8635614240445636, 0.8638345510893416,
+        0.8641071336368586, 0.8643791732947154, 0.8646506716629224, 0.8649216303339482,
+        0.8651920508927673, 0.8654619349169084, 0.8657312839765006, 0.8660000996343216,
+        0.866268383445843, 0.8665361369592772, 0.866803361715623, 0.8670700592487108,
+        0.8673362310852478, 0.8676018787448627, 0.8678670037401501, 0.8681316075767143,
+        0.868395691753213, 0.8686592577614004, 0.868922307086171, 0.8691848412056011,
+        0.8694468615909917, 0.8697083697069102, 0.8699693670112322, 0.8702298549551828,
+        0.8704898349833773, 0.8707493085338623, 0.8710082770381559, 0.8712667419212872,
+        0.8715247046018366, 0.8717821664919754, 0.872039128997504, 0.8722955935178917,
+        0.8725515614463145, 0.8728070341696939, 0.8730620130687338, 0.8733164995179598,
+        0.8735704948857548, 0.8738240005343972, 0.8740770178200973, 0.8743295480930332,
+        0.8745815926973886, 0.8748331529713868, 0.8750842302473278, 0.8753348258516233,
+        0.8755849411048313, 0.8758345773216919, 0.8760837358111611, 0.8763324178764453,
+        0.8765806248150362, 0.8768283579187431, 0.8770756184737282, 0.8773224077605386,
+        0.8775687270541399, 0.8778145776239493, 0.8780599607338675, 0.8783048776423117,
+        0.8785493296022474, 0.8787933178612203, 0.8790368436613879, 0.8792799082395513,
+        0.8795225128271854, 0.8797646586504712, 0.8800063469303254, 0.8802475788824313,
+        0.8804883557172692, 0.8807286786401461, 0.8809685488512261, 0.8812079675455592,
+        0.8814469359131114, 0.8816854551387937, 0.8819235264024906, 0.8821611508790899,
+        0.88239832973851, 0.8826350641457291, 0.8828713552608132, 0.8831072042389437,
+        0.8833426122304456, 0.8835775803808148, 0.8838121098307452, 0.8840462017161566,
+        0.8842798571682206, 0.8845130773133882, 0.8847458632734163, 0.8849782161653936,
+        0.8852101371017672, 0.8854416271903683, 0.8856726875344386, 0.8859033192326552,
+        0.8861335233791565, 0.8863633010635674, 0.8865926533710246, 0.886821581382201,
+        0.8870500861733311, 0.8872781688162351, 0.8875058303783435, 0.8877330719227213,
+        0.8879598945080924, 0.8881862991888625, 0.8884122870151439, 0.8886378590327791,
+        0.888863016283363, 0.8890877598042676, 0.8893120906286641, 0.8895360097855463,
+        0.889759518299753, 0.889982617191991, 0.8902053074788574, 0.8904275901728619,
+        0.8906494662824488, 0.8908709368120191, 0.8910920027619527, 0.8913126651286294,
+        0.8915329249044508, 0.8917527830778621, 0.8919722406333727, 0.8921912985515776,
+        0.8924099578091784, 0.8926282193790042, 0.892846084230032, 0.8930635533274073,
+        0.893280627632465, 0.8934973081027491, 0.8937135956920331, 0.8939294913503397,
+        0.8941449960239611, 0.8943601106554787, 0.8945748361837822, 0.8947891735440896,
+        0.8950031236679664, 0.8952166874833445, 0.8954298659145418, 0.8956426598822808,
+        0.8958550703037075, 0.8960670980924104, 0.8962787441584382, 0.8964900094083197,
+        0.8967008947450807, 0.8969114010682634, 0.8971215292739432, 0.8973312802547482,
+        0.8975406548998757, 0.8977496540951108, 0.8979582787228437, 0.8981665296620875,
+        0.898374407788495, 0.8985819139743768, 0.8987890490887175, 0.8989958139971937,
+        0.8992022095621905, 0.8994082366428185, 0.89961389609493, 0.8998191887711368,
+        0.900024115520825, 0.9002286771901732, 0.9004328746221677, 0.900636708656619,
+        0.9008401801301781, 0.901043289876352, 0.9012460387255198, 0.9014484275049492,
+        0.901650457038811, 0.9018521281481954, 0.9020534416511272, 0.9022543983625818,
+        0.9024549990944998, 0.9026552446558022, 0.902855135852406, 0.9030546734872389,
+        0.9032538583602543, 0.9034526912684462, 0.9036511730058633, 0.9038493043636248,
+        0.9040470861299337, 0.9042445190900923, 0.9044416040265157, 0.9046383417187469,
+        0.9048347329434699, 0.9050307784745251, 0.9052264790829222, 0.9054218355368546,
+        0.9056168486017133, 0.9058115190401005, 0.9060058476118432, 0.9061998350740069,
+        0.9063934821809091, 0.9065867896841326, 0.9067797583325388, 0.906972388872281,
+        0.9071646820468179, 0.907356638596926, 0.9075482592607131, 0.9077395447736312,
+        0.907930495868489, 0.9081211132754649, 0.9083113977221198, 0.9085013499334097,
+        0.9086909706316978, 0.9088802605367674, 0.9090692203658342, 0.9092578508335586,
+        0.9094461526520575, 0.9096341265309175, 0.9098217731772057, 0.9100090932954825,
+        0.9101960875878136, 0.9103827567537813, 0.910569101490497, 0.9107551224926119,
+        0.9109408204523302, 0.9111261960594189, 0.9113112500012207, 0.9114959829626649,
+        0.9116803956262786, 0.9118644886721984, 0.9120482627781815, 0.9122317186196167,
+        0.9124148568695357, 0.9125976781986241, 0.9127801832752325, 0.9129623727653869,
+        0.9131442473328004, 0.9133258076388832, 0.9135070543427537, 0.9136879881012491,
+        0.913868609568936, 0.914048919398121, 0.9142289182388609, 0.9144086067389732,
+        0.9145879855440471, 0.9147670552974526, 0.9149458166403517, 0.9151242702117082,
+        0.9153024166482977, 0.9154802565847179, 0.9156577906533984, 0.9158350194846109,
+        0.9160119437064784, 0.9161885639449863, 0.9163648808239907, 0.9165408949652288,
+        0.9167166069883292, 0.91689201751082, 0.9170671271481394, 0.9172419365136455,
+        0.9174164462186243, 0.9175906568723006, 0.9177645690818463, 0.9179381834523904,
+        0.9181115005870275, 0.9182845210868275, 0.9184572455508445, 0.9186296745761259,
+        0.9188018087577214, 0.9189736486886921, 0.919145194960119, 0.9193164481611124,
+        0.91948740887882, 0.9196580776984364, 0.9198284552032118, 0.9199985419744596,
+        0.9201683385915665, 0.9203378456319996, 0.9205070636713164, 0.9206759932831717,
+        0.9208446350393276, 0.9210129895096604, 0.9211810572621698, 0.9213488388629875,
+        0.921516334876384, 0.9216835458647785, 0.9218504723887456, 0.9220171150070248,
+        0.9221834742765269, 0.9223495507523434, 0.922515344987754, 0.922680857534234,
+        0.9228460889414632, 0.9230110397573328, 0.9231757105279537, 0.9233401017976637,
+        0.9235042141090363, 0.9236680480028869, 0.9238316040182819, 0.9239948826925448,
+        0.924157884561265, 0.9243206101583045, 0.9244830600158056, 0.9246452346641987,
+        0.9248071346322086, 0.9249687604468632, 0.9251301126334998, 0.9252911917157725,
+        0.9254519982156598, 0.9256125326534717, 0.9257727955478561, 0.925932787415807,
+        0.9260925087726708, 0.9262519601321538, 0.9264111420063285, 0.9265700549056411,
+        0.9267286993389184, 0.9268870758133746, 0.9270451848346178, 0.9272030269066573,
+        0.9273606025319098, 0.9275179122112068, 0.9276749564438009, 0.9278317357273721,
+        0.9279882505580352, 0.9281445014303458, 0.928300488837307, 0.928456213270376,
+        0.9286116752194702, 0.9287668751729747, 0.9289218136177472, 0.9290764910391252,
+        0.9292309079209324, 0.9293850647454854, 0.9295389619935984, 0.9296926001445914,
+        0.9298459796762949, 0.9299991010650569, 0.9301519647857487, 0.9303045713117712,
+        0.9304569211150611, 0.9306090146660962, 0.9307608524339024, 0.930912434886059,
+        0.9310637624887051, 0.9312148357065452, 0.931365655002855, 0.9315162208394877,
+        0.9316665336768796, 0.9318165939740557, 0.9319664021886357, 0.9321159587768397,
+        0.9322652641934941, 0.9324143188920369, 0.9325631233245233, 0.932711677941632,
+        0.93285998319267, 0.9330080395255788, 0.9331558473869392, 0.9333034072219778,
+        0.9334507194745715, 0.9335977845872534, 0.9337446030012185, 0.9338911751563286,
+        0.9340375014911176, 0.9341835824427978, 0.9343294184472637, 0.9344750099390986,
+        0.9346203573515792, 0.9347654611166811, 0.9349103216650838, 0.9350549394261759,
+        0.9351993148280604, 0.9353434482975598, 0.9354873402602211, 0.9356309911403209,
+        0.9357744013608705, 0.9359175713436212, 0.9360605015090684, 0.9362031922764575,
+        0.9363456440637888, 0.9364878572878216, 0.9366298323640799, 0.9367715697068573,
+        0.9369130697292212, 0.937054332843018, 0.9371953594588781, 0.9373361499862204,
+        0.9374767048332571, 0.9376170244069985, 0.9377571091132577, 0.9378969593566553,
+        0.9380365755406237, 0.9381759580674126, 0.9383151073380926, 0.9384540237525606,
+        0.9385927077095437, 0.9387311596066044, 0.9388693798401444, 0.9390073688054101,
+        0.939145126896496, 0.9392826545063496, 0.9394199520267764, 0.9395570198484433,
+        0.9396938583608837, 0.9398304679525016, 0.939966849010576, 0.9401030019212654,
+        0.9402389270696117, 0.9403746248395449, 0.9405100956138872, 0.9406453397743569,
+        0.9407803577015736, 0.9409151497750614, 0.9410497163732534, 0.9411840578734959,
+        0.9413181746520529, 0.9414520670841096, 0.9415857355437767, 0.9417191804040949,
+        0.9418524020370383, 0.9419854008135191, 0.9421181771033912, 0.942250731275454,
+        0.9423830636974573, 0.9425151747361039, 0.9426470647570552, 0.9427787341249335,
+        0.942910183203327, 0.9430414123547932, 0.9431724219408633, 0.9433032123220451,
+        0.9434337838578277, 0.9435641369066852, 0.94369427182608, 0.9438241889724671,
+        0.9439538887012976, 0.9440833713670227, 0.9442126373230968, 0.9443416869219823,
+        0.9444705205151521, 0.9445991384530943, 0.9447275410853149, 0.9448557287603423,
+        0.9449837018257304, 0.9451114606280624, 0.9452390055129543, 0.9453663368250588,
+        0.945493454908068, 0.9456203601047182, 0.9457470527567923, 0.9458735332051238,
+        0.9459998017896006, 0.9461258588491676, 0.9462517047218311, 0.9463773397446614,
+        0.9465027642537972, 0.9466279785844481, 0.9467529830708984, 0.9468777780465102,
+        0.9470023638437275, 0.9471267407940787, 0.9472509092281806, 0.9473748694757406,
+        0.9474986218655617, 0.9476221667255444, 0.9477455043826907, 0.9478686351631069,
+        0.947991559392007, 0.9481142773937162, 0.9482367894916737, 0.948359096008436,
+        0.9484811972656807, 0.9486030935842084, 0.9487247852839469, 0.9488462726839542,
+        0.9489675561024213, 0.9490886358566752, 0.9492095122631827, 0.9493301856375529,
+        0.9494506562945401, 0.9495709245480474, 0.9496909907111294, 0.9498108550959956,
+        0.9499305180140127, 0.9500499797757085, 0.950169240690774, 0.9502883010680668,
+        0.9504071612156144, 0.9505258214406167, 0.9506442820494486, 0.9507625433476639,
+        0.9508806056399972, 0.9509984692303675, 0.9511161344218809, 0.9512336015168332,
+        0.9513508708167129, 0.9514679426222041, 0.9515848172331897, 0.9517014949487531,
+        0.9518179760671824, 0.9519342608859721, 0.9520503497018266, 0.9521662428106623,
+        0.9522819405076111, 0.9523974430870225, 0.9525127508424667, 0.952627864066737,
+        0.9527427830518531, 0.9528575080890631, 0.9529720394688467, 0.9530863774809172,
+        0.9532005224142253, 0.9533144745569603, 0.9534282341965541, 0.9535418016196828,
+        0.9536551771122701, 0.9537683609594894, 0.9538813534457662, 0.9539941548547812,
+        0.9541067654694729, 0.9542191855720397, 0.9543314154439424, 0.9544434553659074,
+        0.9545553056179285, 0.95466696647927, 0.9547784382284685, 0.9548897211433363,
+        0.9550008155009629, 0.9551117215777185, 0.9552224396492552, 0.9553329699905109,
+        0.9554433128757103, 0.9555534685783683, 0.9556634373712924, 0.9557732195265844,
+        0.9558828153156433, 0.9559922250091677, 0.9561014488771581, 0.956210487188919,
+        0.9563193402130618, 0.9564280082175065, 0.9565364914694848, 0.9566447902355415,
+        0.9567529047815375, 0.9568608353726519, 0.9569685822733844, 0.9570761457475572,
+        0.9571835260583176, 0.9572907234681404, 0.9573977382388299, 0.957504570631522,
+        0.9576112209066867, 0.9577176893241305, 0.957823976142998, 0.9579300816217748,
+        0.9580360060182892, 0.9581417495897147, 0.9582473125925717, 0.9583526952827305,
+        0.9584578979154124, 0.958562920745193, 0.9586677640260034, 0.9587724280111327,
+        0.9588769129532303, 0.9589812191043076, 0.9590853467157403, 0.9591892960382711,
+        0.9592930673220103, 0.9593966608164395, 0.9595000767704127, 0.9596033154321588,
+        0.9597063770492831, 0.9598092618687701, 0.959911970136985, 0.960014502099676,
+        0.960116858001976, 0.960219038088405, 0.9603210426028717, 0.9604228717886759,
+        0.9605245258885103, 0.9606260051444626, 0.9607273097980169, 0.9608284400900565,
+        0.9609293962608652, 0.9610301785501297, 0.9611307871969413, 0.9612312224397979,
+        0.9613314845166057, 0.9614315736646812, 0.9615314901207539, 0.9616312341209667,
+        0.9617308059008789, 0.961830205695468, 0.9619294337391308, 0.9620284902656863,
+        0.9621273755083769, 0.9622260896998706, 0.962324633072262, 0.9624230058570757,
+        0.9625212082852668, 0.9626192405872229, 0.9627171029927667, 0.9628147957311568,
+        0.9629123190310902, 0.9630096731207037, 0.9631068582275762, 0.9632038745787297,
+        0.9633007224006316, 0.9633974019191965, 0.9634939133597876, 0.9635902569472189,
+        0.9636864329057564, 0.9637824414591203, 0.9638782828304866, 0.9639739572424887,
+        0.964069464917219, 0.9641648060762312, 0.9642599809405413, 0.9643549897306297,
+        0.9644498326664426, 0.964544509967394, 0.9646390218523673, 0.9647333685397167,
+        0.9648275502472691, 0.9649215671923258, 0.9650154195916639, 0.9651091076615383,
+        0.9652026316176827, 0.9652959916753122, 0.9653891880491239, 0.9654822209532989,
+        0.9655750906015047, 0.9656677972068953, 0.9657603409821139, 0.9658527221392942,
+        0.9659449408900618, 0.966036997445536, 0.9661288920163312, 0.9662206248125589,
+        0.9663121960438282, 0.9664036059192489, 0.9664948546474315, 0.9665859424364898,
+        0.9666768694940419, 0.966767636027212, 0.9668582422426321, 0.9669486883464424,
+        0.9670389745442945, 0.9671291010413517, 0.9672190680422907, 0.9673088757513034,
+        0.9673985243720981, 0.9674880141079012, 0.9675773451614584, 0.9676665177350366,
+        0.967755532030425, 0.9678443882489363, 0.9679330865914089, 0.9680216272582078,
+        0.9681100104492262, 0.9681982363638868, 0.9682863052011436, 0.9683742171594827,
+        0.9684619724369244, 0.968549571231024, 0.9686370137388739, 0.9687243001571042,
+        0.9688114306818847, 0.9688984055089258, 0.9689852248334806, 0.9690718888503456,
+        0.9691583977538621, 0.9692447517379182, 0.9693309509959497, 0.9694169957209411,
+        0.9695028861054277, 0.9695886223414963, 0.9696742046207876, 0.9697596331344958,
+        0.9698449080733714, 0.9699300296277221, 0.970014997987414, 0.9700998133418727,
+        0.9701844758800853, 0.9702689857906011, 0.970353343261533, 0.9704375484805592,
+        0.9705216016349237, 0.9706055029114387, 0.9706892524964847, 0.9707728505760127,
+        0.9708562973355447, 0.9709395929601758, 0.9710227376345749, 0.971105731542986,
+        0.9711885748692294, 0.9712712677967034, 0.9713538105083852, 0.971436203186832,
+        0.9715184460141825, 0.971600539172158, 0.9716824828420638, 0.97176427720479,
+        0.9718459224408134, 0.9719274187301978, 0.9720087662525962, 0.9720899651872512,
+        0.9721710157129969, 0.972251918008259, 0.9723326722510576, 0.9724132786190066,
+        0.9724937372893163, 0.9725740484387941, 0.9726542122438453, 0.9727342288804747,
+        0.9728140985242876, 0.972893821350491, 0.9729733975338948, 0.973052827248913,
+        0.9731321106695643, 0.9732112479694743, 0.9732902393218756, 0.9733690848996095,
+        0.9734477848751268, 0.9735263394204895, 0.973604748707371, 0.9736830129070582,
+        0.9737611321904519, 0.9738391067280682, 0.9739169366900394, 0.9739946222461159,
+        0.9740721635656658, 0.9741495608176773, 0.9742268141707595, 0.9743039237931428,
+        0.9743808898526811, 0.9744577125168516, 0.9745343919527573, 0.9746109283271266,
+        0.9746873218063156, 0.9747635725563084, 0.9748396807427183, 0.9749156465307891,
+        0.9749914700853961, 0.9750671515710467, 0.9751426911518822, 0.975218088991678,
+        0.975293345253845, 0.9753684601014313, 0.975443433697122, 0.9755182662032411,
+        0.9755929577817521, 0.9756675085942592, 0.9757419188020083, 0.9758161885658878,
+        0.9758903180464301, 0.9759643074038121, 0.9760381567978561, 0.9761118663880316,
+        0.9761854363334554, 0.976258866792893, 0.9763321579247595, 0.9764053098871206,
+        0.9764783228376936, 0.9765511969338485, 0.9766239323326085, 0.9766965291906514,
+        0.9767689876643106, 0.9768413079095757, 0.9769134900820936, 0.9769855343371697,
+        0.9770574408297688, 0.977129209714515, 0.9772008411456947, 0.9772723352772558,
+        0.9773436922628089, 0.9774149122556293, 0.9774859954086563, 0.9775569418744958,
+        0.9776277518054196, 0.9776984253533679, 0.9777689626699488, 0.9778393639064403,
+        0.9779096292137904, 0.9779797587426186, 0.9780497526432164, 0.9781196110655485,
+        0.9781893341592534, 0.9782589220736445, 0.978328374957711, 0.9783976929601186,
+        0.9784668762292107, 0.9785359249130088, 0.9786048391592138, 0.9786736191152067,
+        0.9787422649280496, 0.9788107767444862, 0.9788791547109433, 0.978947398973531,
+        0.9790155096780438, 0.9790834869699618, 0.979151330994451, 0.9792190418963644,
+        0.979286619820243, 0.9793540649103165, 0.9794213773105038, 0.9794885571644145,
+        0.9795556046153495, 0.9796225198063012, 0.9796893028799555, 0.9797559539786914,
+        0.9798224732445827, 0.9798888608193986, 0.9799551168446043, 0.9800212414613622,
+        0.9800872348105318, 0.9801530970326722, 0.980218828268041, 0.9802844286565963,
+        0.9803498983379972, 0.9804152374516046, 0.9804804461364821, 0.9805455245313963,
+        0.9806104727748183, 0.9806752910049239, 0.9807399793595949, 0.9808045379764193,
+        0.9808689669926927, 0.9809332665454183, 0.9809974367713087, 0.9810614778067858,
+        0.9811253897879817, 0.9811891728507401, 0.9812528271306163, 0.9813163527628782,
+        0.9813797498825071, 0.9814430186241988, 0.9815061591223637, 0.981569171511128,
+        0.9816320559243342, 0.9816948124955422, 0.9817574413580297, 0.9818199426447928,
+        0.9818823164885473, 0.9819445630217288, 0.9820066823764944, 0.9820686746847219,
+        0.9821305400780119, 0.982192278687688, 0.9822538906447976, 0.9823153760801123,
+        0.9823767351241292, 0.9824379679070709, 0.9824990745588871, 0.9825600552092544,
+        0.9826209099875777, 0.9826816390229905, 0.9827422424443558, 0.9828027203802667,
+        0.9828630729590473, 0.9829233003087526, 0.9829834025571709, 0.9830433798318223,
+        0.9831032322599613, 0.9831629599685763, 0.9832225630843909, 0.983282041733864,
+        0.9833413960431912, 0.9834006261383049, 0.9834597321448753, 0.9835187141883109,
+        0.9835775723937592, 0.9836363068861074, 0.9836949177899833, 0.9837534052297553,
+        0.9838117693295336, 0.9838700102131712, 0.9839281280042637, 0.98398612282615,
+        0.9840439948019141, 0.9841017440543846, 0.9841593707061354, 0.9842168748794872,
+        0.9842742566965071, 0.9843315162790103, 0.9843886537485597, 0.9844456692264671,
+        0.9845025628337941, 0.9845593346913518, 0.9846159849197026, 0.98467251363916,
+        0.9847289209697893, 0.9847852070314086, 0.9848413719435894, 0.9848974158256567,
+        0.98495333879669, 0.9850091409755242, 0.9850648224807494, 0.9851203834307126,
+        0.9851758239435174, 0.9852311441370247, 0.985286344128854, 0.9853414240363831,
+        0.9853963839767497, 0.9854512240668508, 0.9855059444233444, 0.9855605451626495,
+        0.9856150264009467, 0.9856693882541792, 0.9857236308380529, 0.9857777542680374,
+        0.9858317586593661, 0.9858856441270375, 0.9859394107858149, 0.9859930587502279,
+        0.9860465881345724, 0.9860999990529108, 0.9861532916190738, 0.9862064659466601,
+        0.9862595221490366, 0.9863124603393403, 0.9863652806304772, 0.9864179831351246,
+        0.9864705679657303, 0.9865230352345137, 0.9865753850534663, 0.9866276175343525,
+        0.9866797327887097, 0.9867317309278493, 0.9867836120628568, 0.9868353763045931,
+        0.9868870237636937, 0.9869385545505712, 0.9869899687754137, 0.987041266548187,
+        0.9870924479786346, 0.9871435131762777, 0.9871944622504167, 0.9872452953101309,
+        0.9872960124642798, 0.9873466138215029, 0.9873970994902206, 0.9874474695786347,
+        0.9874977241947293, 0.9875478634462701, 0.9875978874408069, 0.987647796285672,
+        0.9876975900879824, 0.9877472689546393, 0.987796832992329, 0.9878462823075236,
+        0.9878956170064812, 0.9879448371952463, 0.9879939429796508, 0.9880429344653142,
+        0.9880918117576443, 0.9881405749618369, 0.9881892241828778, 0.9882377595255422,
+        0.988286181094395, 0.9883344889937926, 0.9883826833278819, 0.9884307642006019,
+        0.9884787317156835, 0.9885265859766504, 0.9885743270868197, 0.9886219551493015,
+        0.9886694702670007, 0.9887168725426166, 0.9887641620786436, 0.9888113389773717,
+        0.9888584033408871, 0.9889053552710726, 0.9889521948696077, 0.9889989222379701,
+        0.9890455374774351, 0.9890920406890762, 0.9891384319737665, 0.9891847114321782,
+        0.9892308791647838, 0.9892769352718553, 0.9893228798534668, 0.9893687130094927,
+        0.9894144348396098, 0.9894600454432967, 0.9895055449198351, 0.98955093336831,
+        0.9895962108876096, 0.9896413775764266, 0.9896864335332579, 0.9897313788564058,
+        0.989776213643978, 0.9898209379938879, 0.9898655520038557, 0.9899100557714079,
+        0.9899544493938788, 0.9899987329684101, 0.990042906591952, 0.9900869703612631,
+        0.9901309243729111, 0.9901747687232731, 0.9902185035085366, 0.9902621288246991,
+        0.990305644767569, 0.9903490514327661, 0.9903923489157218, 0.9904355373116798,
+        0.9904786167156963, 0.9905215872226403, 0.9905644489271948, 0.9906072019238559,
+        0.9906498463069348, 0.9906923821705569, 0.9907348096086629, 0.9907771287150092,
+        0.990819339583168, 0.9908614423065282, 0.9909034369782953, 0.990945323691492,
+        0.9909871025389589, 0.991028773613355, 0.9910703370071569, 0.9911117928126608,
+        0.9911531411219825, 0.9911943820270567, 0.991235515619639, 0.9912765419913052,
+        0.9913174612334523, 0.9913582734372985, 0.9913989786938838, 0.9914395770940707,
+        0.9914800687285439, 0.9915204536878113, 0.9915607320622042, 0.9916009039418776,
+        0.9916409694168108, 0.9916809285768078, 0.9917207815114973, 0.9917605283103338,
+        0.9918001690625969, 0.9918397038573932, 0.9918791327836552, 0.9919184559301428,
+        0.991957673385443, 0.9919967852379707, 0.9920357915759686, 0.9920746924875081,
+        0.9921134880604896, 0.9921521783826427, 0.9921907635415264, 0.99222924362453,
+        0.9922676187188733, 0.9923058889116064, 0.9923440542896113, 0.9923821149396007,
+        0.9924200709481199, 0.9924579224015462, 0.9924956693860894, 0.9925333119877926,
+        0.9925708502925322, 0.9926082843860186, 0.9926456143537957, 0.9926828402812427,
+        0.992719962253573, 0.9927569803558357, 0.9927938946729153, 0.9928307052895323,
+        0.9928674122902436, 0.9929040157594425, 0.9929405157813597, 0.992976912440063,
+        0.9930132058194582, 0.9930493960032891, 0.9930854830751381, 0.9931214671184262,
+        0.9931573482164137, 0.9931931264522004, 0.9932288019087261, 0.9932643746687706,
+        0.9932998448149545, 0.9933352124297393, 0.9933704775954275, 0.9934056403941638,
+        0.9934407009079342, 0.9934756592185674, 0.9935105154077347, 0.9935452695569503,
+        0.9935799217475719, 0.9936144720608007, 0.9936489205776818, 0.9936832673791052,
+        0.9937175125458049, 0.9937516561583604, 0.9937856982971963, 0.9938196390425831,
+        0.9938534784746371, 0.9938872166733211, 0.9939208537184447, 0.9939543896896644,
+        0.9939878246664837, 0.9940211587282544, 0.9940543919541758, 0.994087524423296,
+        0.994120556214511, 0.9941534874065667, 0.9941863180780578, 0.9942190483074286,
+        0.9942516781729733, 0.9942842077528367, 0.9943166371250137, 0.9943489663673507,
+        0.9943811955575448, 0.9944133247731448, 0.9944453540915515, 0.9944772835900177,
+        0.9945091133456487, 0.9945408434354027, 0.9945724739360909, 0.994604004924378,
+        0.9946354364767821, 0.9946667686696758, 0.9946980015792861, 0.994729135281694,
+        0.9947601698528363, 0.9947911053685043, 0.9948219419043453, 0.9948526795358624,
+        0.9948833183384148, 0.9949138583872185, 0.9949442997573458, 0.9949746425237262,
+        0.995004886761147, 0.9950350325442527, 0.995065079947546, 0.9950950290453878,
+        0.9951248799119977, 0.995154632621454, 0.9951842872476943, 0.9952138438645154,
+        0.9952433025455742, 0.9952726633643876, 0.9953019263943326, 0.9953310917086468,
+        0.995360159380429, 0.9953891294826392, 0.9954180020880986, 0.9954467772694904,
+        0.9954754550993595, 0.9955040356501139, 0.9955325189940236, 0.9955609052032216,
+        0.9955891943497042, 0.9956173865053312, 0.9956454817418262, 0.9956734801307767,
+        0.9957013817436348, 0.9957291866517167, 0.9957568949262041, 0.9957845066381434,
+        0.9958120218584466, 0.9958394406578914, 0.9958667631071215, 0.995893989276647,
+        0.995921119236844, 0.9959481530579561, 0.9959750908100937, 0.9960019325632344,
+        0.9960286783872236, 0.9960553283517746, 0.9960818825264686, 0.9961083409807554,
+        0.9961347037839539, 0.9961609710052511, 0.9961871427137041, 0.9962132189782389,
+        0.9962391998676515, 0.996265085450608, 0.9962908757956443, 0.9963165709711677,
+        0.9963421710454553, 0.9963676760866562, 0.9963930861627903, 0.9964184013417492,
+        0.9964436216912963, 0.9964687472790671, 0.9964937781725696, 0.9965187144391843,
+        0.9965435561461645, 0.996568303360637, 0.9965929561496013, 0.9966175145799313,
+        0.9966419787183743, 0.9966663486315519, 0.99669062438596, 0.9967148060479692,
+        0.9967388936838251, 0.9967628873596481, 0.9967867871414345, 0.9968105930950559,
+        0.9968343052862597, 0.9968579237806696, 0.9968814486437858, 0.996904879940985,
+        0.9969282177375205, 0.996951462098523, 0.9969746130890007, 0.9969976707738389,
+        0.9970206352178013, 0.9970435064855293, 0.9970662846415428, 0.99708896975024,
+        0.9971115618758983, 0.9971340610826738, 0.997156467434602, 0.9971787809955978,
+        0.9972010018294561, 0.9972231299998516, 0.9972451655703393, 0.9972671086043544,
+        0.9972889591652131, 0.9973107173161124, 0.9973323831201304, 0.9973539566402266,
+        0.9973754379392423, 0.9973968270799004, 0.997418124124806, 0.9974393291364463,
+        0.9974604421771913, 0.9974814633092937, 0.997502392594889, 0.9975232300959964,
+        0.9975439758745177, 0.9975646299922393, 0.9975851925108307, 0.9976056634918461,
+        0.9976260429967236, 0.9976463310867864, 0.9976665278232417, 0.9976866332671825,
+        0.9977066474795866, 0.9977265705213172, 0.9977464024531234, 0.9977661433356401,
+        0.9977857932293881, 0.997805352194775, 0.9978248202920944, 0.9978441975815272,
+        0.9978634841231405, 0.9978826799768895, 0.9979017852026162, 0.9979207998600504,
+        0.9979397240088097, 0.9979585577083999, 0.9979773010182148, 0.9979959539975369,
+        0.9980145167055372, 0.9980329892012758, 0.9980513715437016, 0.9980696637916532,
+        0.9980878660038585, 0.9981059782389351, 0.9981240005553906, 0.9981419330116228,
+        0.99815977566592, 0.9981775285764605, 0.9981951918013139, 0.9982127653984406,
+        0.9982302494256924, 0.998247643940812, 0.9982649490014341, 0.9982821646650852,
+        0.9982992909891834, 0.9983163280310394, 0.998333275847856, 0.998350134496729,
+        0.9983669040346466, 0.9983835845184901, 0.9984001760050341, 0.9984166785509464,
+        0.9984330922127888, 0.9984494170470163, 0.9984656531099785, 0.9984818004579188,
+        0.998497859146975, 0.9985138292331796, 0.9985297107724599, 0.998545503820638,
+        0.9985612084334313, 0.9985768246664526, 0.99859235257521, 0.9986077922151076,
+        0.9986231436414456, 0.9986384069094195, 0.9986535820741221, 0.9986686691905422,
+        0.9986836683135653, 0.9986985794979739, 0.9987134027984476, 0.9987281382695631,
+        0.9987427859657948, 0.9987573459415143, 0.9987718182509917, 0.9987862029483944,
+        0.9988005000877884, 0.9988147097231381, 0.9988288319083063, 0.9988428666970546,
+        0.9988568141430435, 0.9988706742998328, 0.9988844472208814, 0.9988981329595478,
+        0.99891173156909, 0.998925243102666, 0.9989386676133338, 0.9989520051540517,
+        0.9989652557776781, 0.9989784195369724, 0.9989914964845942, 0.9990044866731046,
+        0.9990173901549654, 0.9990302069825397, 0.9990429372080923, 0.9990555808837897,
+        0.9990681380616995, 0.9990806087937922, 0.9990929931319399, 0.9991052911279171,
+        0.9991175028334012, 0.9991296282999717, 0.9991416675791114, 0.9991536207222058,
+        0.9991654877805439, 0.999177268805318, 0.9991889638476238, 0.9992005729584608,
+        0.9992120961887324, 0.999223533589246, 0.9992348852107135, 0.9992461511037507,
+        0.9992573313188784, 0.999268425906522, 0.9992794349170115, 0.9992903584005827,
+        0.9993011964073759, 0.999311948987437, 0.9993226161907178, 0.9993331980670753,
+        0.999343694666273, 0.9993541060379799, 0.9993644322317715, 0.9993746732971298,
+        0.9993848292834432, 0.9993949002400067, 0.9994048862160224, 0.9994147872605994,
+        0.9994246034227539, 0.9994343347514096, 0.9994439812953976, 0.9994535431034568,
+        0.999463020224234, 0.9994724127062837, 0.999481720598069, 0.9994909439479609,
+        0.9995000828042392, 0.999509137215092, 0.9995181072286168, 0.9995269928928194,
+        0.9995357942556152, 0.9995445113648285, 0.9995531442681932, 0.9995616930133528,
+        0.9995701576478606, 0.9995785382191795, 0.9995868347746828, 0.9995950473616537,
+        0.999603176027286, 0.9996112208186839, 0.9996191817828622, 0.9996270589667466,
+        0.9996348524171736, 0.9996425621808912, 0.9996501883045582, 0.999657730834745,
+        0.9996651898179335, 0.9996725653005176, 0.9996798573288028, 0.9996870659490067,
+        0.9996941912072588, 0.9997012331496015, 0.999708191821989, 0.9997150672702885,
+        0.9997218595402798, 0.9997285686776558, 0.9997351947280222, 0.999741737736898,
+        0.9997481977497155, 0.9997545748118205, 0.9997608689684725, 0.9997670802648447,
+        0.9997732087460243, 0.9997792544570122, 0.999785217442724, 0.9997910977479894,
+        0.9997968954175526, 0.9998026104960723, 0.9998082430281224, 0.9998137930581913,
+        0.9998192606306825, 0.9998246457899147, 0.9998299485801224, 0.9998351690454547,
+        0.9998403072299771, 0.9998453631776705, 0.9998503369324315, 0.9998552285380734,
+        0.999860038038325, 0.9998647654768316, 0.9998694108971551, 0.9998739743427738,
+        0.9998784558570828, 0.9998828554833942, 0.9998871732649367, 0.9998914092448564,
+        0.9998955634662168, 0.9998996359719984, 0.9999036268050997, 0.9999075360083363,
+        0.9999113636244422, 0.9999151096960688, 0.9999187742657859, 0.9999223573760814,
+        0.9999258590693616, 0.9999292793879511, 0.9999326183740933, 0.99993587606995,
+        0.9999390525176024, 0.99994214775905, 0.999945161836212, 0.9999480947909265,
+        0.9999509466649512, 0.9999537174999632, 0.9999564073375592, 0.9999590162192556,
+        0.9999615441864891, 0.9999639912806157, 0.9999663575429124, 0.9999686430145758,
+        0.9999708477367232, 0.9999729717503923, 0.9999750150965416, 0.9999769778160503,
+        0.9999788599497186, 0.9999806615382675, 0.9999823826223395, 0.999984023242498,
+        0.9999855834392283, 0.9999870632529365, 0.9999884627239511, 0.9999897818925222,
+        0.9999910207988212, 0.9999921794829424, 0.9999932579849017, 0.9999942563446375,
+        0.9999951746020103, 0.9999960127968034, 0.9999967709687227, 0.999997449157397,
+        0.9999980474023774, 0.9999985657431386, 0.9999990042190781, 0.9999993628695169,
+        0.9999996417336989, 0.9999998408507921, 0.9999999602598874, 1.0,
+    },
+    [Math::DistortionCurve::DIST_CURVE_SHARP_SHARP] = {
+        0.0, 0.005347542758339483, 0.010643041750744705, 0.01588695327562932,
+        0.021079730071813678, 0.026221821342846004, 0.031313672781180926, 0.03635572659221619,
+        0.041348421518188155, 0.0462921928619268, 0.05118747251047095, 0.056034688958544326,
+        0.06083426733189325, 0.06558662941048658, 0.07029219365157839, 0.07495137521263462,
+        0.0795645859741236, 0.0841322345621718, 0.08865472637108505, 0.09313246358573614,
+        0.09756584520381924, 0.10195526705797202, 0.10630112183776592, 0.1106037991115655,
+        0.11486368534825715, 0.11908116393884827, 0.12325661521793686, 0.12739041648505323,
+        0.13148294202587332, 0.13553456313330509, 0.13954564812844816, 0.1435165623814278,
+        0.14744766833210315, 0.15133932551065107, 0.15519189055802607, 0.15900571724629628,
+        0.1627811564988571, 0.16651855641052246, 0.17021826226749445, 0.17388061656721213,
+        0.1775059590380798, 0.18109462665907575, 0.18464695367924158, 0.18816327163705324,
+        0.19164390937967413, 0.19508919308209055, 0.19849944626613084, 0.2018749898193681,
+        0.20521614201390734, 0.20852321852505795, 0.21179653244989133, 0.2150363943256852,
+        0.21824311214825448, 0.22141699139016938, 0.2245583350188617, 0.2276674435146197,
+        0.23074461488847162, 0.23379014469995943, 0.2368043260748024, 0.2397874497224515,
+        0.24273980395353567, 0.24566167469719902, 0.24855334551833175, 0.25141509763469294,
+        0.2542472099339275, 0.2570499589904776, 0.2598236190823881, 0.2625684622080072,
+        0.265284758102584, 0.2679727742547608, 0.27063277592296325, 0.27326502615168813,
+        0.27586978578768784, 0.2784473134960549, 0.2809978657762042, 0.28352169697775553,
+        0.2860190593163159, 0.2884902028891622, 0.29093537569082584, 0.2933548236285777,
+        0.29574879053781644, 0.29811751819735877, 0.30046124634463317, 0.302780212690777,
+        0.3050746529356385, 0.3073448007826825, 0.30959088795380213, 0.3118131442040358,
+        0.3140117973361909, 0.3161870732153733, 0.3183391957834254, 0.32046838707327013,
+        0.322574867223165, 0.32465885449086335, 0.32672056526768584, 0.3287602140925006,
+        0.33077801366561455, 0.33277417486257443, 0.3347489067478797, 0.33670241658860633,
+        0.33863490986794326, 0.3405465902986408, 0.3424376598363728, 0.34430831869301126,
+        0.3461587653498158, 0.3479891965705372, 0.34979980741443545, 0.35159079124921394,
+        0.35336233976386866, 0.35511464298145384, 0.3568478892717648, 0.35856226536393715,
+        0.3602579563589642, 0.36193514574213204, 0.3635940153953735, 0.365234745609541,
+        0.36685751509659814, 0.368462501001732, 0.3700498789153853, 0.3716198228852095,
+        0.37317250542793834, 0.3747080975411839, 0.37622676871515415, 0.3777286869442933,
+        0.3792140187388443, 0.3806829291363353, 0.3821355817129899, 0.38357213859506084,
+        0.38499276047008907, 0.3863976065980874, 0.3877868348226492, 0.38916060158198384,
+        0.3905190619198774, 0.3918623694965809, 0.39319067659962437, 0.3945041341545599,
+        0.39580289173563166, 0.3970870975763737, 0.39835689858013784, 0.3996124403305492,
+        0.4008538671018924, 0.40208132186942647, 0.40329494631963086, 0.40449488086038204,
+        0.4056812646310607, 0.4068542355125908, 0.40801393013741016, 0.4091604838993734,
+        0.41029403096358763, 0.4114147042761806, 0.4125226355740032, 0.41361795539426405,
+        0.4147007930841006, 0.41577127681008186, 0.4168295335676486, 0.417875689190487,
+        0.418909868359839, 0.4199321946137477, 0.42094279035624044, 0.4219417768664465,
+        0.42292927430765453, 0.4239054017363051, 0.42487027711092207, 0.42582401730098224,
+        0.42676673809572324, 0.4276985542128904, 0.4286195793074225, 0.42952992598007755,
+        0.4304297057859984, 0.4313190292432183, 0.4321980058411079, 0.4330667440487619,
+        0.43392535132332816, 0.43477393411827797, 0.43561259789161855, 0.4364414471140478,
+        0.43726058527705136, 0.43807011490094316, 0.43887013754284915, 0.4396607538046348,
+        0.4404420633407766, 0.44121416486617715, 0.4419771561639266, 0.4427311340930072,
+        0.4434761945959446, 0.44421243270640365, 0.444939942556732, 0.4456588173854468,
+        0.44636914954467155, 0.4470710305075176, 0.4477645508754136, 0.4484498003853825,
+        0.4491268679172664, 0.44979584150089974, 0.45045680832322993, 0.451109854735389,
+        0.4517550662597121, 0.45239252759670584, 0.45302232263196834, 0.45364453444305647,
+        0.45425924530630485, 0.4548665367035958, 0.4554664893290795, 0.45605918309584553,
+        0.4566446971425458, 0.4572231098399704, 0.4577944987975727, 0.45835894086995105,
+        0.45891651216327917, 0.4594672880416918, 0.4600113431336229, 0.4605487513380977,
+        0.461079585830978, 0.46160391907116216, 0.462121822806739, 0.462633368081097,
+        0.4631386252389875, 0.4636376639325443, 0.46413055312725765, 0.46461736110790447,
+        0.465098155484435, 0.46557300319781547, 0.46604197052582635, 0.46650512308881975,
+        0.4669625258554315, 0.4674142431482524, 0.4678603386494562, 0.46830087540638515,
+        0.4687359158370958, 0.4691655217358601, 0.4695897542786281, 0.47000867402844754,
+        0.470422340940844, 0.47083081436916013, 0.47123415306985406, 0.47163241520775856,
+        0.4720256583612998, 0.47241393952767735, 0.4727973151280043, 0.4731758410124084,
+        0.4735495724650947, 0.47391856420936956, 0.4742828704126262, 0.47464254469129297,
+        0.4749976401157422, 0.47534820921516374, 0.4756943039823988, 0.47603597587873875,
+        0.4763732758386864, 0.4767062542746791, 0.47703496108177906, 0.47735944564232335,
+        0.4776797568305413, 0.47799594301713416, 0.4783080520738208, 0.4786161313778471,
+        0.4789202278164608, 0.4792203877913518, 0.4795166572230572, 0.4798090815553334,
+        0.48009770575949223, 0.48038257433870507, 0.4806637313322715, 0.4809412203198569,
+        0.48121508442569466, 0.4814853663227555, 0.4817521082368865, 0.48201535195091444,
+        0.48227513880871803, 0.4825315097192697, 0.48278450516064203, 0.48303416518398573,
+        0.483280529417474, 0.4835236370702165, 0.4837635269361426, 0.4840002373978526,
+        0.48423380643043906, 0.4844642716052776, 0.4846916700937881, 0.48491603867116323,
+        0.48513741372007135, 0.48535583123432546, 0.48557132682252535, 0.4857839357116702,
+        0.4859936927507407, 0.4862006324142544, 0.4864047888057894, 0.48660619566148355,
+        0.48680488635350194, 0.4870008938934774, 0.48719425093592383, 0.487384989781621,
+        0.4875731423809711, 0.4877587403373307, 0.4879418149103121, 0.4881223970190592,
+        0.4883005172454983, 0.4884762058375583, 0.4886494927123692, 0.48882040745942995,
+        0.4889889793437534, 0.4891552373089838, 0.48931920998048894, 0.48948092566842716,
+        0.48964041237078765, 0.4897976977764077, 0.4899528092679635, 0.4901057739249351,
+        0.49025661852655056, 0.49040536955470054, 0.49055205319683176, 0.49069669534881627,
+        0.49083932161779587, 0.490979957325002, 0.49111862750855384, 0.4912553569262318,
+        0.49139017005822666, 0.4915230911098696, 0.4916541440143322, 0.4917833524353117,
+        0.4919107397696874, 0.49203632915015727, 0.4921601434478515, 0.49228220527492544,
+        0.4924025369871269, 0.492521160686346, 0.492638098223139, 0.49275337119923507,
+        0.4928670009700169, 0.49297900864698313, 0.49308941510019055, 0.4931982409606712,
+        0.49330550662283196, 0.4934112322468334, 0.4935154377609473, 0.4936181428638927,
+        0.4937193670271542, 0.4938191294972779, 0.4939174492981495, 0.49401434523325005,
+        0.49410983588789514, 0.49420393963145204, 0.4942966746195384, 0.49438805879620107,
+        0.4944781098960792, 0.49456684544654284, 0.49465428276981643, 0.4947404389850833,
+        0.4948253310105715, 0.49490897556561975, 0.4949913891727277, 0.4950725881595849,
+        0.4951525886610838, 0.49523140662131926, 0.49530905779555706, 0.4953855577522015,
+        0.49546092187473384, 0.49553516536363645, 0.4956083032383029, 0.49568035033892677,
+        0.49575132132837624, 0.4958212306940494, 0.4958900927497161, 0.4959579216373413,
+        0.4960247313288901, 0.49609053562812133, 0.49615534817235935, 0.4962191824342552,
+        0.4962820517235288, 0.4963439691886923, 0.4964049478187665, 0.4964650004449707,
+        0.49652413974240833, 0.49658237823172574, 0.4966397282807676, 0.496696202106205,
+        0.4967518117751593, 0.4968065692068055, 0.49686048617396, 0.49691357430465694,
+        0.49696584508370945, 0.4970173098542534, 0.49706797981928047, 0.497117866043156,
+        0.4971669794531203, 0.49721533084077957, 0.49726293086358186, 0.49730979004627635,
+        0.4973559187823631, 0.4974013273355276, 0.49744602584106223, 0.49749002430726913,
+        0.49753333261686195, 0.49757596052834135, 0.497617917677366, 0.49765921357810583,
+        0.4976998576245873, 0.4977398590920189, 0.49777922713811273, 0.4978179708043862,
+        0.4978560990174536, 0.4978936205903069, 0.4979305442235851, 0.49796687850682575,
+        0.49800263191971117, 0.49803781283329907, 0.49807242951123976, 0.4981064901109885,
+        0.4981400026849977, 0.4981729751819023, 0.4982054154476957, 0.4982373312268859,
+        0.49826873016365053, 0.4982996198029757, 0.4983300075917803, 0.4983599008800385,
+        0.49838930692188055, 0.4984182328766923, 0.49844668581019747, 0.4984746726955329,
+        0.49850220041430954, 0.4985292757576688, 0.49855590542732314, 0.4985820960365861,
+        0.49860785411139846, 0.49863318609133583, 0.498658098330615, 0.4986825970990809,
+        0.49870668858319184, 0.4987303788869901, 0.4987536740330637, 0.49877657996350017,
+        0.4987991025408308, 0.49882124754895996, 0.498843020694093, 0.4988644276056528,
+        0.49888547383717835, 0.49890616486722983, 0.49892650610026823, 0.49894650286753994,
+        0.4989661604279418, 0.4989854839688845, 0.4990044786071411, 0.49902314938969383,
+        0.4990415012945667, 0.4990595392316502, 0.4990772680435226, 0.4990946925062496,
+        0.4991118173301996, 0.4991286471608235, 0.49914518657944235, 0.4991614401040251,
+        0.49917741218995587, 0.4991931072307933, 0.4992085295590221, 0.4992236834467979,
+        0.4992385731066852, 0.49925320269237994, 0.49926757629943996, 0.49928169796599114,
+        0.4992955716734315, 0.4993092013471409, 0.49932259085715874, 0.49933574401887754,
+        0.49934866459371247, 0.49936135628977585, 0.4993738227625353, 0.49938606761547444,
+        0.49939809440073174, 0.4994099066197512, 0.4994215077239108, 0.49943290111515554,
+        0.49944409014660723, 0.49945507812319273, 0.4994658683022407, 0.49947646389408656,
+        0.4994868680626673, 0.4994970839261066, 0.49950711455729957, 0.4995169629844854,
+        0.49952663219181803, 0.4995361251199259, 0.499545444666473, 0.49955459368670496,
+        0.4995635749939953, 0.4995723913603834, 0.4995810455171055, 0.49958954015512563,
+        0.499597877925652, 0.4996060614406486, 0.4996140932733538, 0.49962197595878,
+        0.4996297119942038, 0.4996373038396684, 0.4996447539184676, 0.4996520646176254,
+        0.499659238288369, 0.4996662772466085, 0.4996731837733923, 0.49967996011537297,
+        0.4996866084852566, 0.4996931310622651, 0.49969952999256073, 0.4997058073897035,
+        0.4997119653350731, 0.49971800587830745, 0.4997239310377236, 0.4997297428007344,
+        0.4997354431242659, 0.4997410339351669, 0.4997465171306175, 0.4997518945785268,
+        0.4997571681179238, 0.4997623395593582, 0.49976741068528324, 0.49977238325043305,
+        0.499777258982209, 0.49978203958104767, 0.49978672672078894, 0.4997913220490452,
+        0.49979582718756227, 0.4998002437325638, 0.4998045732551198, 0.4998088173014834,
+        0.499812977393435, 0.49981705502863305, 0.49982105168092994, 0.49982496880072125,
+        0.49982880781526423, 0.4998325701290034, 0.4998362571238896, 0.49983987015969994,
+        0.4998434105743421, 0.49984687968416763, 0.4998502787842777, 0.4998536091488245,
+        0.4998568720312989, 0.4998600686648367, 0.49986320026249903, 0.4998662680175673,
+        0.4998692731038143, 0.4998722166758001, 0.49987509986913314, 0.4998779238007457,
+        0.499880689569176, 0.49988339825481237, 0.4998860509201751, 0.4998886486101615,
+        0.49989119235231894, 0.4998936831570785, 0.4998961220180178, 0.4998985099120999,
+        0.49990084779992355, 0.49990313662595914, 0.49990537731878965, 0.499907570791339,
+        0.49990971794110844, 0.4999118196504092, 0.49991387678657273, 0.49991589020219007,
+        0.499917860735329, 0.49991978920973534, 0.4999216764350719, 0.499923523207107,
+        0.4999253303079399, 0.49992709850619454, 0.4999288285572373, 0.4999305212033625,
+        0.49993217717399824, 0.49993379718590253, 0.49993538194335185, 0.4999369321383432,
+        0.4999384484507629, 0.4999399315485867, 0.49994138208806443, 0.4999428007138868,
+        0.49994418805937674, 0.4999455447466615, 0.4999468713868432, 0.49994816858017194,
+        0.4999494369162158, 0.4999506769740296, 0.49995188932231477, 0.49995307451958004,
+        0.49995423311431336, 0.49995536564512266, 0.49995647264090637, 0.49995755462099817,
+        0.49995861209532577, 0.4999596455645508, 0.4999606555202264, 0.49996164244493535,
+        0.49996260681243937, 0.4999635490878147, 0.4999644697275932, 0.49996536917990597,
+        0.4999662478846152, 0.4999671062734391, 0.49996794477009987, 0.4999687637904455,
+        0.49996956374257073, 0.499970345026965, 0.4999711080366067, 0.4999718531571203,
+        0.49997258076686896, 0.4999732912370858, 0.49997398493200285, 0.4999746622089406,
+        0.4999753234184473, 0.4999759689044015, 0.49997659900412117, 0.49997721404847867,
+        0.4999778143620019, 0.49997840026299, 0.4999789720636175, 0.49997953007003126,
+        0.4999800745824466, 0.49998060589526483, 0.4999811242971716, 0.49998163007121227,
+        0.4999821234949064, 0.4999826048403463, 0.49998307437427336, 0.49998353235819076,
+        0.49998397904843445, 0.4999844146962677, 0.49998483954797973, 0.49998525384496456,
+        0.49998565782380716, 0.49998605171635907, 0.49998643574983115, 0.499986810146882,
+        0.4999871751256884, 0.49998753090000564, 0.4999878776792941, 0.4999882156687434,
+        0.4999885450693928, 0.49998886607815946, 0.4999891788879619, 0.4999894836877445,
+        0.4999897806625892, 0.4999900699937528, 0.49999035185875895, 0.49999062643145453,
+        0.49999089388208245, 0.49999115437733266, 0.49999140808042575, 0.4999916551511787,
+        0.499991895746039, 0.4999921300181708, 0.49999235811751414, 0.4999925801908378,
+        0.49999279638180244, 0.4999930068310167, 0.4999932116760816, 0.4999934110516761,
+        0.4999936050895855, 0.4999937939187621, 0.4999939776653908, 0.49999415645293444,
+        0.49999433040215924, 0.49999449963123205, 0.49999466425574524, 0.49999482438876425,
+        0.49999498014087834, 0.4999951316202501, 0.4999952789326602, 0.49999542218157156,
+        0.4999955614681243, 0.49999569689124723, 0.49999582854765084, 0.49999595653189377,
+        0.4999960809364082, 0.4999962018515724, 0.49999631936570527, 0.49999643356515727,
+        0.4999965445343111, 0.4999966523556273, 0.49999675710971214, 0.4999968588753116,
+        0.4999969577293849, 0.49999705374711073, 0.499997147001947, 0.49999723756564735,
+        0.4999973255083121, 0.4999974108984154, 0.49999749380282227, 0.4999975742868565,
+        0.49999765241429206, 0.4999977282474163, 0.49999780184704595, 0.49999787327256434,
+        0.4999979425819421, 0.49999800983176745, 0.49999807507729094, 0.4999981383724381,
+        0.4999981997698315, 0.49999825932083936, 0.4999983170755906, 0.49999837308298495,
+        0.4999984273907606, 0.49999848004547087, 0.49999853109253506, 0.4999985805762767,
+        0.49999862853990557, 0.4999986750255905, 0.4999987200744391, 0.49999876372654345,
+        0.49999880602100244, 0.49999884699594643, 0.4999988866885316, 0.49999892513498617,
+        0.4999989623706521, 0.49999899842993206, 0.4999990333463984, 0.4999990671527418,
+        0.4999990998808361, 0.49999913156172987, 0.49999916222567103, 0.4999991919021423,
+        0.49999922061986274, 0.4999992484067779, 0.4999992752901417, 0.4999993012964844,
+        0.4999993264516444, 0.49999935078076346, 0.49999937430835023, 0.4999993970582451,
+        0.49999941905364886, 0.49999944031717564, 0.4999994608708079, 0.4999994807359446,
+        0.4999994999334136, 0.49999951848348545, 0.4999995364058604, 0.4999995537197435,
+        0.49999957044376886, 0.49999958659609123, 0.4999996021943678, 0.499999617255757,
+        0.4999996317969488, 0.49999964583416756, 0.4999996593831871, 0.49999967245934934,
+        0.49999968507754594, 0.49999969725227694, 0.49999970899761154, 0.49999972032723006,
+        0.49999973125442, 0.4999997417921009, 0.49999975195280044, 0.4999997617487113,
+        0.499999771191653, 0.4999997802931279, 0.49999978906427145, 0.4999997975159223,
+        0.49999980565859903, 0.4999998135024895, 0.49999982105751384, 0.49999982833327294,
+        0.49999983533909526, 0.49999984208401893, 0.4999998485768399, 0.49999985482605075,
+        0.4999998608399168, 0.49999986662644913, 0.49999987219340775, 0.4999998775483181,
+        0.49999988269848133, 0.4999998876509661, 0.49999989241263426, 0.49999989699011416,
+        0.49999990138986217, 0.49999990561809543, 0.499999909680871, 0.4999999135840309,
+        0.49999991733323856, 0.49999992093398204, 0.4999999243915813, 0.4999999277111755,
+        0.4999999308977314, 0.49999993395607967, 0.4999999368908677, 0.499999939706622,
+        0.4999999424077065, 0.49999994499832645, 0.49999994748257515, 0.4999999498643994,
+        0.4999999521476053, 0.4999999543358897, 0.4999999564328227, 0.4999999584418479,
+        0.49999996036630123, 0.49999996220939363, 0.4999999639742283, 0.499999965663827,
+        0.4999999672810754, 0.499999968828767, 0.4999999703096227, 0.49999997172624594,
+        0.4999999730811554, 0.4999999743767688, 0.4999999756154542, 0.49999997679945335,
+        0.4999999779309572, 0.49999997901207544, 0.4999999800448245, 0.49999998103116294,
+        0.4999999819729867, 0.49999998287210995, 0.4999999837302767, 0.4999999845491616,
+        0.4999999853304145, 0.49999998607558976, 0.4999999867861937, 0.4999999874636671,
+        0.49999998810942053, 0.4999999887247959, 0.49999998931108114, 0.499999989869515,
+        0.49999999040130927, 0.4999999909075906, 0.4999999913894856, 0.49999999184804267,
+        0.4999999922842898, 0.49999999269922185, 0.4999999930937552, 0.49999999346880963,
+        0.49999999382527094, 0.49999999416394414, 0.4999999944856473, 0.49999999479115037,
+        0.4999999950811851, 0.4999999953564661, 0.49999999561767017, 0.4999999958654442,
+        0.4999999961004229, 0.4999999963231998, 0.4999999965343297, 0.499999996734395,
+        0.4999999969239021, 0.49999999710335075, 0.4999999972732477, 0.4999999974340262,
+        0.4999999975861377, 0.49999999773001275, 0.49999999786603555, 0.4999999979946207,
+        0.4999999981161248, 0.4999999982308926, 0.4999999983392756, 0.4999999984415775,
+        0.4999999985381358, 0.4999999986292086, 0.4999999987150974, 0.4999999987960653,
+        0.49999999887237134, 0.49999999894424696, 0.4999999990119458, 0.4999999990756652,
+        0.49999999913562804, 0.49999999919204524, 0.4999999992450713, 0.4999999992949352,
+        0.49999999934178035, 0.4999999993857724, 0.4999999994270809, 0.49999999946585744,
+        0.4999999995022206, 0.49999999953632507, 0.4999999995682951, 0.49999999959823294,
+        0.4999999996262741, 0.4999999996525387, 0.4999999996771125, 0.4999999997000911,
+        0.4999999997215739, 0.4999999997416497, 0.4999999997604098, 0.4999999997778998,
+        0.49999999979422843, 0.49999999980946497, 0.4999999998236744, 0.4999999998369008,
+        0.49999999984923316, 0.4999999998607015, 0.49999999987138277, 0.4999999998812903,
+        0.49999999989050714, 0.4999999998990887, 0.499999999907038, 0.49999999991441,
+        0.49999999992126304, 0.4999999999276191, 0.49999999993348027, 0.4999999999389016,
+        0.4999999999439508, 0.4999999999486065, 0.4999999999529001, 0.49999999995686134,
+        0.49999999996052324, 0.499999999963899, 0.49999999996701056, 0.49999999996988503,
+        0.4999999999725134, 0.499999999974959, 0.4999999999771806, 0.49999999997921146,
+        0.4999999999811057, 0.4999999999828307, 0.4999999999844134, 0.4999999999858451,
+        0.49999999998717537, 0.4999999999883868, 0.4999999999894767, 0.49999999999049266,
+        0.4999999999914067, 0.49999999999225553, 0.499999999993026, 0.4999999999937126,
+        0.4999999999943407, 0.4999999999949116, 0.4999999999954333, 0.4999999999958984,
+        0.49999999999632805, 0.499999999996726, 0.4999999999970618, 0.4999999999973909,
+        0.4999999999976752, 0.49999999999791606, 0.4999999999981458, 0.4999999999983686,
+        0.4999999999985345, 0.49999999999869293, 0.4999999999988615, 0.4999999999989935,
+        0.49999999999911315, 0.4999999999992201, 0.49999999999930067, 0.49999999999938777,
+        0.4999999999994614, 0.499999999999541, 0.4999999999995926, 0.4999999999996402,
+        0.4999999999996854, 0.4999999999997298, 0.4999999999997629, 0.4999999999998123,
+        0.4999999999998221, 0.49999999999983935, 0.49999999999986694, 0.49999999999987704,
+        0.49999999999990086, 0.4999999999999174, 0.49999999999992756, 0.4999999999999337,
+        0.4999999999999389, 0.4999999999999654, 0.49999999999995703, 0.49999999999996975,
+        0.4999999999999768, 0.49999999999999306, 0.499999999999986, 0.49999999999999645,
+        0.4999999999999813, 0.5000000000000013, 0.5000000000000003, 0.49999999999999367,
+        0.49999999999998357, 0.5000000000000108, 0.49999999999999445, 0.49999999999999817,
+        0.5000000000000079, 0.5000000000000051, 0.4999999999999943, 0.5000000000000011,
+        0.49999999999998396, 0.5000000000000059, 0.4999999999999898, 0.4999999999999964,
+        0.5000000000000056, 0.5000000000000052, 0.49999999999999406, 0.5000000000000123,
+        0.4999999999999884, 0.5000000000000093, 0.4999999999999889, 0.4999999999999726,
+        0.4999999999999825, 0.5000000000000039, 0.4999999999999917, 0.499999999999982,
+        0.5000000000000041, 0.49999999999999956, 0.5000000000000081, 0.5000000000000044,
+        0.5000000000000148, 0.49999999999999883, 0.5000000000000051, 0.4999999999999984,
+        0.49999999999998884, 0.4999999999999967, 0.49999999999999395, 0.5000000000000008,
+        0.4999999999999968, 0.4999999999999937, 0.4999999999999877, 0.49999999999999245,
+        0.4999999999999895, 0.5000000000000118, 0.4999999999999927, 0.5000000000000066,
+        0.5000000000000089, 0.4999999999999869, 0.4999999999999917, 0.49999999999999784,
+        0.5000000000000009, 0.5000000000000098, 0.49999999999999734, 0.5000000000000008,
+        0.5000000000000179, 0.49999999999998535, 0.4999999999999787, 0.49999999999999445,
+        0.5, 0.49999999999999084, 0.49999999999998934, 0.49999999999999944,
+        0.5000000000000104, 0.5000000000000066, 0.49999999999998523, 0.5000000000000006,
+        0.4999999999999848, 0.49999999999998135, 0.49999999999999667, 0.49999999999999195,
+        0.5000000000000124, 0.4999999999999855, 0.4999999999999879, 0.5000000000000104,
+        0.49999999999999273, 0.49999999999999756, 0.5000000000000109, 0.49999999999999195,
+        0.500000000000004, 0.4999999999999993, 0.5000000000000031, 0.4999999999999924,
+        0.5000000000000104, 0.5000000000000047, 0.5000000000000241, 0.5000000000000057,
+        0.5000000000000134, 0.4999999999999952, 0.4999999999999953, 0.49999999999999517,
+        0.499999999999997, 0.5000000000000188, 0.5000000000000019, 0.5000000000000152,
+        0.49999999999998895, 0.5000000000000163, 0.49999999999997363, 0.49999999999998707,
+        0.5000000000000137, 0.4999999999999802, 0.49999999999998834, 0.49999999999998906,
+        0.4999999999999938, 0.4999999999999946, 0.5000000000000291, 0.499999999999988,
+        0.4999999999999981, 0.4999999999999932, 0.5000000000000274, 0.4999999999999883,
+        0.5000000000000134, 0.5000000000000283, 0.49999999999998124, 0.49999999999997524,
+        0.5000000000000014, 0.5000000000000191, 0.500000000000002, 0.4999999999999942,
+        0.49999999999999245, 0.5000000000000162, 0.5000000000000118, 0.5000000000000178,
+        0.5000000000000466, 0.5000000000000433, 0.5000000000000452, 0.50000000000005,
+        0.5000000000000538, 0.5000000000000615, 0.500000000000077, 0.5000000000001054,
+        0.5000000000001021, 0.5000000000001366, 0.5000000000001534, 0.5000000000001746,
+        0.5000000000001829, 0.5000000000002125, 0.5000000000002683, 0.5000000000003296,
+        0.5000000000003308, 0.5000000000004019, 0.5000000000004927, 0.5000000000005272,
+        0.5000000000005965, 0.5000000000007021, 0.5000000000007864, 0.5000000000008937,
+        0.5000000000009931, 0.5000000000011177, 0.5000000000013248, 0.500000000001456,
+        0.5000000000016374, 0.5000000000018776, 0.5000000000020619, 0.5000000000023488,
+        0.5000000000026191, 0.5000000000029906, 0.5000000000032754, 0.500000000003655,
+        0.500000000004084, 0.5000000000045671, 0.5000000000050878, 0.5000000000056447,
+        0.5000000000062806, 0.5000000000069674, 0.5000000000077222, 0.5000000000085971,
+        0.5000000000095121, 0.5000000000105067, 0.5000000000116248, 0.5000000000128254,
+        0.5000000000141409, 0.5000000000155752, 0.5000000000171548, 0.5000000000188582,
+        0.5000000000208096, 0.5000000000228233, 0.5000000000250734, 0.5000000000274566,
+        0.5000000000301316, 0.5000000000329846, 0.5000000000361564, 0.5000000000395072,
+        0.5000000000431133, 0.5000000000470927, 0.500000000051381, 0.500000000056046,
+        0.5000000000610387, 0.5000000000665332, 0.5000000000724166, 0.500000000078751,
+        0.5000000000855778, 0.5000000000929139, 0.5000000001009216, 0.5000000001094921,
+        0.5000000001187119, 0.5000000001286614, 0.5000000001393378, 0.5000000001507827,
+        0.5000000001630875, 0.5000000001763716, 0.5000000001905145, 0.5000000002057862,
+        0.5000000002221251, 0.5000000002395744, 0.5000000002583563, 0.5000000002784386,
+        0.5000000002999238, 0.5000000003228872, 0.5000000003474318, 0.5000000003737173,
+        0.5000000004017296, 0.5000000004317368, 0.500000000463715, 0.5000000004978141,
+        0.5000000005341205, 0.5000000005729038, 0.5000000006142435, 0.5000000006582263,
+        0.5000000007051049, 0.5000000007549016, 0.5000000008079474, 0.5000000008643587,
+        0.5000000009243607, 0.5000000009880541, 0.5000000010557817, 0.5000000011276506,
+        0.5000000012039568, 0.5000000012849045, 0.5000000013707907, 0.5000000014618475,
+        0.5000000015584174, 0.5000000016607709, 0.50000000176914, 0.5000000018839388,
+        0.5000000020053449, 0.5000000021340079, 0.5000000022700514, 0.500000002413815,
+        0.5000000025659853, 0.5000000027267548, 0.500000002896624, 0.5000000030761094,
+        0.5000000032655965, 0.5000000034656306, 0.5000000036767908, 0.5000000038996043,
+        0.5000000041346105, 0.50000000438227, 0.5000000046434782, 0.5000000049187885,
+        0.5000000052088858, 0.5000000055143362, 0.5000000058360573, 0.500000006174725,
+        0.500000006531149, 0.500000006906258, 0.5000000073007718, 0.5000000077156705,
+        0.5000000081519571, 0.5000000086105034, 0.5000000090924264, 0.5000000095986598,
+        0.5000000101304725, 0.5000000106889236, 0.5000000112752415, 0.5000000118905646,
+        0.5000000125363181, 0.5000000132138124, 0.5000000139244037, 0.5000000146694994,
+        0.5000000154508584, 0.5000000162697471, 0.5000000171279304, 0.5000000180270011,
+        0.5000000189688348, 0.5000000199551824, 0.5000000209878909, 0.5000000220690798,
+        0.5000000232004569, 0.500000024384592, 0.500000025623215, 0.5000000269188816,
+        0.5000000282737515, 0.5000000296903534, 0.5000000311712169, 0.500000032718976,
+        0.5000000343361585, 0.5000000360257225, 0.5000000377905784, 0.500000039633647,
+        0.5000000415581646, 0.500000043567127, 0.5000000456641239, 0.5000000478524862,
+        0.5000000501355921, 0.5000000525174422, 0.5000000550016619, 0.5000000575922927,
+        0.5000000602933954, 0.5000000631091314, 0.5000000660439706, 0.5000000691022587,
+        0.5000000722889141, 0.5000000756083532, 0.5000000790659769, 0.5000000826668186,
+        0.5000000864160042, 0.5000000903191412, 0.5000000943819095, 0.5000000986101611,
+        0.5000001030098693, 0.5000001075873436, 0.500000112349062, 0.5000001173015679,
+        0.5000001224516482, 0.5000001278065692, 0.5000001333735894, 0.5000001391601095,
+        0.5000001451739385, 0.5000001514232406, 0.5000001579160284, 0.500000164660859,
+        0.500000171666699, 0.5000001789425927, 0.5000001864974679, 0.5000001943414325,
+        0.5000002024840814, 0.5000002109357892, 0.5000002197069321, 0.5000002288083317,
+        0.5000002382512125, 0.5000002480471549, 0.5000002582078961, 0.5000002687456061,
+        0.5000002796727523, 0.5000002910023387, 0.5000003027477061, 0.5000003149224842,
+        0.5000003275406476, 0.5000003406167818, 0.5000003541658773, 0.5000003682029869,
+        0.5000003827442524, 0.5000003978057438, 0.5000004134039442, 0.5000004295562298,
+        0.5000004462802694, 0.5000004635941697, 0.500000481516521, 0.5000005000665458,
+        0.5000005192640092, 0.5000005391291092, 0.5000005596828075, 0.5000005809463282,
+        0.5000006029418192, 0.5000006256916839, 0.5000006492192415, 0.5000006735483187,
+        0.5000006987034847, 0.5000007247097927, 0.5000007515932458, 0.5000007793801163,
+        0.5000008080978552, 0.5000008377743888, 0.5000008684383362, 0.5000009001191851,
+        0.5000009328472244, 0.5000009666536368, 0.50000100157012, 0.5000010376294091,
+        0.500001074865067, 0.5000011133114957, 0.5000011530041427, 0.5000011939790882,
+        0.5000012362734578, 0.5000012799256058, 0.5000013249743958, 0.500001371460199,
+        0.5000014194237647, 0.5000014689074608, 0.5000015199546043, 0.5000015726092487,
+        0.5000016269170952, 0.5000016829244509, 0.5000017406791983, 0.5000018002302427,
+        0.5000018616275336, 0.5000019249227934, 0.5000019901681877, 0.5000020574180137,
+        0.5000021267273742, 0.5000021981529802, 0.5000022717527187, 0.5000023475856952,
+        0.5000024257131701, 0.5000025061973032, 0.5000025891016749, 0.5000026744917079,
+        0.5000027624343809, 0.5000028529980496, 0.5000029462528793, 0.5000030422706909,
+        0.5000031411247129, 0.5000032428903763, 0.5000033476444022, 0.5000034554656839,
+        0.5000035664347856, 0.5000036806343059, 0.5000037981483962, 0.5000039190635394,
+        0.5000040434681453, 0.5000041714524028, 0.5000043031088195, 0.5000044385317743,
+        0.5000045778184997, 0.500004721067418, 0.5000048683796472, 0.5000050198590894,
+        0.5000051756112445, 0.5000053357442202, 0.5000055003687237, 0.5000056695979588,
+        0.5000058435471304, 0.5000060223344385, 0.5000062060812398, 0.5000063949104876,
+        0.500006588948394, 0.5000067883239477, 0.500006993168934, 0.5000072036180812,
+        0.500007419809033, 0.5000076418823808, 0.5000078699819326, 0.5000081042539637,
+        0.5000083448487818, 0.5000085919196976, 0.500008845622781, 0.5000091061179828,
+        0.5000093735686004, 0.5000096481412074, 0.5000099300061424, 0.5000102193373892,
+        0.5000105163121852, 0.5000108211121083, 0.5000111339217619, 0.5000114549306982,
+        0.5000117843313371, 0.5000121223206864, 0.500012469099906, 0.5000128248743722,
+        0.5000131898531601, 0.5000135642500797, 0.5000139482837542, 0.5000143421762513,
+        0.5000147461550392, 0.5000151604520205, 0.500015585303723, 0.5000160209515182,
+        0.5000164676418236, 0.500016925625681, 0.5000173951597465, 0.5000178765051552,
+        0.5000183699287817, 0.5000188757029195, 0.5000193941045928, 0.5000199254176001,
+        0.5000204699299531, 0.5000210279364259, 0.5000215997369571, 0.5000221856379389,
+        0.5000227859515282, 0.500023400995767, 0.5000240310955665, 0.5000246765815579,
+        0.5000253377911781, 0.5000260150680698, 0.5000267087630076, 0.5000274192331468,
+        0.5000281468428763, 0.5000288919633393, 0.5000296549730404, 0.5000304362575029,
+        0.500031236209682, 0.5000320552298763, 0.5000328937265075, 0.5000337521152265,
+        0.5000346308201339, 0.5000355302724385, 0.500036450912206, 0.5000373931875097,
+        0.5000383575550722, 0.5000393444798376, 0.5000403544354654, 0.5000413879047401,
+        0.5000424453790925, 0.5000435273591882, 0.5000446343548773, 0.5000457668857732,
+        0.5000469254803417, 0.5000481106778449, 0.5000493230259037, 0.5000505630839236,
+        0.5000518314198332, 0.5000531286132068, 0.5000544552533437, 0.5000558119405102,
+        0.5000571992860563, 0.5000586179120707, 0.500060068451259, 0.5000615515493246,
+        0.5000630678614526, 0.5000646180565189, 0.5000662028138018, 0.5000678228260562,
+        0.5000694787966588, 0.5000711714428915, 0.5000729014936248, 0.5000746696922398,
+        0.5000764767930704, 0.500078323564967, 0.5000802107901517, 0.5000821392646311,
+        0.5000841097978647, 0.5000861232131564, 0.50008818034962, 0.5000902820590158,
+        0.5000924292086287, 0.5000946226810442, 0.5000968633742654, 0.5000991522000975,
+        0.5001014900878656, 0.500103877981882, 0.5001063168428647, 0.5001088076476893,
+        0.5001113513899949, 0.5001139490798211, 0.500116601745141, 0.5001193104308288,
+        0.5001220761991347, 0.5001249001308226, 0.5001277833238857, 0.5001307268962097,
+        0.5001337319820728, 0.5001367997375155, 0.5001399313349634, 0.500143127968325,
+        0.5001463908512657, 0.5001497212156789, 0.5001531203157438, 0.5001565894259233,
+        0.5001601298401844, 0.5001637428761608, 0.5001674298709953, 0.500171192184957,
+        0.50017503119951, 0.5001789483188809, 0.5001829449715324, 0.5001870226063975,
+        0.5001911826987743, 0.5001954267448583, 0.5001997562674954, 0.5002041728124859,
+        0.5002086779510146, 0.5002132732792018, 0.5002179604187872, 0.5002227410177926,
+        0.5002276167496713, 0.5002325893145371, 0.5002376604404852, 0.5002428318822576,
+        0.5002481054214875, 0.5002534828693309, 0.5002589660645984, 0.5002645568757224,
+        0.5002702571994329, 0.5002760689624024, 0.5002819941217256, 0.500288034664916,
+        0.500294192610178, 0.5003004700072265, 0.5003068689375836, 0.5003133915147728,
+        0.500320039884261, 0.5003268162269242, 0.5003337227533092, 0.5003407617115337,
+        0.5003479353824605, 0.5003552460817375, 0.500362696160426, 0.5003702880058776,
+        0.5003780240407826, 0.5003859067265888, 0.5003939385594051, 0.5004021220742699,
+        0.5004104598449012, 0.5004189544832166, 0.5004276086392668, 0.500436425006079,
+        0.5004454063131656, 0.5004545553334944, 0.5004638748801165, 0.5004733678082703,
+        0.5004830370153911, 0.5004928854423286, 0.5005029160739368, 0.5005131319371308,
+        0.5005235361058548, 0.5005341316976747, 0.50054492187688, 0.5005559098531399,
+        0.5005670988851246, 0.5005784922762656, 0.500590093380434, 0.5006019055993134,
+        0.500613932384961, 0.5006261772376828, 0.5006386437104724, 0.5006513354061453,
+        0.5006642559809347, 0.5006774091432059, 0.5006907986527321, 0.5007044283268504,
+        0.5007183020338936, 0.5007324237007073, 0.5007467973076115, 0.500761426893358,
+        0.5007763165533187, 0.5007914704409345, 0.5008068927692855, 0.5008225878101678,
+        0.5008385598958208, 0.5008548134209233, 0.5008713528390449, 0.5008881826700339,
+        0.5009053074938268, 0.5009227319566153, 0.5009404607682033, 0.500958498705413,
+        0.5009768506099304, 0.5009955213929954, 0.5010145160307912, 0.5010338395716306,
+        0.5010534971324355, 0.5010734939000528, 0.5010938351326343, 0.5011145261626206,
+        0.5011355723944763, 0.5011569793056162, 0.5011787524509411, 0.5012008974591174,
+        0.5012234200364, 0.5012463259671657, 0.5012696211128, 0.5012933114168933,
+        0.5013174029011903, 0.5013419016690445, 0.5013668139088081, 0.5013921458888053,
+        0.5014179039632077, 0.5014440945727002, 0.5014707242424378, 0.5014977995858088,
+        0.5015253273045404, 0.5015533141898102, 0.5015817671234915, 0.5016106930782855,
+        0.501640099120067, 0.5016699924084034, 0.5017003801967095, 0.5017312698365078,
+        0.5017626687729043, 0.5017945845524516, 0.5018270248183024, 0.501859997314641,
+        0.5018935098891522, 0.5019275704885785, 0.5019621871668075, 0.5019973680805604,
+        0.5020331214933001, 0.5020694557761614, 0.502106379409941, 0.5021439009823602,
+        0.5021820291954538, 0.5022207728618052, 0.5022601409080006, 0.5023001423749518,
+        0.502340786422062, 0.5023820823227221, 0.5024240394713907, 0.5024666673831428,
+        0.5025099756927658, 0.5025539741596466, 0.5025986726641702, 0.502644081217747,
+        0.502690209954069, 0.5027370691361124, 0.502784669159367, 0.5028330205471212,
+        0.5028821339570583, 0.5029320201808049, 0.5029826901456549, 0.5030341549158848,
+        0.5030864256951613, 0.5031395138261676, 0.5031934307931528, 0.503248188224416,
+        0.503303797893637, 0.5033602717193765, 0.5034176217681733, 0.5034758602572926,
+        0.5035349995544532, 0.5035950521814351, 0.5036560308115657, 0.5037179482763595,
+        0.5037808175658177, 0.5038446518274005, 0.5039094643722123, 0.5039752686712468,
+        0.5040420783626902, 0.504109907250044, 0.504178769305876, 0.5042486786717714,
+        0.5043196496608704, 0.5043916967622275, 0.5044648346355679, 0.5045390781252004,
+        0.5046144422476551, 0.5046909422043332, 0.5047685933787501, 0.5048474113388269,
+        0.5049274118403694, 0.5050086108270551, 0.5050910244349985, 0.5051746689892885,
+        0.5052595610144819, 0.505345717229679, 0.5054331545538046, 0.5055218901043484,
+        0.5056119412033959, 0.5057033253807742, 0.5057960603680204, 0.5058901641125253,
+        0.5059856547667549, 0.5060825507020725, 0.5061808705029295, 0.5062806329728399,
+        0.5063818571358226, 0.506484562239522, 0.5065887677528593, 0.5066944933771946,
+        0.5068017590391464, 0.5069105849001039, 0.5070209913530576, 0.5071329990306139,
+        0.507246628800737, 0.507361901776939, 0.5074788393139209, 0.5075974630126698,
+        0.5077177947244095, 0.5078398565526583, 0.5079636708502505, 0.5080892602308125,
+        0.5082166475650566, 0.5083458559857793, 0.5084769088900094, 0.5086098299415327,
+        0.5087446430733548, 0.5088813724910338, 0.5090200426749387, 0.5091606783823929,
+        0.5093033046510761, 0.5094479468030787, 0.5095946304451114, 0.5097433814736116,
+        0.5098942260749384, 0.5100471907317918, 0.5102023022234282, 0.5103595876295461,
+        0.5105190743308695, 0.5106807900191409, 0.5108447626910685, 0.5110110206563978,
+        0.5111795925408211, 0.511350507288223, 0.5115237941620411, 0.511699482754438,
+        0.5118776029815951, 0.5120581850895985, 0.5122412596630188, 0.5124268576187706,
+        0.5126150102190639, 0.5128057490644529, 0.5129991061065375, 0.5131951136457212,
+        0.5133938043387712, 0.5135952111941973, 0.5137993675859698, 0.5140063072492244,
+        0.5142160642884935, 0.5144286731766197, 0.5146441687659132, 0.5148625862798965,
+        0.5150839613286836, 0.5153083299054882, 0.5155357283949014, 0.5157661935702273,
+        0.5159997626021002, 0.5162364730636411, 0.5164763629294925, 0.5167194705824057,
+        0.516965834816311, 0.5172154948394754, 0.5174684902813416, 0.5177248611917642,
+        0.5179846480489828, 0.5182478917632146, 0.5185146336774993, 0.5187849155746725,
+        0.5190587796803674, 0.5193362686685215, 0.5196174256612356, 0.5199022942400967,
+        0.5201909184443988, 0.520483342777183, 0.5207796122084114, 0.5210797721828058,
+        0.5213838686219188, 0.5216919479253873, 0.5220040569818035, 0.522320243169409,
+        0.5226405543581243, 0.5229650389181486, 0.5232937457253785, 0.5236267241610503,
+        0.5239640241214849, 0.5243056960173039, 0.5246517907844013, 0.5250023598839055,
+        0.5253574553084194, 0.525717129587066, 0.5260814357903684, 0.5264504275345011,
+        0.5268241589871336, 0.5272026848726717, 0.5275860604724439, 0.5279743416379308,
+        0.5283675847916127, 0.528765846930618, 0.529169185630548, 0.5295776590600564,
+        0.5299913259717844, 0.530410245720864, 0.5308344782640214, 0.5312640841629728,
+        0.5316991245934937, 0.5321396613495499, 0.5325857568508888, 0.5330374741444821,
+        0.5334948769104523, 0.5339580294738538, 0.5344269968012071, 0.534901844515937,
+        0.5353826388922365, 0.5358694468728435, 0.5363623360680912, 0.5368613747618921,
+        0.5373666319181263, 0.5378781771925626, 0.5383960809283808, 0.538920414169081,
+        0.5394512486615932, 0.5399886568676516, 0.5405327119590138, 0.5410834878373187,
+        0.5416410591308881, 0.5422055012027757, 0.54277689016047, 0.543355302858067,
+        0.5439408169035085, 0.544533510671585, 0.5451334632969457, 0.5457407546925941,
+        0.5463554655571159, 0.5469776773681616, 0.5476074724027543, 0.5482449337399976,
+        0.5488901452646512, 0.5495431916777271, 0.5502041584998373, 0.5508731320831304,
+        0.5515501996137163, 0.552235449124775, 0.552928969491617, 0.5536308504549599,
+        0.554341182614988, 0.5550600574437594, 0.5557875672929543, 0.5565238054034692,
+        0.5572688659069139, 0.5580228438365562, 0.5587858351332973, 0.5595579366593807,
+        0.5603392461961013, 0.5611298624571022, 0.561929885098629, 0.5627394147216327,
+        0.5635585528857058, 0.5643874021079873, 0.5652260658823156, 0.5660746486770827,
+        0.5669332559506525, 0.5678019941605864, 0.5686809707573407, 0.5695702942147199,
+        0.5704700740206946, 0.5713804206928879, 0.5723014457877074, 0.5732332619032213,
+        0.5741759826982191, 0.5751297228884535, 0.5760945982638105, 0.5770707256938036,
+        0.5780582231329068, 0.5790572096437026, 0.5800678053861302, 0.5810901316401234,
+        0.582124310809212, 0.583170466433711, 0.5842287231893689, 0.585299206917083,
+        0.5863820446053256, 0.5874773644257835, 0.5885852957234822, 0.5897059690368887,
+        0.5908395161009288, 0.5919860698629217, 0.5931457644875602, 0.5943187353679714,
+        0.5955051191408521, 0.5967050536805596, 0.5979186781305207, 0.5991461328978409,
+        0.6003875596694228, 0.6016431014195169, 0.6029129024240111, 0.6041971082643015,
+        0.6054958658465841, 0.6068093234000103, 0.6081376305041224, 0.6094809380789111,
+        0.6108393984180253, 0.6122131651757828, 0.6136023934020337, 0.6150072395305508,
+        0.616427861404664, 0.617864418287322, 0.6193170708633164, 0.6207859812610781,
+        0.6222713130549772, 0.6237732312856746, 0.6252919024584664, 0.6268274945720858,
+        0.6283801771147249, 0.6299501210838627, 0.631537498997612, 0.6331424849043322,
+        0.6347652543896658, 0.6364059846046113, 0.6380648542572607, 0.6397420436402063,
+        0.6414377346346644, 0.6431521107267933, 0.6448853570189897, 0.646637660236759,
+        0.6484092087510523, 0.6502001925854296, 0.6520108034313244, 0.6538412346512683,
+        0.6556916813078945, 0.6575623401617939, 0.6594534097018256, 0.6613650901319587,
+        0.663297583410261, 0.6652510932527832, 0.6672258251368652, 0.6692219863341335,
+        0.6712397859074305, 0.6732794347330587, 0.6753411455093549, 0.6774251327779627,
+        0.6795316129263824, 0.6816608042163447, 0.6838129267838865, 0.6859882026627239,
+        0.6881868557967353, 0.690409112045643, 0.6926551992159159, 0.6949253470657752,
+        0.6972197873077484, 0.6995387536551425, 0.7018824818023253, 0.7042512094622855,
+        0.7066451763713317, 0.7090646243083201, 0.7115097971100274, 0.7139809406844315,
+        0.716478303022713, 0.7190021342241096, 0.721552686505735, 0.7241302142121004,
+        0.7267349738504949, 0.72936722407809, 0.7320272257458635, 0.7347152418974698,
+        0.7374315377911336, 0.7401763809176861, 0.742950041010552, 0.7457527900669603,
+        0.7485849023656143, 0.7514466544822594, 0.7543383253025272, 0.7572601960463591,
+        0.7602125502766862, 0.7631956739246378, 0.7662098552997708, 0.7692553851108088,
+        0.772332556486069, 0.7754416649819232, 0.7785830086080516, 0.7817568878515108,
+        0.7849636056746021, 0.7882034675500971, 0.7914767814734132, 0.7947838579851604,
+        0.7981250101790425, 0.8015005537313885, 0.8049108069168925, 0.8083560906193055,
+        0.811836728361516, 0.81535304632066, 0.8189053733417508, 0.8224940409607362,
+        0.8261193834353161, 0.8297817377328488, 0.8334814435909833, 0.8372188435013881,
+        0.8409942827528503, 0.8448081094425198, 0.8486606744894677, 0.8525523316686396,
+        0.8564834376191505, 0.8604543518704283, 0.8644654368662384, 0.8685170579733361,
+        0.8726095835158726, 0.8767433847825075, 0.8809188360608485, 0.8851363146497189,
+        0.889396200887649, 0.8936988781642456, 0.8980447329409645, 0.9024341547950465,
+        0.906867536414263, 0.9113452736288798, 0.915867765438698, 0.9204354140254162,
+        0.9250486247865581, 0.9297078063492173, 0.9344133705893135, 0.9391657326698626,
+        0.9439653110408454, 0.9488125274893962, 0.9537078071385547, 0.9586515784810712,
+        0.9636442734083502, 0.9686863272198726, 0.9737781786574076, 0.9789202699288534,
+        0.9841130467248363, 0.9893569582493776, 0.9946524572421833, 1.0,
+    },
+};
+
+}
+
+#endif
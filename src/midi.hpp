@@ -23,6 +23,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <tuple>
 
 #ifdef MPE_EMULATOR_ASSERTIONS
 #include <cstdio>
@@ -44,6 +45,8 @@ typedef Byte Channel;
 typedef Byte Controller;
 typedef Byte Command;
 
+typedef uint32_t SampleOffset;
+
 
 template<typename FloatType>
 inline Byte float_to_byte(FloatType const value) noexcept
@@ -77,6 +80,18 @@ inline FloatType word_to_float(Word const value) noexcept
 }
 
 
+/**
+ * \brief Round a non-negative time offset which is measured in samples, and
+ *        clamp it into the range of \c SampleOffset.
+ */
+inline SampleOffset to_sample_offset(double const time_offset) noexcept
+{
+    constexpr double max = (double)UINT32_MAX;
+
+    return (SampleOffset)std::min(max, std::max(0.0, std::round(time_offset)));
+}
+
+
 /**
  * \note Use the \c MPE_EMULATOR_OVERRIDE macro to mark compile-time
  *       polymorphism.
@@ -143,6 +158,78 @@ class EventHandler
 };
 
 
+/**
+ * \brief Forward each event to all the given event handlers in the given
+ *        order, so that a buffer needs to be parsed only once, regardless of
+ *        the number of handlers which are interested in its contents.
+ *
+ * \note The running status is tracked by the \c FanOutEventHandler object,
+ *       the \c running_status members of the wrapped handlers are not used.
+ */
+template<class... EventHandlerClasses>
+class FanOutEventHandler : public EventHandler
+{
+    public:
+        explicit FanOutEventHandler(EventHandlerClasses&... event_handlers) noexcept;
+
+        void note_off(
+            double const time_offset,
+            Channel const channel,
+            Note const note,
+            Byte const velocity
+        ) noexcept;
+
+        void note_on(
+            double const time_offset,
+            Channel const channel,
+            Note const note,
+            Byte const velocity
+        ) noexcept;
+
+        void aftertouch(
+            double const time_offset,
+            Channel const channel,
+            Note const note,
+            Byte const pressure
+        ) noexcept;
+
+        void control_change(
+            double const time_offset,
+            Channel const channel,
+            Controller const controller,
+            Byte const new_value
+        ) noexcept;
+
+        void program_change(
+            double const time_offset,
+            Channel const channel,
+            Byte const new_program
+        ) noexcept;
+
+        void channel_pressure(
+            double const time_offset,
+            Channel const channel,
+            Byte const pressure
+        ) noexcept;
+
+        void pitch_wheel_change(
+            double const time_offset,
+            Channel const channel,
+            Word const new_value
+        ) noexcept;
+
+        void channel_mode(
+            double const time_offset,
+            Channel const channel,
+            Byte const message,
+            Byte const data
+        ) noexcept;
+
+    private:
+        std::tuple<EventHandlerClasses&...> event_handlers;
+};
+
+
 template<class EventHandlerClass>
 class EventDispatcher
 {
@@ -296,35 +383,35 @@ constexpr Command PITCH_BEND_CHANGE                     = 0xe0;
 constexpr Command CONTROL_CHANGE_ALL_SOUND_OFF          = 0x78;
 
 
+/**
+ * \brief A compact MIDI event with an integer sample offset, small enough for
+ *        storing several events in a single cache line.
+ */
 class Event
 {
     public:
         Event() noexcept
-            : time_offset(0.0),
-            value(0.0),
-            command(NOTE_OFF),
-            channel(0),
+            : sample_offset(0),
+            status(NOTE_OFF),
             data_1(0),
-            data_2(0)
+            data_2(0),
+            flags(0)
         {
         }
 
         Event(
-                double const time_offset,
+                SampleOffset const sample_offset,
                 Command const command,
                 Channel const channel,
                 Byte const data_1 = 0,
                 Byte const data_2 = 0,
-                double const value = 0.0,
                 bool const is_pre_note_on_setup = false
         ) noexcept
-            : time_offset(time_offset),
-            value(value),
-            command(command),
-            channel(channel),
+            : sample_offset(sample_offset),
+            status((Byte)(command | channel)),
             data_1(data_1),
             data_2(data_2),
-            is_pre_note_on_setup(is_pre_note_on_setup)
+            flags(is_pre_note_on_setup ? PRE_NOTE_ON_SETUP : 0)
         {
         }
 
@@ -334,17 +421,49 @@ class Event
         Event& operator=(Event const& event) noexcept = default;
         Event& operator=(Event&& event) noexcept = default;
 
+        Command get_command() const noexcept
+        {
+            return status & COMMAND_MASK;
+        }
+
+        Channel get_channel() const noexcept
+        {
+            return status & CHANNEL_MASK;
+        }
+
+        bool is_pre_note_on_setup() const noexcept
+        {
+            return (flags & PRE_NOTE_ON_SETUP) != 0;
+        }
+
         template<typename Integer>
-        Integer get_sample_offset(
-                double const sample_rate,
-                Integer const last_sample_offset
-        ) const noexcept {
-            return std::min(
-                last_sample_offset,
-                std::max(0, (Integer)std::round(time_offset * sample_rate))
+        Integer get_sample_offset(Integer const last_sample_offset) const noexcept
+        {
+            return (Integer)std::min(
+                sample_offset, (SampleOffset)std::max((Integer)0, last_sample_offset)
             );
         }
 
+        /**
+         * \brief The 7 or 14 bit payload of the event (velocity, controller
+         *        value, etc.) as a number between 0.0 and 1.0.
+         */
+        double get_value() const noexcept
+        {
+            switch (get_command()) {
+                case CHANNEL_PRESSURE:
+                    return byte_to_float<double>(data_1);
+
+                case PITCH_BEND_CHANGE:
+                    return word_to_float<double>(
+                        (Word)(((Word)data_2 << 7) | (Word)data_1)
+                    );
+
+                default:
+                    return byte_to_float<double>(data_2);
+            }
+        }
+
 #ifdef MPE_EMULATOR_ASSERTIONS
         std::string to_string() const noexcept
         {
@@ -352,7 +471,7 @@ class Event
             char const* command_str;
             char buffer[buffer_size];
 
-            switch (this->command) {
+            switch (get_command()) {
                 case NOTE_OFF:          command_str = "NOTE_OFF"; break;
                 case NOTE_ON:           command_str = "NOTE_ON"; break;
                 case AFTERTOUCH:        command_str = "AFTERTOUCH"; break;
@@ -366,30 +485,171 @@ class Event
             snprintf(
                 buffer,
                 buffer_size,
-                "t=%.3f cmd=%s ch=%hhu d1=0x%02hhx d2=0x%02hhx (v=%.3f)%s",
-                time_offset,
+                "t=%u cmd=%s ch=%hhu d1=0x%02hhx d2=0x%02hhx (v=%.3f)%s",
+                (unsigned int)sample_offset,
                 command_str,
-                channel,
+                get_channel(),
                 data_1,
                 data_2,
-                value,
-                is_pre_note_on_setup ? " pre-NOTE_ON setup" : ""
+                get_value(),
+                is_pre_note_on_setup() ? " pre-NOTE_ON setup" : ""
             );
 
             return std::string(buffer);
         }
 #endif
 
-        double time_offset;
-        double value;
-        Command command;
-        Channel channel;
+        SampleOffset sample_offset;
+        Byte status;
         Byte data_1;
         Byte data_2;
-        bool is_pre_note_on_setup;
+        Byte flags;
+
+    private:
+        static constexpr Byte COMMAND_MASK = 0xf0;
+        static constexpr Byte CHANNEL_MASK = 0x0f;
+        static constexpr Byte PRE_NOTE_ON_SETUP = 0x01;
 };
 
 
+static_assert(sizeof(Event) == 8, "Midi::Event is expected to be 8 bytes");
+
+
+template<class... EventHandlerClasses>
+FanOutEventHandler<EventHandlerClasses...>::FanOutEventHandler(
+        EventHandlerClasses&... event_handlers
+) noexcept
+    : EventHandler(),
+    event_handlers(event_handlers...)
+{
+}
+
+
+template<class... EventHandlerClasses>
+void FanOutEventHandler<EventHandlerClasses...>::note_off(
+        double const time_offset,
+        Channel const channel,
+        Note const note,
+        Byte const velocity
+) noexcept {
+    std::apply(
+        [&](EventHandlerClasses&... handlers) {
+            (handlers.note_off(time_offset, channel, note, velocity), ...);
+        },
+        event_handlers
+    );
+}
+
+
+template<class... EventHandlerClasses>
+void FanOutEventHandler<EventHandlerClasses...>::note_on(
+        double const time_offset,
+        Channel const channel,
+        Note const note,
+        Byte const velocity
+) noexcept {
+    std::apply(
+        [&](EventHandlerClasses&... handlers) {
+            (handlers.note_on(time_offset, channel, note, velocity), ...);
+        },
+        event_handlers
+    );
+}
+
+
+template<class... EventHandlerClasses>
+void FanOutEventHandler<EventHandlerClasses...>::aftertouch(
+        double const time_offset,
+        Channel const channel,
+        Note const note,
+        Byte const pressure
+) noexcept {
+    std::apply(
+        [&](EventHandlerClasses&... handlers) {
+            (handlers.aftertouch(time_offset, channel, note, pressure), ...);
+        },
+        event_handlers
+    );
+}
+
+
+template<class... EventHandlerClasses>
+void FanOutEventHandler<EventHandlerClasses...>::control_change(
+        double const time_offset,
+        Channel const channel,
+        Controller const controller,
+        Byte const new_value
+) noexcept {
+    std::apply(
+        [&](EventHandlerClasses&... handlers) {
+            (handlers.control_change(time_offset, channel, controller, new_value), ...);
+        },
+        event_handlers
+    );
+}
+
+
+template<class... EventHandlerClasses>
+void FanOutEventHandler<EventHandlerClasses...>::program_change(
+        double const time_offset,
+        Channel const channel,
+        Byte const new_program
+) noexcept {
+    std::apply(
+        [&](EventHandlerClasses&... handlers) {
+            (handlers.program_change(time_offset, channel, new_program), ...);
+        },
+        event_handlers
+    );
+}
+
+
+template<class... EventHandlerClasses>
+void FanOutEventHandler<EventHandlerClasses...>::channel_pressure(
+        double const time_offset,
+        Channel const channel,
+        Byte const pressure
+) noexcept {
+    std::apply(
+        [&](EventHandlerClasses&... handlers) {
+            (handlers.channel_pressure(time_offset, channel, pressure), ...);
+        },
+        event_handlers
+    );
+}
+
+
+template<class... EventHandlerClasses>
+void FanOutEventHandler<EventHandlerClasses...>::pitch_wheel_change(
+        double const time_offset,
+        Channel const channel,
+        Word const new_value
+) noexcept {
+    std::apply(
+        [&](EventHandlerClasses&... handlers) {
+            (handlers.pitch_wheel_change(time_offset, channel, new_value), ...);
+        },
+        event_handlers
+    );
+}
+
+
+template<class... EventHandlerClasses>
+void FanOutEventHandler<EventHandlerClasses...>::channel_mode(
+        double const time_offset,
+        Channel const channel,
+        Byte const message,
+        Byte const data
+) noexcept {
+    std::apply(
+        [&](EventHandlerClasses&... handlers) {
+            (handlers.channel_mode(time_offset, channel, message, data), ...);
+        },
+        event_handlers
+    );
+}
+
+
 template<class EventHandlerClass>
 size_t EventDispatcher<EventHandlerClass>::dispatch_events(
         EventHandlerClass& event_handler,
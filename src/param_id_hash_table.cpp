@@ -0,0 +1,323 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+This file is generated by scripts/gen_param_id_hash_table.py, do not edit.
+*/
+
+#ifndef MPE_EMULATOR__PARAM_ID_HASH_TABLE_CPP
+#define MPE_EMULATOR__PARAM_ID_HASH_TABLE_CPP
+
+#include <cstdint>
+
+#include "proxy.hpp"
+
+
+namespace MpeEmulator
+{
+
+uint64_t const Proxy::ParamIdHashTable::MULTIPLIER = 0x366f42687c7dd491;
+
+
+uint64_t const Proxy::ParamIdHashTable::KEYS[ENTRIES] = {
+    0x000042463352315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000053523552315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000000535553315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000042443352315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000043533652315a,
+    0x0000000000000000, 0x000042463852315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000054443152315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000042443852315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000052543452315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000054443652315a,
+    0x0000504d3552315a, 0x0000000000000000, 0x000056493552315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000052543952315a, 0x0000554f3452315a,
+    0x0000000000000000, 0x00004c443152315a, 0x0000564e3452315a, 0x0000004e4843315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x00004c523452315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000554f3952315a, 0x0000000000000000, 0x00004c443652315a, 0x0000564e3952315a,
+    0x0000000000000000, 0x00004e493552315a, 0x0000000000000000, 0x0000000000000000,
+    0x000000484e45315a, 0x0000000000000000, 0x000042463152315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000053523352315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x00004c523952315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000042443152315a, 0x0000000000000000, 0x00000056524f315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000043533452315a, 0x000042463652315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000053523852315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000042443652315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000043533952315a, 0x000052543252315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000054443452315a, 0x0000504d3352315a, 0x0000000000000000,
+    0x000056493352315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000000415254315a, 0x0000000000000000, 0x0000000000000000,
+    0x000052543752315a, 0x0000000000000000, 0x0000554f3252315a, 0x0000000000000000,
+    0x0000564e3252315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000054443952315a, 0x0000504d3852315a,
+    0x0000000000000000, 0x000056493852315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x00004c523252315a, 0x0000000000000000, 0x0000554f3752315a, 0x0000000000000000,
+    0x00004c443452315a, 0x0000564e3752315a, 0x0000000000000000, 0x00004e493352315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000053523152315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x00004c523752315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x00004c443952315a, 0x0000000000000000, 0x0000000000000000,
+    0x00004e493852315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000043533252315a, 0x000042463452315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000053523652315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000042443452315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000043533752315a, 0x0000000000000000, 0x000042463952315a, 0x000000505954315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x00000000004d434d, 0x000054443252315a,
+    0x0000504d3152315a, 0x0000000000000000, 0x000056493152315a, 0x0000000000000000,
+    0x000042443952315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000052543552315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000054443752315a, 0x0000504d3652315a, 0x0000000000000000, 0x000056493652315a,
+    0x0000000000000000, 0x000000505053315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000554f3552315a, 0x0000000000000000, 0x00004c443252315a, 0x0000564e3552315a,
+    0x0000000000000000, 0x00004e493152315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x00004c523552315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000004c5053315a, 0x0000000000000000, 0x00004c443752315a,
+    0x0000000000000000, 0x0000000000000000, 0x00004e493652315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000042463252315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000053523452315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000042443252315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000000485053315a, 0x000043533552315a, 0x0000000000000000,
+    0x000042463752315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000053523952315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000004c5254315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000042443752315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000052543352315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000054443552315a, 0x0000504d3452315a,
+    0x0000000000000000, 0x000056493452315a, 0x0000000000000000, 0x0000000000000000,
+    0x000000485254315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000000434e41315a, 0x000052543852315a, 0x0000000000000000, 0x0000554f3352315a,
+    0x0000000000000000, 0x0000564e3352315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000504d3952315a, 0x0000000000000000, 0x000056493952315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x00004c523352315a, 0x0000000000000000, 0x0000554f3852315a,
+    0x0000000000000000, 0x00004c443552315a, 0x0000564e3852315a, 0x0000000000000000,
+    0x00004e493452315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000053523252315a, 0x000000425254315a, 0x0000000000000000,
+    0x0000000000000000, 0x00004c523852315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x00004e493952315a, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000043533352315a, 0x000042463552315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x000053523752315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000042443552315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000043533852315a, 0x000052543152315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000054443352315a, 0x0000504d3252315a, 0x0000000000000000, 0x000056493252315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000052543652315a,
+    0x0000000000000000, 0x0000554f3152315a, 0x0000000000000000, 0x0000564e3152315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x000054443852315a, 0x0000504d3752315a, 0x0000000000000000,
+    0x000056493752315a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00004c523152315a,
+    0x0000000000000000, 0x0000554f3652315a, 0x0000000000000000, 0x00004c443352315a,
+    0x0000564e3652315a, 0x0000000000000000, 0x00004e493252315a, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00004c523652315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x00004c443852315a, 0x0000000000000000, 0x0000000000000000, 0x00004e493752315a,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000043533152315a,
+};
+
+
+Proxy::ParamId const Proxy::ParamIdHashTable::PARAM_IDS[ENTRIES] = {
+    ParamId::Z1R3FB, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R5RS, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1SUS, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R3DB, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R6SC,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R8FB, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R1DT, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R8DB,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R4TR, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R6DT,
+    ParamId::Z1R5MP, ParamId::INVALID_PARAM_ID, ParamId::Z1R5IV, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R9TR, ParamId::Z1R4OU,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R1DL, ParamId::Z1R4NV, ParamId::Z1CHN,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R4RL, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R9OU, ParamId::INVALID_PARAM_ID, ParamId::Z1R6DL, ParamId::Z1R9NV,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R5IN, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1ENH, ParamId::INVALID_PARAM_ID, ParamId::Z1R1FB, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R3RS, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R9RL, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R1DB, ParamId::INVALID_PARAM_ID, ParamId::Z1ORV, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R4SC, ParamId::Z1R6FB,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R8RS,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R6DB, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R9SC, ParamId::Z1R2TR,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R4DT, ParamId::Z1R3MP, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R3IV, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1TRA, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R7TR, ParamId::INVALID_PARAM_ID, ParamId::Z1R2OU, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R2NV, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R9DT, ParamId::Z1R8MP,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R8IV, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R2RL, ParamId::INVALID_PARAM_ID, ParamId::Z1R7OU, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R4DL, ParamId::Z1R7NV, ParamId::INVALID_PARAM_ID, ParamId::Z1R3IN,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R1RS, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R7RL, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R9DL, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R8IN, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R2SC, ParamId::Z1R4FB, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R6RS, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R4DB,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R7SC, ParamId::INVALID_PARAM_ID, ParamId::Z1R9FB, ParamId::Z1TYP,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::MCM, ParamId::Z1R2DT,
+    ParamId::Z1R1MP, ParamId::INVALID_PARAM_ID, ParamId::Z1R1IV, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R9DB, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R5TR, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R7DT, ParamId::Z1R6MP, ParamId::INVALID_PARAM_ID, ParamId::Z1R6IV,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1SPP, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R5OU, ParamId::INVALID_PARAM_ID, ParamId::Z1R2DL, ParamId::Z1R5NV,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R1IN, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R5RL, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1SPL, ParamId::INVALID_PARAM_ID, ParamId::Z1R7DL,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R6IN, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R2FB,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R4RS,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R2DB, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1SPH, ParamId::Z1R5SC, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R7FB, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R9RS, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1TRL, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R7DB, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R3TR, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R5DT, ParamId::Z1R4MP,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R4IV, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1TRH, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1ANC, ParamId::Z1R8TR, ParamId::INVALID_PARAM_ID, ParamId::Z1R3OU,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R3NV, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R9MP, ParamId::INVALID_PARAM_ID, ParamId::Z1R9IV, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R3RL, ParamId::INVALID_PARAM_ID, ParamId::Z1R8OU,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R5DL, ParamId::Z1R8NV, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R4IN, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R2RS, ParamId::Z1TRB, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R8RL, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R9IN, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R3SC, ParamId::Z1R5FB, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R7RS, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R5DB, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R8SC, ParamId::Z1R1TR, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R3DT, ParamId::Z1R2MP, ParamId::INVALID_PARAM_ID, ParamId::Z1R2IV,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R6TR,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R1OU, ParamId::INVALID_PARAM_ID, ParamId::Z1R1NV,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R8DT, ParamId::Z1R7MP, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R7IV, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R1RL,
+    ParamId::INVALID_PARAM_ID, ParamId::Z1R6OU, ParamId::INVALID_PARAM_ID, ParamId::Z1R3DL,
+    ParamId::Z1R6NV, ParamId::INVALID_PARAM_ID, ParamId::Z1R2IN, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R6RL,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID,
+    ParamId::Z1R8DL, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R7IN,
+    ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::INVALID_PARAM_ID, ParamId::Z1R1SC,
+};
+
+
+char const* const Proxy::PARAM_NAMES[ParamId::PARAM_ID_COUNT] = {
+    "MCM", "Z1TYP", "Z1CHN", "Z1ENH", "Z1ANC", "Z1ORV", "Z1R1IN", "Z1R1OU",
+    "Z1R1IV", "Z1R1TR", "Z1R1DT", "Z1R1DL", "Z1R1MP", "Z1R1RS", "Z1R1NV", "Z1R2IN",
+    "Z1R2OU", "Z1R2IV", "Z1R2TR", "Z1R2DT", "Z1R2DL", "Z1R2MP", "Z1R2RS", "Z1R2NV",
+    "Z1R3IN", "Z1R3OU", "Z1R3IV", "Z1R3TR", "Z1R3DT", "Z1R3DL", "Z1R3MP", "Z1R3RS",
+    "Z1R3NV", "Z1R4IN", "Z1R4OU", "Z1R4IV", "Z1R4TR", "Z1R4DT", "Z1R4DL", "Z1R4MP",
+    "Z1R4RS", "Z1R4NV", "Z1R5IN", "Z1R5OU", "Z1R5IV", "Z1R5TR", "Z1R5DT", "Z1R5DL",
+    "Z1R5MP", "Z1R5RS", "Z1R5NV", "Z1R6IN", "Z1R6OU", "Z1R6IV", "Z1R6TR", "Z1R6DT",
+    "Z1R6DL", "Z1R6MP", "Z1R6RS", "Z1R6NV", "Z1R7IN", "Z1R7OU", "Z1R7IV", "Z1R7TR",
+    "Z1R7DT", "Z1R7DL", "Z1R7MP", "Z1R7RS", "Z1R7NV", "Z1R8IN", "Z1R8OU", "Z1R8IV",
+    "Z1R8TR", "Z1R8DT", "Z1R8DL", "Z1R8MP", "Z1R8RS", "Z1R8NV", "Z1R9IN", "Z1R9OU",
+    "Z1R9IV", "Z1R9TR", "Z1R9DT", "Z1R9DL", "Z1R9MP", "Z1R9RS", "Z1R9NV", "Z1TRB",
+    "Z1TRA", "Z1SUS", "Z1R1FB", "Z1R2FB", "Z1R3FB", "Z1R4FB", "Z1R5FB", "Z1R6FB",
+    "Z1R7FB", "Z1R8FB", "Z1R9FB", "Z1SPL", "Z1SPH", "Z1TRL", "Z1TRH", "Z1SPP",
+    "Z1R1SC", "Z1R2SC", "Z1R3SC", "Z1R4SC", "Z1R5SC", "Z1R6SC", "Z1R7SC", "Z1R8SC",
+    "Z1R9SC", "Z1R1RL", "Z1R2RL", "Z1R3RL", "Z1R4RL", "Z1R5RL", "Z1R6RL", "Z1R7RL",
+    "Z1R8RL", "Z1R9RL", "Z1R1DB", "Z1R2DB", "Z1R3DB", "Z1R4DB", "Z1R5DB", "Z1R6DB",
+    "Z1R7DB", "Z1R8DB", "Z1R9DB",
+};
+
+}
+
+#endif
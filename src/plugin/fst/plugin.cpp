@@ -23,9 +23,11 @@
 #include "plugin/fst/plugin.hpp"
 
 // #include "debug.hpp"
+#include "rt_safety.hpp"
 #include "serializer.hpp"
 #include "spscqueue.cpp"
 #include "strings.hpp"
+#include "trace.hpp"
 
 
 namespace MpeEmulator
@@ -343,6 +345,8 @@ void VSTCALLBACK FstPlugin::process_accumulating(
         float** outdata,
         VstInt32 frames
 ) {
+    MPE_EMULATOR_RT_SCOPE();
+
     MpeEmulator::FstPlugin* const fst_plugin = (MpeEmulator::FstPlugin*)effect->object;
 
     fst_plugin->generate_and_add_samples(frames, indata, outdata);
@@ -355,6 +359,8 @@ void VSTCALLBACK FstPlugin::process_replacing(
         float** outdata,
         VstInt32 frames
 ) {
+    MPE_EMULATOR_RT_SCOPE();
+
     MpeEmulator::FstPlugin* const fst_plugin = (MpeEmulator::FstPlugin*)effect->object;
 
     fst_plugin->generate_samples<float>(frames, outdata);
@@ -367,6 +373,8 @@ void VSTCALLBACK FstPlugin::process_double_replacing(
         double** outdata,
         VstInt32 frames
 ) {
+    MPE_EMULATOR_RT_SCOPE();
+
     MpeEmulator::FstPlugin* const fst_plugin = (MpeEmulator::FstPlugin*)effect->object;
 
     fst_plugin->generate_samples<double>(frames, outdata);
@@ -472,7 +480,7 @@ void FstPlugin::export_parameters(
 ) noexcept {
     for (int param_id = param_id_begin; param_id != param_id_end; ++param_id) {
         parameters[index++] = Parameter(
-            proxy.get_param_name((Proxy::ParamId)param_id).c_str(),
+            proxy.get_param_name((Proxy::ParamId)param_id),
             Strings::PARAMS[param_id],
             (Proxy::ParamId)param_id,
             Proxy::ControllerId::INVALID_CONTROLLER_ID
@@ -487,6 +495,7 @@ FstPlugin::FstPlugin(
         GUI::PlatformData const platform_data
 ) noexcept
     : proxy(),
+    midi_event_handlers(*this, proxy),
     effect(effect),
     host_callback_ptr(host_callback_ptr),
     platform_data(platform_data),
@@ -494,10 +503,12 @@ FstPlugin::FstPlugin(
     to_audio_messages(1024),
     to_audio_string_messages(256),
     to_gui_messages(1024),
+    out_events(NULL),
     serialized_bank(""),
     current_patch(""),
     sample_rate(44100.0),
     current_program_index(0),
+    max_block_size((VstInt32)Proxy::DEFAULT_MAX_BLOCK_SIZE),
     min_samples_before_next_cc_ui_update(8192),
     remaining_samples_before_next_cc_ui_update(0),
     min_samples_before_next_bank_update(16384),
@@ -508,6 +519,7 @@ FstPlugin::FstPlugin(
     need_host_update(false)
 {
     clear_received_midi_cc();
+    initialize_out_events(max_block_size);
 
     window_rect.top = 0;
     window_rect.left = 0;
@@ -516,16 +528,26 @@ FstPlugin::FstPlugin(
 
     populate_parameters(proxy, parameters);
 
+    for (size_t i = 0; i != NUMBER_OF_PARAMETERS; ++i) {
+        /* Parameter values are between 0.0 and 1.0, so this will never match. */
+        param_displays[i].value = -1.0f;
+        param_displays[i].text[0] = '\x00';
+    }
+
     serialized_bank = bank.serialize();
     current_patch = bank[current_program_index].serialize();
 
     program_names.import_names(serialized_bank);
+
+    MPE_EMULATOR_TRACE_START();
 }
 
 
 FstPlugin::~FstPlugin()
 {
     close_gui();
+
+    MPE_EMULATOR_TRACE_STOP();
 }
 
 
@@ -577,6 +599,12 @@ void FstPlugin::handle_change_program(size_t const new_program) noexcept
         return;
     }
 
+    /*
+    Switching programs, and importing or renaming them involves serialization
+    and string copies, which allocate memory.
+    */
+    MPE_EMULATOR_RT_EXEMPT();
+
     size_t const old_program = bank.get_current_program_index();
 
     if (new_program == old_program) {
@@ -597,6 +625,8 @@ void FstPlugin::handle_change_program(size_t const new_program) noexcept
 
 void FstPlugin::handle_rename_program(std::string const& name) noexcept
 {
+    MPE_EMULATOR_RT_EXEMPT(); /* See FstPlugin::handle_change_program() */
+
     size_t const current_program_index = bank.get_current_program_index();
     Bank::Program& current_program = bank[current_program_index];
 
@@ -675,6 +705,8 @@ void FstPlugin::handle_change_param(
 
 void FstPlugin::handle_import_patch(std::string const& patch) noexcept
 {
+    MPE_EMULATOR_RT_EXEMPT(); /* See FstPlugin::handle_change_program() */
+
     size_t const current_program = bank.get_current_program_index();
 
     Serializer::import_settings_in_audio_thread(proxy, patch);
@@ -690,6 +722,8 @@ void FstPlugin::handle_import_patch(std::string const& patch) noexcept
 
 void FstPlugin::handle_import_bank(std::string const& serialized_bank) noexcept
 {
+    MPE_EMULATOR_RT_EXEMPT(); /* See FstPlugin::handle_change_program() */
+
     size_t const current_program = bank.get_current_program_index();
 
     bank.import(serialized_bank);
@@ -815,6 +849,7 @@ VstIntPtr FstPlugin::idle() noexcept
 void FstPlugin::set_sample_rate(double const new_sample_rate) noexcept
 {
     sample_rate = new_sample_rate;
+    proxy.set_sample_rate(new_sample_rate);
 
     process_internal_messages_in_gui_thread();
 
@@ -830,16 +865,22 @@ void FstPlugin::set_sample_rate(double const new_sample_rate) noexcept
         remaining_samples_before_next_bank_update = min_samples_before_next_bank_update;
     }
 
-    proxy.running_status = 0;
-    this->running_status = 0;
+    midi_event_handlers.running_status = 0;
 }
 
 
 void FstPlugin::set_block_size(VstIntPtr const new_block_size) noexcept
 {
     process_internal_messages_in_gui_thread();
-    proxy.running_status = 0;
-    this->running_status = 0;
+
+    /* The buffers are resized in resume(), when the host is not processing. */
+    if (new_block_size > 0) {
+        max_block_size = (VstInt32)std::min(
+            new_block_size, (VstIntPtr)Proxy::MAX_BLOCK_SIZE
+        );
+    }
+
+    midi_event_handlers.running_status = 0;
 }
 
 
@@ -848,17 +889,16 @@ void FstPlugin::suspend() noexcept
     process_internal_messages_in_gui_thread();
     need_idle();
     proxy.suspend();
-    proxy.running_status = 0;
-    this->running_status = 0;
+    midi_event_handlers.running_status = 0;
 }
 
 
 void FstPlugin::resume() noexcept
 {
+    initialize_out_events(max_block_size);
     proxy.resume();
     proxy.begin_processing();
-    proxy.running_status = 0;
-    this->running_status = 0;
+    midi_event_handlers.running_status = 0;
     host_callback(audioMasterWantMidi, 0, 1);
     process_internal_messages_in_gui_thread();
     need_idle();
@@ -867,6 +907,10 @@ void FstPlugin::resume() noexcept
 
 void FstPlugin::process_vst_events(VstEvents const* const events) noexcept
 {
+    MPE_EMULATOR_RT_SCOPE();
+
+    MPE_EMULATOR_TRACE("process VST events", events->numEvents);
+
     clear_received_midi_cc();
 
     for (VstInt32 i = 0; i < events->numEvents; ++i) {
@@ -909,15 +953,12 @@ void FstPlugin::clear_received_midi_cc() noexcept
 
 void FstPlugin::process_vst_midi_event(VstMidiEvent const* const event) noexcept
 {
-    double const time_offset = (double)event->deltaFrames / sample_rate;
+    double const time_offset = (double)event->deltaFrames;
 
     Midi::Byte const* const midi_bytes = (Midi::Byte const*)event->midiData;
 
-    Midi::EventDispatcher<FstPlugin>::dispatch_event(
-        *this, time_offset, midi_bytes, 4
-    );
-    Midi::EventDispatcher<Proxy>::dispatch_event(
-        proxy, time_offset, midi_bytes, 4
+    Midi::EventDispatcher<MidiEventHandlers>::dispatch_event(
+        midi_event_handlers, time_offset, midi_bytes, 4
     );
 }
 
@@ -931,6 +972,8 @@ void FstPlugin::generate_samples(
         return;
     }
 
+    MPE_EMULATOR_TRACE("generate samples: begin", sample_count);
+
     prepare_processing(sample_count);
 
     for (VstInt32 i = 0; i != OUT_CHANNELS; ++i) {
@@ -939,6 +982,8 @@ void FstPlugin::generate_samples(
 
     finalize_processing(sample_count);
 
+    MPE_EMULATOR_TRACE("generate samples: end", sample_count);
+
     /*
     It would be nice to notify the host about param changes that originate from
     the plugin, but since the CC helper parameters are only ever changed by us
@@ -977,6 +1022,7 @@ void FstPlugin::prepare_processing(VstInt32 const sample_count) noexcept
 
 void FstPlugin::finalize_processing(VstInt32 const sample_count) noexcept
 {
+    proxy.end_processing((Midi::SampleOffset)sample_count);
     send_out_events((int)std::max(0, sample_count - 1));
     proxy.begin_processing();
 
@@ -996,6 +1042,12 @@ void FstPlugin::finalize_processing(VstInt32 const sample_count) noexcept
         return;
     }
 
+    /*
+    Serializing the patch and the bank allocates memory; this should be moved
+    out of the audio thread.
+    */
+    MPE_EMULATOR_RT_EXEMPT();
+
     remaining_samples_before_next_bank_update = min_samples_before_next_bank_update;
     need_bank_update = false;
     proxy.clear_dirty_flag();
@@ -1018,44 +1070,87 @@ void FstPlugin::finalize_processing(VstInt32 const sample_count) noexcept
 }
 
 
+void FstPlugin::initialize_out_events(VstInt32 const max_block_size) noexcept
+{
+    proxy.reserve_out_events((size_t)max_block_size);
+
+    /*
+    The proxy never produces more events in a block than its buffer can hold,
+    so a pool of the same size lets send_out_events() hand over all of them
+    to the host in a single list.
+    */
+    size_t const capacity = proxy.out_events.capacity();
+
+    if (out_event_buffer.size() == capacity) {
+        return;
+    }
+
+    size_t const list_size = (
+        (sizeof(VstEvents_) + (capacity - 2) * sizeof(VstMidiEvent*) + sizeof(VstIntPtr) - 1)
+        / sizeof(VstIntPtr)
+    );
+
+    /*
+    Swapping with freshly allocated vectors lets a shrinking block size give
+    memory back, which assign() or resize() would keep.
+
+    Only the timing and the MIDI bytes are different for each outgoing event,
+    so everything else is filled in only once, and send_out_events() needs to
+    touch only the used prefix of the pool.
+    */
+    std::vector<VstIntPtr>(list_size, 0).swap(out_events_storage);
+    std::vector<VstMidiEvent>(capacity, VstMidiEvent()).swap(out_event_buffer);
+
+    out_events = (VstEvents_*)out_events_storage.data();
+
+    for (size_t i = 0; i != capacity; ++i) {
+        VstMidiEvent* const vst_midi_event = &out_event_buffer[i];
+
+        vst_midi_event->type = kVstMidiType;
+        vst_midi_event->byteSize = sizeof(VstMidiEvent);
+
+        out_events->events[i] = vst_midi_event;
+    }
+}
+
+
 void FstPlugin::send_out_events(int const last_sample_offset) noexcept
 {
+    if (proxy.out_events.empty()) {
+        return;
+    }
+
+    size_t const capacity = out_event_buffer.size();
     size_t next_vst_event_idx = 0;
 
-    memset(&out_events, 0, sizeof(VstEvents_));
+    for (Proxy::OutEvents::const_iterator it = proxy.out_events.begin(); it != proxy.out_events.end(); ++it) {
+        /*
+        Many hosts treat each audioMasterProcessEvents call as a replacement
+        of the previous list of the block, so everything has to go in one.
+        */
+        if (MPE_EMULATOR_UNLIKELY(next_vst_event_idx == capacity)) {
+            proxy.count_dropped_events(
+                (unsigned int)(proxy.out_events.end() - it)
+            );
 
-    out_events.numEvents = 0;
+            break;
+        }
 
-    for (Proxy::OutEvents::const_iterator it = proxy.out_events.begin(); it != proxy.out_events.end(); ++it) {
         Midi::Event const& midi_event(*it);
         VstMidiEvent* const vst_midi_event = &out_event_buffer[next_vst_event_idx];
 
-        memset(vst_midi_event, 0, sizeof(VstMidiEvent));
-
-        vst_midi_event->type = kVstMidiType;
-        vst_midi_event->byteSize = sizeof(VstMidiEvent);
         vst_midi_event->deltaFrames = (
-            midi_event.get_sample_offset<int>(sample_rate, last_sample_offset)
+            midi_event.get_sample_offset<int>(last_sample_offset)
         );
-        vst_midi_event->midiData[0] = midi_event.command | midi_event.channel;
+        vst_midi_event->midiData[0] = midi_event.status;
         vst_midi_event->midiData[1] = midi_event.data_1;
         vst_midi_event->midiData[2] = midi_event.data_2;
 
-        out_events.events[next_vst_event_idx] = vst_midi_event;
-
         ++next_vst_event_idx;
-
-        if (next_vst_event_idx == OUT_EVENTS_BUFFER_SIZE) {
-            out_events.numEvents = (int)next_vst_event_idx;
-            host_callback(audioMasterProcessEvents, 0, 0, (void*)&out_events);
-            next_vst_event_idx = 0;
-        }
     }
 
-    if (next_vst_event_idx != 0) {
-        out_events.numEvents = (int)next_vst_event_idx;
-        host_callback(audioMasterProcessEvents, 0, 0, (void*)&out_events);
-    }
+    out_events->numEvents = (int)next_vst_event_idx;
+    host_callback(audioMasterProcessEvents, 0, 0, (void*)out_events);
 }
 
 
@@ -1429,13 +1524,29 @@ void FstPlugin::get_param_display(size_t index, char* const buffer) noexcept
     float const value = param.get_value(proxy);
 
     if (param.is_exported_param()) {
-        Strings::param_ratio_to_str(
-            proxy, param.get_param_id(), value, buffer, kVstMaxParamStrLen
+        strncpy(
+            buffer,
+            Strings::param_ratio_to_display_str(proxy, param.get_param_id(), value),
+            kVstMaxParamStrLen
         );
-    } else {
-        snprintf(buffer, kVstMaxParamStrLen, "%.2f%%", value * 100.0f);
         buffer[kVstMaxParamStrLen - 1] = '\x00';
+
+        return;
     }
+
+    /*
+    Hosts poll the display strings of the MIDI CC helper parameters on their
+    UI timer as well, but those values change much less often.
+    */
+    ParamDisplay& display = param_displays[index];
+
+    if (display.value != value) {
+        snprintf(display.text, kVstMaxParamStrLen, "%.2f%%", value * 100.0f);
+        display.text[kVstMaxParamStrLen - 1] = '\x00';
+        display.value = value;
+    }
+
+    memcpy(buffer, display.text, kVstMaxParamStrLen);
 }
 
 
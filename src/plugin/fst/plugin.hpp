@@ -22,6 +22,7 @@
 
 #include <string>
 #include <bitset>
+#include <vector>
 
 #include <fst/fst.h>
 
@@ -88,7 +89,12 @@ class FstPlugin : public Midi::EventHandler
             + 1                                         /* Dummy Parameter */
         );
 
-        static constexpr size_t PATCH_CHANGED_PARAMETER_INDEX = (size_t)Proxy::ParamId::Z1SUS;
+        static constexpr size_t PATCH_CHANGED_PARAMETER_INDEX = (
+            (size_t)Proxy::ControllerId::MAX_MIDI_CC + 1
+            + 1                                         /* Pitch Wheel */
+            + 1                                         /* Channel Pressure */
+            + (size_t)Proxy::ParamId::Z1SUS
+        );
         static constexpr char const* PATCH_CHANGED_PARAMETER_SHORT_NAME = "Changed";
         static constexpr char const* PATCH_CHANGED_PARAMETER_LONG_NAME = "Settings Changed";
 
@@ -261,7 +267,7 @@ class FstPlugin : public Midi::EventHandler
             1.0 / BANK_UPDATE_FREQUENCY
         );
 
-        static constexpr size_t OUT_EVENTS_BUFFER_SIZE = 16384;
+        typedef Midi::FanOutEventHandler<FstPlugin, Proxy> MidiEventHandlers;
 
         enum MessageType {
             NONE = 0,
@@ -313,11 +319,26 @@ class FstPlugin : public Midi::EventHandler
                 MessageType type;
         };
 
+        /**
+         * \brief The most recently formatted display string of a parameter
+         *        which is not backed by a Proxy parameter.
+         */
+        class ParamDisplay
+        {
+            public:
+                float value;
+                char text[kVstMaxParamStrLen];
+        };
+
+        /**
+         * \brief Header of the event list that is sent to the host, followed
+         *        by a variable length array of event pointers.
+         */
         struct VstEvents_
         {
             int numEvents;
             VstIntPtr _pad;
-            VstMidiEvent* events[OUT_EVENTS_BUFFER_SIZE];
+            VstMidiEvent* events[2];
         };
 
         VstIntPtr host_callback(
@@ -337,6 +358,7 @@ class FstPlugin : public Midi::EventHandler
         ) noexcept;
 
         void clear_received_midi_cc() noexcept;
+        void initialize_out_events(VstInt32 const max_block_size) noexcept;
 
         void prepare_processing(VstInt32 const sample_count) noexcept;
         void finalize_processing(VstInt32 const sample_count) noexcept;
@@ -377,6 +399,9 @@ class FstPlugin : public Midi::EventHandler
         void handle_proxy_was_dirty() noexcept;
 
         Parameters parameters;
+        ParamDisplay param_displays[NUMBER_OF_PARAMETERS];
+
+        MidiEventHandlers midi_event_handlers;
 
         AEffect* const effect;
         audioMasterCallback const host_callback_ptr;
@@ -390,12 +415,14 @@ class FstPlugin : public Midi::EventHandler
         SPSCQueue<Message> to_gui_messages;
         Bank bank;
         Bank program_names;
-        VstEvents_ out_events;
-        VstMidiEvent out_event_buffer[OUT_EVENTS_BUFFER_SIZE];
+        std::vector<VstIntPtr> out_events_storage;
+        std::vector<VstMidiEvent> out_event_buffer;
+        VstEvents_* out_events;
         std::string serialized_bank;
         std::string current_patch;
         double sample_rate;
         size_t current_program_index;
+        VstInt32 max_block_size;
         VstInt32 min_samples_before_next_cc_ui_update;
         VstInt32 remaining_samples_before_next_cc_ui_update;
         VstInt32 min_samples_before_next_bank_update;
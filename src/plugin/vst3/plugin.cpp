@@ -46,8 +46,10 @@
 #endif
 
 #include "midi.hpp"
+#include "rt_safety.hpp"
 #include "serializer.hpp"
 #include "strings.hpp"
+#include "trace.hpp"
 
 
 using namespace Steinberg;
@@ -131,10 +133,11 @@ FUnknown* Vst3Plugin::Processor::createInstance(void* unused)
 
 Vst3Plugin::Processor::Processor()
     : proxy(),
-    events(8192),
+    events(),
     sample_rate(44100.0)
 {
     setControllerClass(Controller::ID);
+    events.reserve(IN_EVENTS_CAPACITY);
 }
 
 
@@ -155,10 +158,20 @@ tresult PLUGIN_API Vst3Plugin::Processor::initialize(FUnknown* context)
     */
     addAudioOutput(STR16("AudioOutput"), Vst::SpeakerArr::kStereo);
 
+    MPE_EMULATOR_TRACE_START();
+
     return kResultOk;
 }
 
 
+tresult PLUGIN_API Vst3Plugin::Processor::terminate()
+{
+    MPE_EMULATOR_TRACE_STOP();
+
+    return AudioEffect::terminate();
+}
+
+
 tresult PLUGIN_API Vst3Plugin::Processor::setBusArrangements(
     Vst::SpeakerArrangement* inputs,
     int32 number_of_inputs,
@@ -219,6 +232,11 @@ tresult PLUGIN_API Vst3Plugin::Processor::setupProcessing(Vst::ProcessSetup& set
     double const sample_rate = (double)setup.sampleRate;
 
     this->sample_rate = sample_rate > 0.0 ? sample_rate : 44100.0;
+    proxy.set_sample_rate(this->sample_rate);
+
+    if (setup.maxSamplesPerBlock > 0) {
+        proxy.reserve_out_events((size_t)setup.maxSamplesPerBlock);
+    }
 
     return AudioEffect::setupProcessing(setup);
 }
@@ -260,18 +278,26 @@ void Vst3Plugin::Processor::share_proxy() noexcept
 
 tresult PLUGIN_API Vst3Plugin::Processor::process(Vst::ProcessData& data)
 {
+    MPE_EMULATOR_RT_SCOPE();
+
+    MPE_EMULATOR_TRACE("process: begin", data.numSamples);
+
     proxy.begin_processing();
     collect_note_events(data);
     collect_param_change_events(data);
     std::sort(events.begin(), events.end());
     process_events();
     events.clear();
+    proxy.end_processing((Midi::SampleOffset)std::max(0, data.numSamples));
 
     if (data.outputEvents != NULL) {
         generate_out_events(*data.outputEvents, std::max(0, data.numSamples - 1));
     }
 
     if (proxy.is_dirty()) {
+        /* allocateMessage() allocates, and some hosts deliver the message synchronously. */
+        MPE_EMULATOR_RT_EXEMPT();
+
         proxy.clear_dirty_flag();
         MPE_EMULATOR_VST3_SEND_EMPTY_MSG(MSG_PROXY_DIRTY);
     }
@@ -282,10 +308,24 @@ tresult PLUGIN_API Vst3Plugin::Processor::process(Vst::ProcessData& data)
 
     generate_samples(data);
 
+    MPE_EMULATOR_TRACE("process: end", data.numSamples);
+
     return kResultOk;
 }
 
 
+void Vst3Plugin::Processor::collect_event(Event const& event) noexcept
+{
+    if (MPE_EMULATOR_UNLIKELY(events.size() == events.capacity())) {
+        proxy.count_dropped_events(1);
+
+        return;
+    }
+
+    events.push_back(event);
+}
+
+
 void Vst3Plugin::Processor::collect_param_change_events(
         Vst::ProcessData& data
 ) noexcept {
@@ -351,10 +391,10 @@ void Vst3Plugin::Processor::collect_param_change_events_as_midi_ctl(
             continue;
         }
 
-        events.push_back(
+        collect_event(
             Event(
                 event_type,
-                (double)sample_offset / sample_rate,
+                (double)sample_offset,
                 midi_controller,
                 0,
                 (double)value
@@ -388,10 +428,10 @@ void Vst3Plugin::Processor::collect_param_change_events_as_exported_param(
             continue;
         }
 
-        events.push_back(
+        collect_event(
             Event(
                 Event::Type::PARAM_CHANGE,
-                (double)sample_offset / sample_rate,
+                (double)sample_offset,
                 (Midi::Byte)vst3_param_tag_to_proxy_param_id(param_tag),
                 0,
                 (double)value
@@ -419,10 +459,10 @@ void Vst3Plugin::Processor::collect_note_events(Vst::ProcessData& data) noexcept
 
         switch (event.type) {
             case Vst::Event::EventTypes::kNoteOnEvent:
-                events.push_back(
+                collect_event(
                     Event(
                         Event::Type::NOTE_ON,
-                        (double)event.sampleOffset / sample_rate,
+                        (double)event.sampleOffset,
                         (Midi::Byte)event.noteOn.pitch,
                         (Midi::Channel)(event.noteOn.channel & 0xff),
                         (double)event.noteOn.velocity
@@ -431,10 +471,10 @@ void Vst3Plugin::Processor::collect_note_events(Vst::ProcessData& data) noexcept
                 break;
 
             case Vst::Event::EventTypes::kNoteOffEvent:
-                events.push_back(
+                collect_event(
                     Event(
                         Event::Type::NOTE_OFF,
-                        (double)event.sampleOffset / sample_rate,
+                        (double)event.sampleOffset,
                         (Midi::Byte)event.noteOff.pitch,
                         (Midi::Channel)(event.noteOff.channel & 0xff),
                         (double)event.noteOff.velocity
@@ -443,10 +483,10 @@ void Vst3Plugin::Processor::collect_note_events(Vst::ProcessData& data) noexcept
                 break;
 
             case Vst::Event::EventTypes::kPolyPressureEvent:
-                events.push_back(
+                collect_event(
                     Event(
                         Event::Type::NOTE_PRESSURE,
-                        (double)event.sampleOffset / sample_rate,
+                        (double)event.sampleOffset,
                         (Midi::Byte)event.polyPressure.pitch,
                         (Midi::Channel)(event.polyPressure.channel & 0xff),
                         (double)event.polyPressure.pressure
@@ -568,10 +608,10 @@ void Vst3Plugin::Processor::generate_out_events(
     for (Proxy::OutEvents::const_iterator it = proxy.out_events.begin(); it != proxy.out_events.end(); ++it) {
         Midi::Event const& midi_event(*it);
         int32 const sample_offset = (
-            midi_event.get_sample_offset<int32>(sample_rate, last_sample_offset)
+            midi_event.get_sample_offset<int32>(last_sample_offset)
         );
 
-        switch (midi_event.command) {
+        switch (midi_event.get_command()) {
             case Midi::NOTE_OFF:
                 Vst::Helpers::init(
                     vst_event,
@@ -581,7 +621,7 @@ void Vst3Plugin::Processor::generate_out_events(
                     0,
                     Vst::Event::EventFlags::kIsLive
                 );
-                vst_event.noteOff.channel = midi_event.channel;
+                vst_event.noteOff.channel = midi_event.get_channel();
                 vst_event.noteOff.pitch = midi_event.data_1;
                 vst_event.noteOff.velocity = Midi::byte_to_float<float>(midi_event.data_2);
                 vst_event.noteOff.noteId = -1;
@@ -598,7 +638,7 @@ void Vst3Plugin::Processor::generate_out_events(
                     0,
                     Vst::Event::EventFlags::kIsLive
                 );
-                vst_event.noteOn.channel = midi_event.channel;
+                vst_event.noteOn.channel = midi_event.get_channel();
                 vst_event.noteOn.pitch = midi_event.data_1;
                 vst_event.noteOn.tuning = 0.0f;
                 vst_event.noteOn.velocity = Midi::byte_to_float<float>(midi_event.data_2);
@@ -613,10 +653,10 @@ void Vst3Plugin::Processor::generate_out_events(
                     sample_offset,
                     last_sample_offset,
                     midi_event.data_1,
-                    midi_event.channel,
+                    midi_event.get_channel(),
                     midi_event.data_2,
                     0,
-                    midi_event.is_pre_note_on_setup
+                    midi_event.is_pre_note_on_setup()
                 );
 
                 break;
@@ -627,10 +667,10 @@ void Vst3Plugin::Processor::generate_out_events(
                     sample_offset,
                     last_sample_offset,
                     Vst::ControllerNumbers::kAfterTouch,
-                    midi_event.channel,
+                    midi_event.get_channel(),
                     midi_event.data_1,
                     0,
-                    midi_event.is_pre_note_on_setup
+                    midi_event.is_pre_note_on_setup()
                 );
 
                 break;
@@ -641,10 +681,10 @@ void Vst3Plugin::Processor::generate_out_events(
                     sample_offset,
                     last_sample_offset,
                     Vst::ControllerNumbers::kPitchBend,
-                    midi_event.channel,
+                    midi_event.get_channel(),
                     midi_event.data_1,
                     midi_event.data_2,
-                    midi_event.is_pre_note_on_setup
+                    midi_event.is_pre_note_on_setup()
                 );
 
                 break;
@@ -1021,7 +1061,7 @@ Vst::Parameter* Vst3Plugin::Controller::create_exported_param(
             0,
             Vst::ParameterInfo::kCanAutomate,
             Vst::kRootUnitId,
-            USTRING(proxy.get_param_name(param_id).c_str())
+            USTRING(proxy.get_param_name(param_id))
         );
         param->setPrecision(1);
 
@@ -1033,7 +1073,7 @@ Vst::Parameter* Vst3Plugin::Controller::create_exported_param(
             NULL,
             Vst::ParameterInfo::kIsList,
             Vst::kRootUnitId,
-            USTRING(proxy.get_param_name(param_id).c_str())
+            USTRING(proxy.get_param_name(param_id))
         );
 
         for (size_t i = param_id == Proxy::ParamId::Z1CHN ? 1 : 0; i != number_of_options; ++i) {
@@ -1114,7 +1154,7 @@ tresult PLUGIN_API Vst3Plugin::Controller::notify(Vst::IMessage* message)
         }
     } else if (FIDStringsEqual(message->getMessageID(), MSG_PROXY_DIRTY)) {
         if (proxy != NULL) {
-            update_params();
+            update_changed_params();
         }
 
         /*
@@ -1138,8 +1178,49 @@ void Vst3Plugin::Controller::update_params()
     constexpr int param_begin = (int)Proxy::ParamId::MCM;
     constexpr int param_end = (int)Proxy::ParamId::INVALID_PARAM_ID;
 
+    Proxy::ChangedParams changed_params;
+
+    /*
+    All parameters are about to be synchronized, so the changes that have
+    piled up so far can be discarded. Changes that happen during the loop
+    are flagged again, and will be picked up by update_changed_params().
+    */
+    proxy->collect_changed_params(changed_params, Proxy::ChangedParamsReader::CPR_HOST);
+
+    for (int i = param_begin; i != param_end; ++i) {
+        Proxy::ParamId const param_id = (Proxy::ParamId)i;
+        setParamNormalized(
+            proxy_param_id_to_vst3_param_tag(param_id),
+            proxy->get_param_ratio_atomic(param_id)
+        );
+    }
+}
+
+
+void Vst3Plugin::Controller::update_changed_params()
+{
+    constexpr int param_begin = (int)Proxy::ParamId::MCM;
+    constexpr int param_end = (int)Proxy::ParamId::INVALID_PARAM_ID;
+
+    Proxy::ChangedParams changed_params;
+
+    /*
+    Several MSG_PROXY_DIRTY notifications may arrive before the controller
+    gets to process them, but only the first one will find anything to do.
+    */
+    proxy->collect_changed_params(changed_params, Proxy::ChangedParamsReader::CPR_HOST);
+
+    if (changed_params.is_empty()) {
+        return;
+    }
+
     for (int i = param_begin; i != param_end; ++i) {
         Proxy::ParamId const param_id = (Proxy::ParamId)i;
+
+        if (!changed_params.contains(param_id)) {
+            continue;
+        }
+
         setParamNormalized(
             proxy_param_id_to_vst3_param_tag(param_id),
             proxy->get_param_ratio_atomic(param_id)
@@ -104,6 +104,7 @@ class Vst3Plugin
                 Processor();
 
                 tresult PLUGIN_API initialize(FUnknown* context) SMTG_OVERRIDE;
+                tresult PLUGIN_API terminate() SMTG_OVERRIDE;
 
                 tresult PLUGIN_API setBusArrangements(
                     Vst::SpeakerArrangement* inputs,
@@ -128,8 +129,17 @@ class Vst3Plugin
                 tresult PLUGIN_API getState(IBStream* state) SMTG_OVERRIDE;
 
             private:
+                /*
+                Automation may deliver a point on every sample for many
+                parameters, independently of the size of the output, so the
+                incoming event buffer is not sized from the block size.
+                */
+                static constexpr size_t IN_EVENTS_CAPACITY = 8192;
+
                 void share_proxy() noexcept;
 
+                void collect_event(Event const& event) noexcept;
+
                 void collect_param_change_events(Vst::ProcessData& data) noexcept;
 
                 void collect_param_change_events_as_midi_ctl(
@@ -262,6 +272,7 @@ class Vst3Plugin
                 Vst::Parameter* set_up_patch_changed_param() const;
 
                 void update_params();
+                void update_changed_params();
 
                 Proxy* proxy;
 
@@ -27,31 +27,34 @@
 #include "proxy.hpp"
 
 #include "midi.hpp"
+#include "rt_safety.hpp"
+#include "trace.hpp"
 
 #include "math.cpp"
+#include "param_id_hash_table.cpp"
 #include "note_stack.cpp"
 #include "queue.cpp"
+#include "seqlock.cpp"
 #include "spscqueue.cpp"
+#include "triple_buffer.cpp"
+
+#ifdef MPE_EMULATOR_TRACE_LOG
+#include "trace.cpp"
+#endif
 
 
 namespace MpeEmulator
 {
 
-Proxy::ParamIdHashTable Proxy::param_id_hash_table;
-
-std::string Proxy::param_names_by_id[ParamId::PARAM_ID_COUNT];
-
 
 Proxy::Param::Param(
-        std::string const& name,
         unsigned int const min_value,
         unsigned int const max_value,
         unsigned int const default_value
 ) noexcept
-    : name(name),
-    min_value_dbl((double)min_value),
-    range_dbl((double)(max_value - min_value)),
-    range_inv(1.0 / range_dbl),
+    : ratio(0.0),
+    range_inv(1.0 / (double)(max_value - min_value)),
+    value(0),
     min_value(min_value),
     max_value(max_value),
     default_value(default_value)
@@ -60,12 +63,6 @@ Proxy::Param::Param(
 }
 
 
-std::string const& Proxy::Param::get_name() const noexcept
-{
-    return name;
-}
-
-
 unsigned int Proxy::Param::get_min_value() const noexcept
 {
     return min_value;
@@ -98,7 +95,9 @@ double Proxy::Param::value_to_ratio(unsigned int const value) const noexcept
 
 double Proxy::Param::ratio_to_value(double const ratio) const noexcept
 {
-    return clamp_value(min_value + (unsigned int)std::round(range_dbl * ratio));
+    return clamp_value(
+        min_value + (unsigned int)std::round((double)(max_value - min_value) * ratio)
+    );
 }
 
 
@@ -135,33 +134,29 @@ void Proxy::Param::set_ratio(double const new_ratio) noexcept
 
 
 Proxy::Rule::Rule(
-        std::string const& name,
         ControllerId const in_cc,
         ControllerId const out_cc,
         Target const target,
         unsigned int const init_value_,
         Reset const reset
 ) noexcept
-    : in_cc(name + "IN", ControllerId::BANK_SELECT, ControllerId::NONE, in_cc),
-    out_cc(name + "OU", ControllerId::BANK_SELECT, ControllerId::NONE, out_cc),
-    init_value(name + "IV", 0, 16383, init_value_),
-    target(
-        name + "TR",
-        Target::TRG_GLOBAL,
-        Target::TRG_NEWEST_ABOVE_ANCHOR,
-        target
-    ),
+    : in_cc(ControllerId::BANK_SELECT, ControllerId::NONE, in_cc),
+    out_cc(ControllerId::BANK_SELECT, ControllerId::NONE, out_cc),
+    init_value(0, 16383, init_value_),
+    target(Target::TRG_GLOBAL, Target::TRG_NEWEST_ABOVE_ANCHOR, target),
     distortion_type(
-        name + "DT",
         Math::DistortionCurve::DIST_CURVE_SMOOTH_SMOOTH,
         Math::DistortionCurve::DIST_CURVE_SHARP_SHARP,
         Math::DistortionCurve::DIST_CURVE_SMOOTH_SMOOTH
     ),
-    distortion_level(name + "DL", 0, 16383, 0),
-    midpoint(name + "MP", 0, 20000, 10000),
-    reset(name + "RS", Reset::RST_OFF, Reset::RST_INIT, reset),
-    invert(name + "NV", Toggle::OFF, Toggle::ON, Toggle::OFF),
-    fallback(name + "FB", Toggle::OFF, Toggle::ON, Toggle::OFF),
+    distortion_level(0, 16383, 0),
+    midpoint(0, 20000, 10000),
+    reset(Reset::RST_OFF, Reset::RST_INIT, reset),
+    invert(Toggle::OFF, Toggle::ON, Toggle::OFF),
+    fallback(Toggle::OFF, Toggle::ON, Toggle::OFF),
+    split_scope(SplitScope::SCP_ALL, SplitScope::SCP_SPLIT_4, SplitScope::SCP_ALL),
+    rate_limit(RateLimit::RL_OFF, RateLimit::RL_25_HZ, RateLimit::RL_OFF),
+    deadband(0, DEADBAND_MAX, 0),
     last_input_value(init_value.get_ratio())
 {
 }
@@ -182,14 +177,20 @@ double Proxy::Rule::distort(double const value) const noexcept
 }
 
 
-bool Proxy::Rule::needs_reset_for_note_event(
-        bool const is_above_anchor
-) const noexcept {
+bool Proxy::Rule::needs_reset_for_note_event(Split const split) const noexcept
+{
     if ((Proxy::Reset)reset.get_value() == Proxy::Reset::RST_OFF) {
         return false;
     }
 
+    SplitScope const scope = (SplitScope)split_scope.get_value();
+
+    if (scope != SplitScope::SCP_ALL && (int)scope - 1 != (int)split) {
+        return false;
+    }
+
     Proxy::Target const target = (Proxy::Target)this->target.get_value();
+    bool const is_above_anchor = split >= Split::SPL_ABOVE_ANCHOR;
 
     return (
         target != Proxy::Target::TRG_GLOBAL
@@ -216,39 +217,47 @@ double Proxy::Rule::get_reset_value() const noexcept
 
 
 Proxy::Proxy() noexcept
-    : send_mcm("MCM", Toggle::OFF, Toggle::ON, Toggle::OFF),
-    zone_type(
-        "Z1TYP", ZoneType::ZT_LOWER, ZoneType::ZT_UPPER, ZoneType::ZT_LOWER
-    ),
-    channels("Z1CHN", 1, 15, 15),
+    : send_mcm(Toggle::OFF, Toggle::ON, Toggle::OFF),
+    zone_type(ZoneType::ZT_LOWER, ZoneType::ZT_UPPER, ZoneType::ZT_LOWER),
+    channels(1, 15, 15),
     excess_note_handling(
-        "Z1ENH",
         ExcessNoteHandling::ENH_IGNORE,
         ExcessNoteHandling::ENH_STEAL_NEWEST,
         ExcessNoteHandling::ENH_STEAL_OLDEST
     ),
-    anchor("Z1ANC", 0, 127, 60),
-    override_release_velocity("Z1ORV", Toggle::OFF, Toggle::ON, Toggle::OFF),
-    transpose_below_anchor("Z1TRB", 0, 96, 48),
-    transpose_above_anchor("Z1TRA", 0, 96, 48),
-    sustain_pedal_handling("Z1SUS", Toggle::OFF, Toggle::ON, Toggle::OFF),
+    anchor(0, 127, 60),
+    override_release_velocity(Toggle::OFF, Toggle::ON, Toggle::OFF),
+    transpose_below_anchor(0, 96, 48),
+    transpose_above_anchor(0, 96, 48),
+    sustain_pedal_handling(Toggle::OFF, Toggle::ON, Toggle::OFF),
+    lower_split_point(0, 127, 0),
+    upper_split_point(0, 127, 127),
+    transpose_below_lower_split(0, 96, 48),
+    transpose_above_upper_split(0, 96, 48),
+    separate_split_channels(Toggle::OFF, Toggle::ON, Toggle::OFF),
     rules{
-        Rule("Z1R1", ControllerId::PITCH_WHEEL, ControllerId::PITCH_WHEEL, Target::TRG_NEWEST, 8192),
-        Rule("Z1R2", ControllerId::CHANNEL_PRESSURE, ControllerId::CHANNEL_PRESSURE, Target::TRG_NEWEST, 0),
-        Rule("Z1R3", ControllerId::SOUND_5, ControllerId::SOUND_5, Target::TRG_NEWEST, 8192),
-        Rule("Z1R4"),
-        Rule("Z1R5"),
-        Rule("Z1R6"),
-        Rule("Z1R7"),
-        Rule("Z1R8"),
-        Rule("Z1R9"),
+        Rule(ControllerId::PITCH_WHEEL, ControllerId::PITCH_WHEEL, Target::TRG_NEWEST, 8192),
+        Rule(ControllerId::CHANNEL_PRESSURE, ControllerId::CHANNEL_PRESSURE, Target::TRG_NEWEST, 0),
+        Rule(ControllerId::SOUND_5, ControllerId::SOUND_5, Target::TRG_NEWEST, 8192),
+        Rule(),
+        Rule(),
+        Rule(),
+        Rule(),
+        Rule(),
+        Rule(),
     },
     out_events(out_events_rw),
-    messages(MESSAGE_QUEUE_SIZE),
     is_suspended(false),
     is_dirty_(false),
     had_reset(false),
-    is_sustain_pedal_on(false)
+    is_sustain_pedal_on(false),
+    has_voice_stats_changed(false),
+    has_separate_split_channels(false),
+    gesture_end_samples(0),
+    elapsed_samples(0),
+    sample_rate(44100.0),
+    param_snapshot_sequence(0),
+    messages(MESSAGE_QUEUE_SIZE)
 {
     std::fill_n(channels_by_notes, Midi::NOTES, Midi::INVALID_CHANNEL);
     std::fill_n(deferred_note_off_velocities, Midi::NOTES, 64);
@@ -287,39 +296,74 @@ Proxy::Proxy() noexcept
         register_param((ParamId)(param_id++), rules[i].fallback);
     }
 
+    MPE_EMULATOR_ASSERT((ParamId)param_id == ParamId::Z1SPL);
+
+    register_param((ParamId)(param_id++), lower_split_point);
+    register_param((ParamId)(param_id++), upper_split_point);
+    register_param((ParamId)(param_id++), transpose_below_lower_split);
+    register_param((ParamId)(param_id++), transpose_above_upper_split);
+    register_param((ParamId)(param_id++), separate_split_channels);
+
+    MPE_EMULATOR_ASSERT((ParamId)param_id == ParamId::Z1R1SC);
+
+    for (size_t i = 0; i != RULES; ++i) {
+        register_param((ParamId)(param_id++), rules[i].split_scope);
+    }
+
+    MPE_EMULATOR_ASSERT((ParamId)param_id == ParamId::Z1R1RL);
+
+    for (size_t i = 0; i != RULES; ++i) {
+        register_param((ParamId)(param_id++), rules[i].rate_limit);
+    }
+
+    MPE_EMULATOR_ASSERT((ParamId)param_id == ParamId::Z1R1DB);
+
+    for (size_t i = 0; i != RULES; ++i) {
+        register_param((ParamId)(param_id++), rules[i].deadband);
+    }
+
     for (size_t i = 0; i != (size_t)ParamId::PARAM_ID_COUNT; ++i) {
         param_ratios_atomic[i].store(params[i]->get_ratio());
     }
 
+    for (size_t reader = 0; reader != ChangedParamsReader::CPR_COUNT; ++reader) {
+        for (size_t i = 0; i != ChangedParams::WORDS; ++i) {
+            changed_params_atomic[reader][i].store(0);
+        }
+    }
+
     ZoneTypeDescriptor const& ztd = ZONE_TYPES[zone_type.get_value()];
 
+    offset_below_lower_split = 0;
     offset_below_anchor = 0;
     offset_above_anchor = 0;
+    offset_above_upper_split = 0;
+    lower_split_point_ = (Midi::Note)lower_split_point.get_value();
     anchor_ = (Midi::Note)anchor.get_value();
+    upper_split_point_ = (Midi::Note)upper_split_point.get_value();
     channel_count = channels.get_value();
     manager_channel = ztd.manager_channel;
     channel_increment = ztd.channel_increment;
     first_channel = manager_channel + channel_increment;
     last_channel = manager_channel + channel_increment * channel_count;
 
+    update_split_tables();
     reset_available_channels();
+    update_rate_limit_intervals();
 
+    voice_stats_atomic.store(voice_stats);
     active_voices_count_atomic.store(0);
     channel_count_atomic.store(channel_count);
+    suppressed_duplicates_count_atomic.store(0);
+    dropped_events_count_atomic.store(0);
 
-    out_events_rw.reserve(32768);
+    out_events_rw.reserve(get_out_events_capacity(DEFAULT_MAX_BLOCK_SIZE));
 }
 
 
 void Proxy::register_param(ParamId const param_id, Param& param) noexcept
 {
-    std::string const& name = param.get_name();
-
-    param_id_hash_table.add(name, param_id);
-
-    if (param_names_by_id[param_id].length() == 0) {
-        param_names_by_id[param_id] = name;
-    }
+    MPE_EMULATOR_ASSERT(ParamIdHashTable::lookup(PARAM_NAMES[param_id]) == param_id);
 
     params[(size_t)param_id] = &param;
 }
@@ -327,14 +371,128 @@ void Proxy::register_param(ParamId const param_id, Param& param) noexcept
 
 void Proxy::reset_available_channels() noexcept
 {
+    Midi::Channel pool_sizes[Split::SPLITS] = {0, 0, 0, 0};
     Midi::Channel channel = first_channel;
 
-    available_channels.clear();
+    for (size_t i = 0; i != Split::SPLITS; ++i) {
+        available_channels[i].clear();
+    }
+
+    /*
+    All call sites stop every note before rebuilding the pool, so the channel
+    states can be rebuilt from scratch as well.
+    */
+    std::fill_n(
+        voice_stats.channel_states,
+        (size_t)Midi::CHANNELS,
+        (Midi::Byte)VoiceStats::ChannelState::CS_UNUSED
+    );
+    std::fill_n(voice_stats.notes, (size_t)Midi::CHANNELS, 0);
+
+    set_channel_state(manager_channel, VoiceStats::ChannelState::CS_MANAGER, 0);
+
+    if (has_separate_split_channels) {
+        /*
+        Splits which don't contain any notes with the current split points
+        don't need channels, the rest get an equal share, and the lower splits
+        get the remainder.
+        */
+        bool is_split_used[Split::SPLITS] = {false, false, false, false};
+        Midi::Channel used_splits = 0;
+
+        for (size_t i = 0; i != Midi::NOTES; ++i) {
+            is_split_used[splits_by_notes[i]] = true;
+        }
+
+        for (size_t i = 0; i != Split::SPLITS; ++i) {
+            used_splits += is_split_used[i] ? 1 : 0;
+        }
+
+        Midi::Channel const share = channel_count / used_splits;
+        Midi::Channel remainder = channel_count % used_splits;
+
+        for (size_t i = 0; i != Split::SPLITS; ++i) {
+            pools_by_splits[i] = (Midi::Byte)i;
+
+            if (!is_split_used[i]) {
+                continue;
+            }
+
+            pool_sizes[i] = share;
+
+            if (remainder != 0) {
+                ++pool_sizes[i];
+                --remainder;
+            }
+        }
+    } else {
+        std::fill_n(pools_by_splits, (size_t)Split::SPLITS, 0);
+        pool_sizes[0] = channel_count;
+    }
+
+    for (size_t pool = 0; pool != Split::SPLITS; ++pool) {
+        for (Midi::Channel i = 0; i != pool_sizes[pool]; ++i) {
+            available_channels[pool].push(channel);
+            set_channel_state(channel, VoiceStats::ChannelState::CS_FREE, 0);
+            channel += channel_increment;
+        }
+    }
+
+    voice_stats.active_voices = 0;
+    voice_stats.channel_count = channel_count;
+}
+
 
-    for (Midi::Channel i = 0; i != channel_count; ++i) {
-        available_channels.push(channel);
-        channel += channel_increment;
+void Proxy::update_split_tables() noexcept
+{
+    int const offsets[Split::SPLITS] = {
+        offset_below_lower_split,
+        offset_below_anchor,
+        offset_above_anchor,
+        offset_above_upper_split,
+    };
+
+    for (size_t i = 0; i != Midi::NOTES; ++i) {
+        Midi::Note const note = (Midi::Note)i;
+        Split const split = (
+            note < anchor_
+                ? (note < lower_split_point_ ? Split::SPL_BELOW_LOWER : Split::SPL_BELOW_ANCHOR)
+                : (note > upper_split_point_ ? Split::SPL_ABOVE_UPPER : Split::SPL_ABOVE_ANCHOR)
+        );
+
+        splits_by_notes[i] = (Midi::Byte)split;
+        transposed_notes[i] = (Midi::Note)std::max(
+            0, std::min(127, (int)note + offsets[split])
+        );
+    }
+}
+
+
+void Proxy::set_channel_state(
+        Midi::Channel const channel,
+        VoiceStats::ChannelState const state,
+        Midi::Note const note
+) noexcept {
+    if (MPE_EMULATOR_UNLIKELY(channel > Midi::CHANNEL_MAX)) {
+        return;
+    }
+
+    voice_stats.channel_states[channel] = (Midi::Byte)state;
+    voice_stats.notes[channel] = note;
+    has_voice_stats_changed = true;
+}
+
+
+void Proxy::publish_voice_stats() noexcept
+{
+    if (!has_voice_stats_changed) {
+        return;
     }
+
+    has_voice_stats_changed = false;
+
+    voice_stats_atomic.store(voice_stats);
+    active_voices_count_atomic.store(voice_stats.active_voices);
 }
 
 
@@ -352,11 +510,21 @@ bool Proxy::is_lock_free() const noexcept
         is_lock_free = param_ratios_atomic[i].is_lock_free();
     }
 
+    for (size_t reader = 0; reader != ChangedParamsReader::CPR_COUNT; ++reader) {
+        for (size_t i = 0; is_lock_free && i != ChangedParams::WORDS; ++i) {
+            is_lock_free = changed_params_atomic[reader][i].is_lock_free();
+        }
+    }
+
     return (
         is_lock_free
         && messages.is_lock_free()
+        && param_snapshots.is_lock_free()
+        && voice_stats_atomic.is_lock_free()
         && active_voices_count_atomic.is_lock_free()
         && channel_count_atomic.is_lock_free()
+        && suppressed_duplicates_count_atomic.is_lock_free()
+        && dropped_events_count_atomic.is_lock_free()
     );
 }
 #endif
@@ -399,81 +567,148 @@ unsigned int Proxy::get_channel_count() const noexcept
 }
 
 
+Proxy::VoiceStats Proxy::get_voice_stats() const noexcept
+{
+    return voice_stats_atomic.load();
+}
+
+
+unsigned int Proxy::get_suppressed_duplicates_count() const noexcept
+{
+    return suppressed_duplicates_count_atomic.load();
+}
+
+
+unsigned int Proxy::get_dropped_events_count() const noexcept
+{
+    return dropped_events_count_atomic.load();
+}
+
+
+void Proxy::count_dropped_events(unsigned int const count) noexcept
+{
+    dropped_events_count_atomic.fetch_add(count);
+}
+
+
 void Proxy::note_on(
         double const time_offset,
         Midi::Channel const channel,
         Midi::Note const note,
         Midi::Byte const velocity
 ) noexcept {
-    if (is_suspended) {
+    Midi::SampleOffset const sample_offset = Midi::to_sample_offset(time_offset);
+
+    MPE_EMULATOR_TRACE("note on", sample_offset, channel, note, velocity);
+
+    if (
+            is_suspended
+            || is_duplicate(
+                DuplicateFilter::EventType::NOTE_ON, note, sample_offset, velocity
+            )
+    ) {
         return;
     }
 
+    duplicate_filter.forget(DuplicateFilter::EventType::NOTE_OFF, note);
+
     bool const already_on = note_stack.find(note);
 
     if (MPE_EMULATOR_UNLIKELY(already_on)) {
         if ((ExcessNoteHandling)excess_note_handling.get_value() == ExcessNoteHandling::ENH_IGNORE) {
+            ++voice_stats.dropped_notes;
+            has_voice_stats_changed = true;
+
             return;
         }
 
         Midi::Channel const steal_channel = channels_by_notes[note];
 
-        push_note_off(time_offset, steal_channel, note, 64);
-        push_note_on(time_offset, steal_channel, note, velocity);
+        ++voice_stats.retriggered_notes;
+
+        push_note_off(sample_offset, steal_channel, note, 64);
+        push_note_on(sample_offset, steal_channel, note, velocity);
 
         return;
     }
 
-    if (MPE_EMULATOR_UNLIKELY(available_channels.is_empty())) {
-        if (MPE_EMULATOR_UNLIKELY(note_stack.is_empty())) {
-            MPE_EMULATOR_ASSERT_NOT_REACHED();
+    Split const split = (Split)splits_by_notes[note];
+    Queue<Midi::Channel, MPE_MEMBER_CHANNELS_MAX>& pool = (
+        available_channels[pools_by_splits[split]]
+    );
+
+    if (MPE_EMULATOR_UNLIKELY(pool.is_empty())) {
+        NoteStack const& steal_candidates = (
+            has_separate_split_channels ? note_stacks_by_splits[split] : note_stack
+        );
+
+        if (MPE_EMULATOR_UNLIKELY(steal_candidates.is_empty())) {
+            /*
+            When there are fewer channels than splits, then some of the splits
+            may end up without any channels of their own.
+            */
+            MPE_EMULATOR_ASSERT(has_separate_split_channels);
+
+            ++voice_stats.dropped_notes;
+            has_voice_stats_changed = true;
 
             return;
         }
 
+        ExcessNoteHandling const policy = (
+            (ExcessNoteHandling)excess_note_handling.get_value()
+        );
         Midi::Note steal_note;
 
-        switch ((ExcessNoteHandling)excess_note_handling.get_value()) {
+        switch (policy) {
             case ExcessNoteHandling::ENH_STEAL_LOWEST:
-                steal_note = note_stack.lowest();
+                steal_note = steal_candidates.lowest();
                 break;
 
             case ExcessNoteHandling::ENH_STEAL_HIGHEST:
-                steal_note = note_stack.highest();
+                steal_note = steal_candidates.highest();
                 break;
 
             case ExcessNoteHandling::ENH_STEAL_OLDEST:
-                steal_note = note_stack.oldest();
+                steal_note = steal_candidates.oldest();
                 break;
 
             case ExcessNoteHandling::ENH_STEAL_NEWEST:
-                steal_note = note_stack.top();
+                steal_note = steal_candidates.top();
                 break;
 
             default:
+                ++voice_stats.dropped_notes;
+                has_voice_stats_changed = true;
+
                 return;
         }
 
         Midi::Channel const steal_channel = channels_by_notes[steal_note];
 
-        push_note_off(time_offset, steal_channel, steal_note, 64);
-        push_note_on(time_offset, steal_channel, note, velocity);
+        ++voice_stats.steals[policy];
+
+        push_note_off(sample_offset, steal_channel, steal_note, 64);
+        push_note_on(sample_offset, steal_channel, note, velocity);
     } else {
-        Midi::Channel allocated_channel = available_channels.pop();
-        push_note_on(time_offset, allocated_channel, note, velocity);
+        Midi::Channel allocated_channel = pool.pop();
+        push_note_on(sample_offset, allocated_channel, note, velocity);
     }
 }
 
 
 void Proxy::push_note_on(
-        double const time_offset,
+        Midi::SampleOffset const sample_offset,
         Midi::Channel const channel,
         Midi::Note const note,
         Midi::Byte velocity
 ) noexcept {
+    Split const split = (Split)splits_by_notes[note];
+
     NoteStack::ChannelStats old_channel_stats(channel_stats);
     NoteStack::ChannelStats old_channel_stats_below(channel_stats_below);
     NoteStack::ChannelStats old_channel_stats_above(channel_stats_above);
+    NoteStack::ChannelStats old_channel_stats_split(channel_stats_by_splits[split]);
 
     bool const is_first_note = note_stack.is_empty();
 
@@ -483,35 +718,45 @@ void Proxy::push_note_on(
 
     note_stack.make_stats(channels_by_notes, channel_stats);
 
-    bool const is_above_anchor = note >= anchor_;
+    ++voice_stats.active_voices;
+    voice_stats.peak_voices = std::max(
+        voice_stats.peak_voices, voice_stats.active_voices
+    );
+    set_channel_state(channel, VoiceStats::ChannelState::CS_ACTIVE, note);
+
+    note_stacks_by_splits[split].push(note);
+    note_stacks_by_splits[split].make_stats(
+        channels_by_notes, channel_stats_by_splits[split]
+    );
+    active_channels_by_splits[split].add(channel);
 
-    if (is_above_anchor) {
+    if (split >= Split::SPL_ABOVE_ANCHOR) {
         note_stack_above.push(note);
         note_stack_above.make_stats(channels_by_notes, channel_stats_above);
+        active_channels_above.add(channel);
     } else {
         note_stack_below.push(note);
         note_stack_below.make_stats(channels_by_notes, channel_stats_below);
+        active_channels_below.add(channel);
     }
 
     push_resets_for_new_note<true>(
-        time_offset,
+        sample_offset,
         channel,
         is_first_note,
-        is_above_anchor,
+        split,
         old_channel_stats,
         old_channel_stats_below,
-        old_channel_stats_above
+        old_channel_stats_above,
+        old_channel_stats_split
     );
 
     push_out_event(
-        Midi::Event(
-            time_offset,
-            Midi::NOTE_ON,
-            channel,
-            transpose(note, is_above_anchor),
-            velocity,
-            Midi::byte_to_float<double>(velocity)
-        )
+        sample_offset,
+        Midi::NOTE_ON,
+        channel,
+        transposed_notes[note],
+        velocity
     );
 
     /*
@@ -521,53 +766,60 @@ void Proxy::push_note_on(
     a setup sequence both before and after the Note On.
     */
     push_resets_for_new_note<false>(
-        time_offset,
+        sample_offset,
         channel,
         is_first_note,
-        is_above_anchor,
+        split,
         old_channel_stats,
         old_channel_stats_below,
-        old_channel_stats_above
+        old_channel_stats_above,
+        old_channel_stats_split
     );
 }
 
 
-Midi::Note Proxy::transpose(
-        Midi::Note const note,
-        bool const is_above_anchor
-) const noexcept {
-    int const offset = (
-        is_above_anchor ? offset_above_anchor : offset_below_anchor
-    );
-
-    return (Midi::Note)std::max(0, std::min(127, (int)note + offset));
-}
+void Proxy::push_out_event(
+        Midi::SampleOffset const sample_offset,
+        Midi::Command const command,
+        Midi::Channel const channel,
+        Midi::Byte const data_1,
+        Midi::Byte const data_2,
+        bool const is_pre_note_on_setup
+) noexcept {
+    if (MPE_EMULATOR_UNLIKELY(channel > Midi::CHANNEL_MAX)) {
+        return;
+    }
 
+    if (MPE_EMULATOR_UNLIKELY(out_events_rw.size() == out_events_rw.capacity())) {
+        MPE_EMULATOR_TRACE("out events full");
+        dropped_events_count_atomic.fetch_add(1);
 
-void Proxy::push_out_event(Midi::Event const& event) noexcept
-{
-    if (MPE_EMULATOR_UNLIKELY(event.channel > Midi::CHANNEL_MAX)) {
         return;
     }
 
-    out_events_rw.push_back(event);
+    out_events_rw.push_back(
+        Midi::Event(
+            sample_offset, command, channel, data_1, data_2, is_pre_note_on_setup
+        )
+    );
 }
 
 
 template<bool is_pre_note_on_setup>
 void Proxy::push_resets_for_new_note(
-        double const time_offset,
+        Midi::SampleOffset const sample_offset,
         Midi::Channel const new_note_channel,
         bool const is_first_note,
-        bool const is_above_anchor,
+        Split const split,
         NoteStack::ChannelStats const& old_channel_stats,
         NoteStack::ChannelStats const& old_channel_stats_below,
-        NoteStack::ChannelStats const& old_channel_stats_above
+        NoteStack::ChannelStats const& old_channel_stats_above,
+        NoteStack::ChannelStats const& old_channel_stats_split
 ) noexcept {
     for (size_t i = 0; i != RULES; ++i) {
         Rule const& rule = rules[i];
 
-        if (!rule.needs_reset_for_note_event(is_above_anchor)) {
+        if (!rule.needs_reset_for_note_event(split)) {
             continue;
         }
 
@@ -575,24 +827,37 @@ void Proxy::push_resets_for_new_note(
         ControllerId const out_cc = (ControllerId)rule.out_cc.get_value();
 
         if constexpr (is_pre_note_on_setup) {
-            reset_outdated_targets_if_changed(
-                rule,
-                time_offset,
-                new_note_channel,
-                old_channel_stats,
-                old_channel_stats_below,
-                old_channel_stats_above,
-                channel_stats,
-                channel_stats_below,
-                channel_stats_above,
-                reset_value,
-                out_cc
-            );
+            if ((SplitScope)rule.split_scope.get_value() != SplitScope::SCP_ALL) {
+                reset_outdated_split_target_if_changed(
+                    rule,
+                    sample_offset,
+                    new_note_channel,
+                    split,
+                    old_channel_stats_split,
+                    channel_stats_by_splits[split],
+                    reset_value,
+                    out_cc
+                );
+            } else {
+                reset_outdated_targets_if_changed(
+                    rule,
+                    sample_offset,
+                    new_note_channel,
+                    old_channel_stats,
+                    old_channel_stats_below,
+                    old_channel_stats_above,
+                    channel_stats,
+                    channel_stats_below,
+                    channel_stats_above,
+                    reset_value,
+                    out_cc
+                );
+            }
         }
 
         if (is_first_note && (Toggle)rule.fallback.get_value() == Toggle::ON) {
-            push_controller_event(
-                time_offset,
+            push_reset_event(
+                sample_offset,
                 manager_channel,
                 out_cc,
                 reset_value,
@@ -601,7 +866,7 @@ void Proxy::push_resets_for_new_note(
         }
 
         push_controller_event(
-            time_offset,
+            sample_offset,
             new_note_channel,
             out_cc,
             reset_value,
@@ -613,7 +878,7 @@ void Proxy::push_resets_for_new_note(
 
 void Proxy::reset_outdated_targets_if_changed(
         Rule const& rule,
-        double const time_offset,
+        Midi::SampleOffset const sample_offset,
         Midi::Channel const new_note_channel,
         NoteStack::ChannelStats const& a_channel_stats,
         NoteStack::ChannelStats const& a_channel_stats_below,
@@ -722,13 +987,155 @@ void Proxy::reset_outdated_targets_if_changed(
     }
 
     if (channel != Midi::INVALID_CHANNEL && channel != new_note_channel) {
-        push_controller_event(time_offset, channel, out_cc, reset_value);
+        push_reset_event(sample_offset, channel, out_cc, reset_value);
+    }
+}
+
+
+void Proxy::reset_outdated_split_target_if_changed(
+        Rule const& rule,
+        Midi::SampleOffset const sample_offset,
+        Midi::Channel const new_note_channel,
+        Split const split,
+        NoteStack::ChannelStats const& a_channel_stats,
+        NoteStack::ChannelStats const& b_channel_stats,
+        double const reset_value,
+        ControllerId const out_cc
+) noexcept {
+    Target const target = (Target)rule.target.get_value();
+    Midi::Channel const channel = (
+        get_split_target_channel(target, split, a_channel_stats)
+    );
+
+    if (
+            channel != Midi::INVALID_CHANNEL
+            && channel != new_note_channel
+            && channel != get_split_target_channel(target, split, b_channel_stats)
+    ) {
+        push_reset_event(sample_offset, channel, out_cc, reset_value);
+    }
+}
+
+
+Midi::Channel Proxy::get_split_target_channel(
+        Target const target,
+        Split const split,
+        NoteStack::ChannelStats const& channel_stats
+) noexcept {
+    bool const is_above_anchor = split >= Split::SPL_ABOVE_ANCHOR;
+
+    switch (target) {
+        case Target::TRG_LOWEST_BELOW_ANCHOR:
+        case Target::TRG_HIGHEST_BELOW_ANCHOR:
+        case Target::TRG_OLDEST_BELOW_ANCHOR:
+        case Target::TRG_NEWEST_BELOW_ANCHOR:
+            if (is_above_anchor) {
+                return Midi::INVALID_CHANNEL;
+            }
+
+            break;
+
+        case Target::TRG_LOWEST_ABOVE_ANCHOR:
+        case Target::TRG_HIGHEST_ABOVE_ANCHOR:
+        case Target::TRG_OLDEST_ABOVE_ANCHOR:
+        case Target::TRG_NEWEST_ABOVE_ANCHOR:
+            if (!is_above_anchor) {
+                return Midi::INVALID_CHANNEL;
+            }
+
+            break;
+
+        default:
+            break;
+    }
+
+    switch (target) {
+        case Target::TRG_LOWEST:
+        case Target::TRG_LOWEST_BELOW_ANCHOR:
+        case Target::TRG_LOWEST_ABOVE_ANCHOR:
+            return channel_stats.lowest;
+
+        case Target::TRG_HIGHEST:
+        case Target::TRG_HIGHEST_BELOW_ANCHOR:
+        case Target::TRG_HIGHEST_ABOVE_ANCHOR:
+            return channel_stats.highest;
+
+        case Target::TRG_OLDEST:
+        case Target::TRG_OLDEST_BELOW_ANCHOR:
+        case Target::TRG_OLDEST_ABOVE_ANCHOR:
+            return channel_stats.oldest;
+
+        case Target::TRG_NEWEST:
+        case Target::TRG_NEWEST_BELOW_ANCHOR:
+        case Target::TRG_NEWEST_ABOVE_ANCHOR:
+            return channel_stats.newest;
+
+        default:
+            return Midi::INVALID_CHANNEL;
+    }
+}
+
+
+Proxy::ActiveChannels::Mask Proxy::get_split_target_channels(
+        Target const target,
+        Split const split
+) const noexcept {
+    bool const is_above_anchor = split >= Split::SPL_ABOVE_ANCHOR;
+
+    switch (target) {
+        case Target::TRG_GLOBAL:
+            return ActiveChannels::to_mask(manager_channel);
+
+        case Target::TRG_ALL_BELOW_ANCHOR:
+            return is_above_anchor ? 0 : active_channels_by_splits[split].get_mask();
+
+        case Target::TRG_ALL_ABOVE_ANCHOR:
+            return is_above_anchor ? active_channels_by_splits[split].get_mask() : 0;
+
+        default:
+            /*
+            The channel stats of the split are kept up to date by every Note On
+            and Note Off, so single note targets don't need to walk the split's
+            note stack.
+            */
+            return ActiveChannels::to_mask(
+                get_split_target_channel(target, split, channel_stats_by_splits[split])
+            );
+    }
+}
+
+
+void Proxy::push_reset_event(
+        Midi::SampleOffset const sample_offset,
+        Midi::Channel const channel,
+        ControllerId const controller_id,
+        double const value,
+        bool const is_pre_note_on_setup
+) noexcept {
+    /*
+    A value that a rate limit or a deadband held back before the reset is
+    outdated, it must not overwrite the reset later.
+    */
+    drop_held_controller_values(channel, controller_id);
+
+    if (
+            output_state.holds(
+                channel,
+                controller_id,
+                encode_controller_value(controller_id, value)
+            )
+    ) {
+        return;
     }
+
+    push_controller_event(
+        sample_offset, channel, controller_id, value, is_pre_note_on_setup
+    );
 }
 
 
 void Proxy::push_controller_event(
-        double const time_offset,
+        Midi::SampleOffset const sample_offset,
         Midi::Channel const channel,
         ControllerId const controller_id,
         double const value,
@@ -736,74 +1143,229 @@ void Proxy::push_controller_event(
 ) noexcept {
     if (controller_id == ControllerId::PITCH_WHEEL) {
         push_controller_event<Midi::PITCH_BEND_CHANGE>(
-            time_offset, channel, controller_id, value, is_pre_note_on_setup
+            sample_offset, channel, controller_id, value, is_pre_note_on_setup
         );
     } else if (controller_id == ControllerId::CHANNEL_PRESSURE) {
         push_controller_event<Midi::CHANNEL_PRESSURE>(
-            time_offset, channel, controller_id, value, is_pre_note_on_setup
+            sample_offset, channel, controller_id, value, is_pre_note_on_setup
         );
     } else if (controller_id <= ControllerId::MAX_MIDI_CC) {
         push_controller_event<Midi::CONTROL_CHANGE>(
-            time_offset, channel, controller_id, value, is_pre_note_on_setup
+            sample_offset, channel, controller_id, value, is_pre_note_on_setup
         );
     }
 }
 
 
-template<Midi::Command midi_command>
-void Proxy::push_controller_event(
-        double const time_offset,
+Midi::Word Proxy::encode_controller_value(
+        ControllerId const controller_id,
+        double const value
+) noexcept {
+    return controller_id == ControllerId::PITCH_WHEEL
+        ? Midi::float_to_word<double>(value)
+        : (Midi::Word)Midi::float_to_byte<double>(value);
+}
+
+
+void Proxy::push_rate_limited_controller_event(
+        size_t const rule_index,
+        Midi::SampleOffset const sample_offset,
+        Midi::Channel const channel,
+        ControllerId const controller_id,
+        double const value
+) noexcept {
+    if (MPE_EMULATOR_UNLIKELY(channel > Midi::CHANNEL_MAX)) {
+        return;
+    }
+
+    Rule const& rule = rules[rule_index];
+    size_t const slot_index = RateLimiter::get_slot_index(rule_index, channel);
+    RateLimiter::Slot& slot = rate_limiter.slots[slot_index];
+    RateLimiter::Time const now = elapsed_samples + (RateLimiter::Time)sample_offset;
+    RateLimiter::Time const interval = (
+        rate_limit_intervals[rule.rate_limit.get_value()]
+    );
+    Midi::Word const new_value = encode_controller_value(controller_id, value);
+    Midi::Word const last_value = output_state.get(channel, controller_id);
+
+    if (new_value == last_value) {
+        /* The output is already there, anything that was held back is outdated. */
+        rate_limiter.release(slot_index);
+
+        return;
+    }
+
+    if (last_value != OutputState::UNKNOWN) {
+        Midi::Word const deadband = (Midi::Word)(
+            controller_id == ControllerId::PITCH_WHEEL
+                ? rule.deadband.get_value() << 7
+                : rule.deadband.get_value()
+        );
+        Midi::Word const change = (
+            new_value > last_value ? new_value - last_value : last_value - new_value
+        );
+
+        if (change < deadband) {
+            RateLimiter::Time const deadline = now + gesture_end_samples;
+
+            rate_limiter.hold(
+                slot_index,
+                slot.last_sent == RateLimiter::NEVER
+                    ? deadline
+                    : std::max(deadline, slot.last_sent + interval),
+                controller_id,
+                value
+            );
+
+            return;
+        }
+    }
+
+    if (slot.last_sent != RateLimiter::NEVER && now - slot.last_sent < interval) {
+        rate_limiter.hold(slot_index, slot.last_sent + interval, controller_id, value);
+
+        return;
+    }
+
+    rate_limiter.release(slot_index);
+    slot.last_sent = now;
+
+    push_controller_event(sample_offset, channel, controller_id, value);
+}
+
+
+void Proxy::push_held_controller_events(
+        RateLimiter::Time const next_block_time
+) noexcept {
+    size_t i = 0;
+
+    while (i < rate_limiter.held_count) {
+        size_t const slot_index = (size_t)rate_limiter.held[i];
+        RateLimiter::Slot& slot = rate_limiter.slots[slot_index];
+
+        if (slot.deadline >= next_block_time) {
+            ++i;
+
+            continue;
+        }
+
+        /* Releasing moves the last held slot into position i. */
+        rate_limiter.release(slot_index);
+
+        Midi::Channel const channel = RateLimiter::get_channel(slot_index);
+
+        if (
+                output_state.holds(
+                    channel,
+                    slot.controller_id,
+                    encode_controller_value(slot.controller_id, slot.value)
+                )
+        ) {
+            continue;
+        }
+
+        slot.last_sent = slot.deadline;
+
+        /*
+        The events of the block have already been generated, so the held value
+        needs to be moved to its place in time among them. Rotating keeps the
+        order of simultaneous events, and it does not allocate.
+        */
+        Midi::SampleOffset const sample_offset = (
+            (Midi::SampleOffset)(slot.deadline - elapsed_samples)
+        );
+        size_t const old_size = out_events_rw.size();
+
+        push_controller_event(sample_offset, channel, slot.controller_id, slot.value);
+
+        OutEvents::iterator const first_new = out_events_rw.begin() + old_size;
+        OutEvents::iterator const position = std::upper_bound(
+            out_events_rw.begin(),
+            first_new,
+            sample_offset,
+            [](Midi::SampleOffset const offset, Midi::Event const& event) {
+                return offset < event.sample_offset;
+            }
+        );
+
+        std::rotate(position, first_new, out_events_rw.end());
+    }
+}
+
+
+void Proxy::drop_held_controller_values(
+        Midi::Channel const channel,
+        ControllerId const controller_id
+) noexcept {
+    if (MPE_EMULATOR_LIKELY(rate_limiter.held_count == 0)) {
+        return;
+    }
+
+    for (size_t i = 0; i != RULES; ++i) {
+        size_t const slot_index = RateLimiter::get_slot_index(i, channel);
+
+        if (rate_limiter.slots[slot_index].controller_id == controller_id) {
+            rate_limiter.release(slot_index);
+        }
+    }
+}
+
+
+template<Midi::Command midi_command>
+void Proxy::push_controller_event(
+        Midi::SampleOffset const sample_offset,
         Midi::Channel const channel,
         ControllerId const controller_id,
         double const value,
         bool const is_pre_note_on_setup
 ) noexcept {
     if constexpr (midi_command == Midi::CHANNEL_PRESSURE) {
+        Midi::Byte const value_as_byte = Midi::float_to_byte<double>(value);
+
+        output_state.store(channel, controller_id, value_as_byte);
+
         push_out_event(
-            Midi::Event(
-                time_offset,
-                Midi::CHANNEL_PRESSURE,
-                channel,
-                Midi::float_to_byte<double>(value),
-                0x00,
-                value,
-                is_pre_note_on_setup
-            )
+            sample_offset,
+            Midi::CHANNEL_PRESSURE,
+            channel,
+            value_as_byte,
+            0x00,
+            is_pre_note_on_setup
         );
     } else if constexpr (midi_command == Midi::PITCH_BEND_CHANGE) {
         Midi::Word const value_as_word = Midi::float_to_word<double>(value);
         Midi::Byte const lsb = (Midi::Byte)(value_as_word & 0x7f);
         Midi::Byte const msb = (Midi::Byte)(value_as_word >> 7);
 
+        output_state.store(channel, controller_id, value_as_word);
+
         push_out_event(
-            Midi::Event(
-                time_offset,
-                Midi::PITCH_BEND_CHANGE,
-                channel,
-                lsb,
-                msb,
-                value,
-                is_pre_note_on_setup
-            )
+            sample_offset,
+            Midi::PITCH_BEND_CHANGE,
+            channel,
+            lsb,
+            msb,
+            is_pre_note_on_setup
         );
     } else {
+        Midi::Byte const value_as_byte = Midi::float_to_byte<double>(value);
+
+        output_state.store(channel, controller_id, value_as_byte);
+
         push_out_event(
-            Midi::Event(
-                time_offset,
-                Midi::CONTROL_CHANGE,
-                channel,
-                (Midi::Controller)controller_id,
-                Midi::float_to_byte<double>(value),
-                value,
-                is_pre_note_on_setup
-            )
+            sample_offset,
+            Midi::CONTROL_CHANGE,
+            channel,
+            (Midi::Controller)controller_id,
+            value_as_byte,
+            is_pre_note_on_setup
         );
     }
 }
 
 
 void Proxy::push_note_off(
-        double const time_offset,
+        Midi::SampleOffset const sample_offset,
         Midi::Channel const channel,
         Midi::Note const note,
         Midi::Byte const velocity
@@ -813,37 +1375,54 @@ void Proxy::push_note_off(
             ? velocities_by_notes[note]
             : velocity
     );
-    bool const was_above_anchor = note >= anchor_;
+    Split const split = (Split)splits_by_notes[note];
 
     push_out_event(
-        Midi::Event(
-            time_offset,
-            Midi::NOTE_OFF,
-            channel,
-            transpose(note, was_above_anchor),
-            note_off_velocity,
-            Midi::byte_to_float<double>(note_off_velocity)
-        )
+        sample_offset,
+        Midi::NOTE_OFF,
+        channel,
+        transposed_notes[note],
+        note_off_velocity
     );
 
     NoteStack::ChannelStats old_channel_stats(channel_stats);
     NoteStack::ChannelStats old_channel_stats_below(channel_stats_below);
     NoteStack::ChannelStats old_channel_stats_above(channel_stats_above);
+    NoteStack::ChannelStats old_channel_stats_split(channel_stats_by_splits[split]);
 
     note_stack.remove(note);
     note_stack_above.remove(note);
     note_stack_below.remove(note);
+    note_stacks_by_splits[split].remove(note);
+
+    active_channels_by_splits[split].remove(channel);
+
+    if (split >= Split::SPL_ABOVE_ANCHOR) {
+        active_channels_above.remove(channel);
+    } else {
+        active_channels_below.remove(channel);
+    }
+
+    if (MPE_EMULATOR_LIKELY(voice_stats.active_voices != 0)) {
+        --voice_stats.active_voices;
+    }
+
+    set_channel_state(channel, VoiceStats::ChannelState::CS_FREE, 0);
 
     note_stack.make_stats(channels_by_notes, channel_stats);
     note_stack_above.make_stats(channels_by_notes, channel_stats_above);
     note_stack_below.make_stats(channels_by_notes, channel_stats_below);
+    note_stacks_by_splits[split].make_stats(
+        channels_by_notes, channel_stats_by_splits[split]
+    );
 
     push_resets_for_note_off(
-        time_offset,
-        was_above_anchor,
+        sample_offset,
+        split,
         old_channel_stats,
         old_channel_stats_below,
-        old_channel_stats_above
+        old_channel_stats_above,
+        old_channel_stats_split
     );
 
     deferred_note_offs.remove(note);
@@ -851,25 +1430,41 @@ void Proxy::push_note_off(
 
 
 void Proxy::push_resets_for_note_off(
-        double const time_offset,
-        bool const was_above_anchor,
+        Midi::SampleOffset const sample_offset,
+        Split const split,
         NoteStack::ChannelStats const& old_channel_stats,
         NoteStack::ChannelStats const& old_channel_stats_below,
-        NoteStack::ChannelStats const& old_channel_stats_above
+        NoteStack::ChannelStats const& old_channel_stats_above,
+        NoteStack::ChannelStats const& old_channel_stats_split
 ) noexcept {
     for (size_t i = 0; i != RULES; ++i) {
         Rule const& rule = rules[i];
 
-        if (!rule.needs_reset_for_note_event(was_above_anchor)) {
+        if (!rule.needs_reset_for_note_event(split)) {
             continue;
         }
 
         double const reset_value = rule.get_reset_value();
         ControllerId const out_cc = (ControllerId)rule.out_cc.get_value();
 
+        if ((SplitScope)rule.split_scope.get_value() != SplitScope::SCP_ALL) {
+            reset_outdated_split_target_if_changed(
+                rule,
+                sample_offset,
+                Midi::INVALID_CHANNEL,
+                split,
+                channel_stats_by_splits[split],
+                old_channel_stats_split,
+                reset_value,
+                out_cc
+            );
+
+            continue;
+        }
+
         reset_outdated_targets_if_changed(
             rule,
-            time_offset,
+            sample_offset,
             Midi::INVALID_CHANNEL,
             channel_stats,
             channel_stats_below,
@@ -901,17 +1496,22 @@ void Proxy::channel_pressure(
         Midi::Channel const channel,
         Midi::Byte const pressure
 ) noexcept {
+    Midi::SampleOffset const sample_offset = Midi::to_sample_offset(time_offset);
+
     if (
             is_suspended
-            || is_repeated_midi_controller_message(
-                ControllerId::CHANNEL_PRESSURE, time_offset, channel, pressure
+            || is_duplicate(
+                DuplicateFilter::EventType::CONTROLLER,
+                ControllerId::CHANNEL_PRESSURE,
+                sample_offset,
+                pressure
             )
     ) {
         return;
     }
 
     process_controller_event<Midi::CHANNEL_PRESSURE>(
-        time_offset,
+        sample_offset,
         ControllerId::CHANNEL_PRESSURE,
         Midi::byte_to_float<double>(pressure)
     );
@@ -920,12 +1520,11 @@ void Proxy::channel_pressure(
 
 template<Midi::Command midi_command>
 void Proxy::process_controller_event(
-        double const time_offset,
+        Midi::SampleOffset const sample_offset,
         ControllerId const controller_id,
         double const value
 ) noexcept {
-    Midi::Channel target_channels[Midi::CHANNELS];
-    size_t target_channels_count;
+    ActiveChannels::Mask target_channels;
     bool matched = false;
 
     bool const is_note_stack_empty = note_stack.is_empty();
@@ -936,13 +1535,19 @@ void Proxy::process_controller_event(
 
         if (rule_ctl_id == ControllerId::MIDI_LEARN) {
             rule.in_cc.set_value(controller_id);
+            handle_refresh_param(
+                (ParamId)(
+                    (int)ParamId::Z1R1IN
+                    + (int)i * ((int)ParamId::Z1R2IN - (int)ParamId::Z1R1IN)
+                )
+            );
             is_dirty_ = true;
         } else if (rule_ctl_id != controller_id) {
             continue;
         }
 
         matched = true;
-        target_channels_count = 0;
+        target_channels = 0;
 
         rule.last_input_value = value;
 
@@ -950,127 +1555,143 @@ void Proxy::process_controller_event(
             (ControllerId)rule.out_cc.get_value()
         );
 
+        SplitScope const split_scope = (SplitScope)rule.split_scope.get_value();
+
         if (is_note_stack_empty && (Toggle)rule.fallback.get_value() == Toggle::ON) {
-            target_channels[target_channels_count++] = manager_channel;
+            target_channels = ActiveChannels::to_mask(manager_channel);
+        } else if (split_scope != SplitScope::SCP_ALL) {
+            target_channels = get_split_target_channels(
+                (Target)rule.target.get_value(), (Split)((int)split_scope - 1)
+            );
         } else {
             switch ((Target)rule.target.get_value()) {
                 case Target::TRG_ALL_BELOW_ANCHOR:
-                    note_stack_below.collect_active_channels(
-                        channels_by_notes, target_channels, target_channels_count
-                    );
+                    target_channels = active_channels_below.get_mask();
                     break;
 
                 case Target::TRG_ALL_ABOVE_ANCHOR:
-                    note_stack_above.collect_active_channels(
-                        channels_by_notes, target_channels, target_channels_count
-                    );
+                    target_channels = active_channels_above.get_mask();
                     break;
 
                 case Target::TRG_LOWEST:
                     if (!note_stack.is_empty()) {
                         Midi::Note note = note_stack.lowest();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_HIGHEST:
                     if (!note_stack.is_empty()) {
                         Midi::Note note = note_stack.highest();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_OLDEST:
                     if (!note_stack.is_empty()) {
                         Midi::Note note = note_stack.oldest();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_NEWEST:
                     if (!note_stack.is_empty()) {
                         Midi::Note note = note_stack.top();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_LOWEST_BELOW_ANCHOR:
                     if (!note_stack_below.is_empty()) {
                         Midi::Note note = note_stack_below.lowest();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_HIGHEST_BELOW_ANCHOR:
                     if (!note_stack_below.is_empty()) {
                         Midi::Note note = note_stack_below.highest();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_OLDEST_BELOW_ANCHOR:
                     if (!note_stack_below.is_empty()) {
                         Midi::Note note = note_stack_below.oldest();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_NEWEST_BELOW_ANCHOR:
                     if (!note_stack_below.is_empty()) {
                         Midi::Note note = note_stack_below.top();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_LOWEST_ABOVE_ANCHOR:
                     if (!note_stack_above.is_empty()) {
                         Midi::Note note = note_stack_above.lowest();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_HIGHEST_ABOVE_ANCHOR:
                     if (!note_stack_above.is_empty()) {
                         Midi::Note note = note_stack_above.highest();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_OLDEST_ABOVE_ANCHOR:
                     if (!note_stack_above.is_empty()) {
                         Midi::Note note = note_stack_above.oldest();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_NEWEST_ABOVE_ANCHOR:
                     if (!note_stack_above.is_empty()) {
                         Midi::Note note = note_stack_above.top();
-                        target_channels[target_channels_count++] = channels_by_notes[note];
+                        target_channels = ActiveChannels::to_mask(channels_by_notes[note]);
                     }
                     break;
 
                 case Target::TRG_GLOBAL:
                 default:
-                    target_channels[target_channels_count++] = manager_channel;
+                    target_channels = ActiveChannels::to_mask(manager_channel);
                     break;
             }
         }
 
-        if (target_channels_count != 0) {
+        if (target_channels != 0) {
             double const out_value = rule.distort(value);
+            bool const is_rate_limited = (
+                (RateLimit)rule.rate_limit.get_value() != RateLimit::RL_OFF
+                || rule.deadband.get_value() != 0
+            );
 
-            for (size_t c = 0; c != target_channels_count; ++c) {
-                push_controller_event(
-                    time_offset, target_channels[c], out_controller_id, out_value
-                );
+            for (Midi::Channel c = 0; target_channels != 0; ++c) {
+                if ((target_channels & 1) != 0) {
+                    if (is_rate_limited) {
+                        push_rate_limited_controller_event(
+                            i, sample_offset, c, out_controller_id, out_value
+                        );
+                    } else {
+                        push_controller_event(
+                            sample_offset, c, out_controller_id, out_value
+                        );
+                    }
+                }
+
+                target_channels >>= 1;
             }
         }
     }
 
     if (!matched) {
         push_controller_event<midi_command>(
-            time_offset, manager_channel, controller_id, value
+            sample_offset, manager_channel, controller_id, value
         );
     }
 
@@ -1081,41 +1702,41 @@ void Proxy::process_controller_event(
         is_sustain_pedal_on = value >= 0.5;
 
         if (!is_sustain_pedal_on) {
-            process_deferred_note_offs(time_offset);
+            process_deferred_note_offs(sample_offset);
         }
     }
 }
 
 
-void Proxy::process_deferred_note_offs(double const time_offset) noexcept
+void Proxy::process_deferred_note_offs(Midi::SampleOffset const sample_offset) noexcept
 {
     while (!deferred_note_offs.is_empty()) {
         Midi::Note const note = deferred_note_offs.pop();
         Midi::Byte const velocity = deferred_note_off_velocities[note];
-        handle_note_off(time_offset, note, velocity);
+        handle_note_off(sample_offset, note, velocity);
     }
 }
 
 
-bool Proxy::is_repeated_midi_controller_message(
-        ControllerId const controller_id,
-        double const time_offset,
-        Midi::Channel const channel,
+bool Proxy::is_duplicate(
+        DuplicateFilter::EventType const event_type,
+        Midi::Byte const key,
+        Midi::SampleOffset const sample_offset,
         Midi::Word const value
 ) noexcept {
     /*
     By default, FL Studio 21 sends multiple clones of the same pitch bend event
-    separately on all channels, but it's enough for us to handle only one of
-    those.
+    separately on all channels, and some other hosts and controllers do the
+    same with notes, channel pressure, and other controllers as well, sometimes
+    interleaving the clones of different events. It's enough for us to handle
+    only one of those.
     */
-    MidiControllerMessage const message(time_offset, value);
+    if (duplicate_filter.is_duplicate(event_type, key, sample_offset, value)) {
+        suppressed_duplicates_count_atomic.fetch_add(1);
 
-    if (previous_controller_message[controller_id] == message) {
         return true;
     }
 
-    previous_controller_message[controller_id] = message;
-
     return false;
 }
 
@@ -1126,10 +1747,21 @@ void Proxy::note_off(
         Midi::Note const note,
         Midi::Byte const velocity
 ) noexcept {
-    if (is_suspended) {
+    Midi::SampleOffset const sample_offset = Midi::to_sample_offset(time_offset);
+
+    MPE_EMULATOR_TRACE("note off", sample_offset, channel, note, velocity);
+
+    if (
+            is_suspended
+            || is_duplicate(
+                DuplicateFilter::EventType::NOTE_OFF, note, sample_offset, velocity
+            )
+    ) {
         return;
     }
 
+    duplicate_filter.forget(DuplicateFilter::EventType::NOTE_ON, note);
+
     if (!note_stack.find(note)) {
         return;
     }
@@ -1140,22 +1772,27 @@ void Proxy::note_off(
     ) {
         deferred_note_offs.push(note);
         deferred_note_off_velocities[note] = velocity;
+
+        ++voice_stats.deferred_note_offs;
+        set_channel_state(
+            channels_by_notes[note], VoiceStats::ChannelState::CS_SUSTAINED, note
+        );
     } else {
-        handle_note_off(time_offset, note, velocity);
+        handle_note_off(sample_offset, note, velocity);
     }
 }
 
 
 void Proxy::handle_note_off(
-        double const time_offset,
+        Midi::SampleOffset const sample_offset,
         Midi::Note const note,
         Midi::Byte const velocity
 ) noexcept {
     Midi::Channel const assigned_channel = channels_by_notes[note];
 
-    push_note_off(time_offset, assigned_channel, note, velocity);
+    push_note_off(sample_offset, assigned_channel, note, velocity);
 
-    available_channels.push(assigned_channel);
+    available_channels[pools_by_splits[splits_by_notes[note]]].push(assigned_channel);
 }
 
 
@@ -1165,20 +1802,25 @@ void Proxy::control_change(
         Midi::Controller const controller,
         Midi::Byte const new_value
 ) noexcept {
+    Midi::SampleOffset const sample_offset = Midi::to_sample_offset(time_offset);
+
     ControllerId const controller_id = (ControllerId)controller;
 
     if (
             is_suspended
             || controller_id > ControllerId::MAX_MIDI_CC
-            || is_repeated_midi_controller_message(
-                (ControllerId)controller, time_offset, channel, new_value
+            || is_duplicate(
+                DuplicateFilter::EventType::CONTROLLER,
+                controller,
+                sample_offset,
+                new_value
             )
     ) {
         return;
     }
 
     process_controller_event<Midi::CONTROL_CHANGE>(
-        time_offset,
+        sample_offset,
         controller_id,
         Midi::byte_to_float<double>(new_value)
     );
@@ -1190,17 +1832,22 @@ void Proxy::pitch_wheel_change(
         Midi::Channel const channel,
         Midi::Word const new_value
 ) noexcept {
+    Midi::SampleOffset const sample_offset = Midi::to_sample_offset(time_offset);
+
     if (
             is_suspended
-            || is_repeated_midi_controller_message(
-                ControllerId::PITCH_WHEEL, time_offset, channel, new_value
+            || is_duplicate(
+                DuplicateFilter::EventType::CONTROLLER,
+                ControllerId::PITCH_WHEEL,
+                sample_offset,
+                new_value
             )
     ) {
         return;
     }
 
     process_controller_event<Midi::PITCH_BEND_CHANGE>(
-        time_offset,
+        sample_offset,
         ControllerId::PITCH_WHEEL,
         Midi::word_to_float<double>(new_value)
     );
@@ -1236,29 +1883,44 @@ void Proxy::push_message(Message const& message) noexcept
 }
 
 
-std::string const& Proxy::get_param_name(ParamId const param_id) const noexcept
+void Proxy::push_param_snapshot(ParamSnapshot const& snapshot) noexcept
 {
-    return param_names_by_id[param_id];
+    ParamSnapshot& back = param_snapshots.get_back();
+    uint64_t const sequence = ++param_snapshot_sequence;
+
+    std::copy_n(snapshot.ratios, (size_t)ParamId::PARAM_ID_COUNT, back.ratios);
+    back.sequence = sequence;
+
+    param_snapshots.publish();
+
+    push_message(
+        MessageType::APPLY_PARAM_SNAPSHOT,
+        ParamId::INVALID_PARAM_ID,
+        (double)sequence
+    );
 }
 
 
-Proxy::ParamId Proxy::get_param_id(std::string const& name) const noexcept
+void Proxy::collect_changed_params(
+        ChangedParams& changed_params,
+        ChangedParamsReader const reader
+) noexcept {
+    for (size_t i = 0; i != ChangedParams::WORDS; ++i) {
+        changed_params.words[i] |= changed_params_atomic[reader][i].exchange(0);
+    }
+}
+
+
+char const* Proxy::get_param_name(ParamId const param_id) const noexcept
 {
-    return param_id_hash_table.lookup(name);
+    return PARAM_NAMES[param_id];
 }
 
 
-#ifdef MPE_EMULATOR_ASSERTIONS
-void Proxy::get_param_id_hash_table_statistics(
-        unsigned int& max_collisions,
-        double& avg_collisions,
-        double& avg_bucket_size
-) const noexcept {
-    param_id_hash_table.get_statistics(
-        max_collisions, avg_collisions, avg_bucket_size
-    );
+Proxy::ParamId Proxy::get_param_id(std::string const& name) const noexcept
+{
+    return ParamIdHashTable::lookup(name);
 }
-#endif
 
 
 double Proxy::get_param_ratio_atomic(ParamId const param_id) const noexcept
@@ -1305,14 +1967,25 @@ unsigned int Proxy::get_param_value(ParamId const param_id) const noexcept
 
 void Proxy::process_messages() noexcept
 {
-    SPSCQueue<Message>::SizeType const message_count = messages.length();
+    typedef SPSCQueue<Message>::SizeType SizeType;
+
+    Message batch[MESSAGE_BATCH_SIZE];
+    SizeType remaining = messages.length();
+
+    while (remaining != 0) {
+        SizeType const batch_size = messages.pop_bulk(
+            batch, std::min(remaining, (SizeType)MESSAGE_BATCH_SIZE)
+        );
 
-    for (SPSCQueue<Message>::SizeType i = 0; i != message_count; ++i) {
-        Message message;
+        if (batch_size == 0) {
+            break;
+        }
 
-        if (messages.pop(message)) {
-            process_message(message);
+        for (SizeType i = 0; i != batch_size; ++i) {
+            process_message(batch[i]);
         }
+
+        remaining -= batch_size;
     }
 }
 
@@ -1347,6 +2020,16 @@ void Proxy::process_message(Message const& message) noexcept
             is_dirty_ = false;
             break;
 
+        case MessageType::APPLY_PARAM_SNAPSHOT:
+            is_dirty_ = handle_apply_param_snapshot(
+                (uint64_t)message.double_param
+            );
+            break;
+
+        case MessageType::SET_DUPLICATE_FILTER_WINDOW:
+            duplicate_filter.set_window(Midi::to_sample_offset(message.double_param));
+            break;
+
         default:
             break;
     }
@@ -1369,7 +2052,28 @@ bool Proxy::handle_set_param(ParamId const param_id, double const ratio) noexcep
 
 void Proxy::handle_refresh_param(ParamId const param_id) noexcept
 {
-    param_ratios_atomic[(size_t)param_id].store(get_param_ratio(param_id));
+    double const ratio = get_param_ratio(param_id);
+
+    SeqLock<double>& param_ratio_atomic = param_ratios_atomic[(size_t)param_id];
+
+    if (param_ratio_atomic.load() != ratio) {
+        param_ratio_atomic.store(ratio);
+        mark_param_as_changed(param_id);
+    }
+}
+
+
+void Proxy::mark_param_as_changed(ParamId const param_id) noexcept
+{
+    size_t const index = (size_t)param_id;
+    size_t const word = index / ChangedParams::WORD_BITS;
+    ChangedParams::Word const bit = (
+        (ChangedParams::Word)1 << (index % ChangedParams::WORD_BITS)
+    );
+
+    for (size_t reader = 0; reader != ChangedParamsReader::CPR_COUNT; ++reader) {
+        changed_params_atomic[reader][word].fetch_or(bit);
+    }
 }
 
 
@@ -1390,6 +2094,36 @@ bool Proxy::handle_clear() noexcept
 }
 
 
+bool Proxy::handle_apply_param_snapshot(uint64_t const sequence) noexcept
+{
+    /*
+    When multiple snapshots are published before the audio thread gets to
+    their messages, then the first message already applies the latest one,
+    and the rest re-apply it, so that messages which were pushed between the
+    snapshots can't override the final state.
+    */
+    if (param_snapshots.get_front().sequence < sequence) {
+        param_snapshots.consume();
+    }
+
+    ParamSnapshot const& snapshot = param_snapshots.get_front();
+
+    if (MPE_EMULATOR_UNLIKELY(snapshot.sequence < sequence)) {
+        return is_dirty_;
+    }
+
+    bool has_changed = false;
+
+    for (int i = 0; i != ParamId::PARAM_ID_COUNT; ++i) {
+        has_changed = (
+            handle_set_param((ParamId)i, snapshot.ratios[i]) || has_changed
+        );
+    }
+
+    return has_changed;
+}
+
+
 double Proxy::get_param_ratio(ParamId const param_id) const noexcept
 {
     return params[(size_t)param_id]->get_ratio();
@@ -1398,6 +2132,8 @@ double Proxy::get_param_ratio(ParamId const param_id) const noexcept
 
 void Proxy::reset() noexcept
 {
+    MPE_EMULATOR_TRACE("reset");
+
     if (MPE_EMULATOR_LIKELY(!update_zone_config())) {
         out_events_rw.clear();
         stop_all_notes();
@@ -1418,7 +2154,22 @@ bool Proxy::update_zone_config() noexcept
     int const new_offset_above_anchor = (
         (int)transpose_above_anchor.get_value() - 48
     );
+    int const new_offset_below_lower_split = (
+        (int)transpose_below_lower_split.get_value() - 48
+    );
+    int const new_offset_above_upper_split = (
+        (int)transpose_above_upper_split.get_value() - 48
+    );
     Midi::Note const new_anchor = (Midi::Note)anchor.get_value();
+    Midi::Note const new_lower_split_point = (
+        (Midi::Note)lower_split_point.get_value()
+    );
+    Midi::Note const new_upper_split_point = (
+        (Midi::Note)upper_split_point.get_value()
+    );
+    bool const new_has_separate_split_channels = (
+        (Toggle)separate_split_channels.get_value() == Toggle::ON
+    );
     Midi::Channel const new_manager_channel = ztd.manager_channel;
     Midi::Channel const new_channel_count = channels.get_value();
 
@@ -1427,7 +2178,12 @@ bool Proxy::update_zone_config() noexcept
             && new_manager_channel == manager_channel
             && new_offset_below_anchor == offset_below_anchor
             && new_offset_above_anchor == offset_above_anchor
+            && new_offset_below_lower_split == offset_below_lower_split
+            && new_offset_above_upper_split == offset_above_upper_split
             && new_anchor == anchor_
+            && new_lower_split_point == lower_split_point_
+            && new_upper_split_point == upper_split_point_
+            && new_has_separate_split_channels == has_separate_split_channels
     ) {
         return false;
     }
@@ -1437,15 +2193,21 @@ bool Proxy::update_zone_config() noexcept
 
     channel_count_atomic.store(new_channel_count);
 
+    offset_below_lower_split = new_offset_below_lower_split;
     offset_below_anchor = new_offset_below_anchor;
     offset_above_anchor = new_offset_above_anchor;
+    offset_above_upper_split = new_offset_above_upper_split;
+    lower_split_point_ = new_lower_split_point;
     anchor_ = new_anchor;
+    upper_split_point_ = new_upper_split_point;
+    has_separate_split_channels = new_has_separate_split_channels;
     channel_count = new_channel_count;
     manager_channel = new_manager_channel;
     channel_increment = ztd.channel_increment;
     first_channel = manager_channel + channel_increment;
     last_channel = manager_channel + channel_increment * channel_count;
 
+    update_split_tables();
     reset_available_channels();
 
     push_mcms();
@@ -1461,7 +2223,7 @@ void Proxy::stop_all_notes() noexcept
 {
     if (!note_stack.is_empty()) {
         push_controller_event<Midi::CONTROL_CHANGE>(
-            0.0, manager_channel, ControllerId::SUSTAIN_PEDAL, 0.0
+            0, manager_channel, ControllerId::SUSTAIN_PEDAL, 0.0
         );
 
         for (Midi::Note i = 0; !note_stack.is_empty() && i != Midi::NOTE_MAX; ++i) {
@@ -1469,25 +2231,41 @@ void Proxy::stop_all_notes() noexcept
             Midi::Channel const channel = channels_by_notes[note];
 
             push_controller_event<Midi::CONTROL_CHANGE>(
-                0.0, channel, ControllerId::SUSTAIN_PEDAL, 0.0
+                0, channel, ControllerId::SUSTAIN_PEDAL, 0.0
             );
 
-            push_note_off(0.0, channel, note, 64);
+            push_note_off(0, channel, note, 64);
         }
     }
 
     deferred_note_offs.clear();
+    rate_limiter.clear();
 
     note_stack.clear();
     note_stack_below.clear();
     note_stack_above.clear();
 
+    active_channels_below.clear();
+    active_channels_above.clear();
+
+    for (size_t i = 0; i != Split::SPLITS; ++i) {
+        note_stacks_by_splits[i].clear();
+        active_channels_by_splits[i].clear();
+    }
+
     is_sustain_pedal_on = false;
 }
 
 
 void Proxy::push_mcms() noexcept
 {
+    /*
+    An MPE Configuration Message makes the synth reset its channels, and since
+    this is also where all the other kinds of resets end up, the values that
+    were sent before can no longer be relied upon.
+    */
+    output_state.clear();
+
     if (send_mcm.get_value() == Toggle::ON) {
         push_mcm(manager_channel, channel_count);
         push_mcm(manager_channel ^ 0x0f, 0);
@@ -1499,16 +2277,10 @@ void Proxy::push_mcm(
         Midi::Channel const channel,
         Midi::Channel const channel_count
 ) noexcept {
+    push_out_event(0, Midi::CONTROL_CHANGE, channel, Midi::RPN_MSB, 0x00);
+    push_out_event(0, Midi::CONTROL_CHANGE, channel, Midi::RPN_LSB, 0x06);
     push_out_event(
-        Midi::Event(0.0, Midi::CONTROL_CHANGE, channel, Midi::RPN_MSB, 0x00)
-    );
-    push_out_event(
-        Midi::Event(0.0, Midi::CONTROL_CHANGE, channel, Midi::RPN_LSB, 0x06)
-    );
-    push_out_event(
-        Midi::Event(
-            0.0, Midi::CONTROL_CHANGE, channel, Midi::DATA_ENTRY_MSB, channel_count
-        )
+        0, Midi::CONTROL_CHANGE, channel, Midi::DATA_ENTRY_MSB, channel_count
     );
 }
 
@@ -1526,7 +2298,7 @@ void Proxy::reset_rules_and_global_controllers() noexcept
                 && (Target)rule.target.get_value() == Target::TRG_GLOBAL
         ) {
             push_controller_event(
-                0.0,
+                0,
                 manager_channel,
                 (ControllerId)rule.out_cc.get_value(),
                 rule.distort(init_value)
@@ -1538,7 +2310,12 @@ void Proxy::reset_rules_and_global_controllers() noexcept
 
 void Proxy::begin_processing() noexcept
 {
+    MPE_EMULATOR_RT_SCOPE();
+
+    MPE_EMULATOR_TRACE("begin processing", is_suspended);
+
     process_messages();
+    duplicate_filter.begin_block();
 
     if (is_suspended) {
         return;
@@ -1551,6 +2328,108 @@ void Proxy::begin_processing() noexcept
     } else {
         out_events_rw.clear();
     }
+
+    publish_voice_stats();
+}
+
+
+void Proxy::end_processing(Midi::SampleOffset const sample_count) noexcept
+{
+    MPE_EMULATOR_RT_SCOPE();
+
+    MPE_EMULATOR_TRACE("end processing", sample_count);
+
+    RateLimiter::Time const next_block_time = (
+        elapsed_samples + (RateLimiter::Time)sample_count
+    );
+
+    if (!is_suspended && rate_limiter.held_count != 0) {
+        push_held_controller_events(next_block_time);
+    }
+
+    elapsed_samples = next_block_time;
+}
+
+
+bool Proxy::has_held_controller_values() const noexcept
+{
+    return rate_limiter.held_count != 0;
+}
+
+
+void Proxy::set_sample_rate(double const sample_rate) noexcept
+{
+    if (sample_rate > 0.0) {
+        this->sample_rate = sample_rate;
+        update_rate_limit_intervals();
+    }
+}
+
+
+size_t Proxy::get_out_events_capacity(size_t const max_block_size) noexcept
+{
+    return std::min(
+        2 * OUT_EVENTS_FAN_OUT_MAX
+            + std::min(max_block_size, MAX_BLOCK_SIZE) * OUT_EVENTS_PER_SAMPLE,
+        OUT_EVENTS_MAX
+    );
+}
+
+
+void Proxy::reserve_out_events(size_t const max_block_size) noexcept
+{
+    size_t const capacity = std::max(
+        get_out_events_capacity(max_block_size), out_events_rw.size()
+    );
+
+    if (out_events_rw.capacity() == capacity) {
+        return;
+    }
+
+    /* std::vector::reserve() would never give back memory to the system. */
+    OutEvents resized;
+
+    resized.reserve(capacity);
+    resized.insert(resized.end(), out_events_rw.begin(), out_events_rw.end());
+    out_events_rw.swap(resized);
+}
+
+
+void Proxy::update_rate_limit_intervals() noexcept
+{
+    rate_limit_intervals[RateLimit::RL_OFF] = 0;
+
+    for (size_t i = 1; i != RateLimit::RATE_LIMITS; ++i) {
+        rate_limit_intervals[i] = std::max(
+            (RateLimiter::Time)1,
+            (RateLimiter::Time)std::round(sample_rate / RATE_LIMIT_FREQUENCIES[i])
+        );
+    }
+
+    gesture_end_samples = std::max(
+        (RateLimiter::Time)1,
+        (RateLimiter::Time)std::round(sample_rate * GESTURE_END_TIME)
+    );
+}
+
+
+Proxy::VoiceStats::VoiceStats() noexcept
+    : retriggered_notes(0),
+    dropped_notes(0),
+    deferred_note_offs(0),
+    active_voices(0),
+    peak_voices(0),
+    channel_count(0)
+{
+    std::fill_n(channel_states, (size_t)Midi::CHANNELS, (Midi::Byte)CS_UNUSED);
+    std::fill_n(notes, (size_t)Midi::CHANNELS, 0);
+    std::fill_n(steals, EXCESS_NOTE_HANDLINGS, 0);
+}
+
+
+Proxy::ParamSnapshot::ParamSnapshot() noexcept : sequence(0)
+{
+    std::fill_n(ratios, (size_t)ParamId::PARAM_ID_COUNT, 0.0);
 }
 
 
@@ -1574,235 +2453,388 @@ Proxy::Message::Message(
 }
 
 
-Proxy::ParamIdHashTable::ParamIdHashTable() noexcept
+Proxy::ParamId Proxy::ParamIdHashTable::lookup(std::string const& name) noexcept
 {
+    if (MPE_EMULATOR_UNLIKELY(name.length() > NAME_SIZE)) {
+        return ParamId::INVALID_PARAM_ID;
+    }
+
+    uint64_t const key = encode(name);
+    size_t const index = hash(key);
+
+    /*
+    Unused entries have a key of 0 and an invalid param ID, so the empty string
+    needs no special treatment.
+    */
+    return KEYS[index] == key ? PARAM_IDS[index] : ParamId::INVALID_PARAM_ID;
 }
 
 
-Proxy::ParamIdHashTable::~ParamIdHashTable() noexcept
+uint64_t Proxy::ParamIdHashTable::encode(std::string const& name) noexcept
 {
+    uint64_t key = 0;
+    size_t const length = name.length();
+
+    for (size_t i = 0; i != length; ++i) {
+        key |= (uint64_t)(unsigned char)name[i] << (8 * i);
+    }
+
+    return key;
 }
 
 
-void Proxy::ParamIdHashTable::add(std::string const& name, ParamId const param_id) noexcept
+/*
+Inspiration from https://orlp.net/blog/worlds-smallest-hash-table/
+*/
+size_t Proxy::ParamIdHashTable::hash(uint64_t const key) noexcept
 {
-    Entry* root;
-    Entry* parent;
-    Entry* entry;
+    return (size_t)((key * MULTIPLIER) >> SHIFT);
+}
 
-    lookup(name, &root, &parent, &entry);
 
-    if (entry != NULL) {
-        return;
+Proxy::ChangedParams::ChangedParams() noexcept
+{
+    clear();
+}
+
+
+void Proxy::ChangedParams::clear() noexcept
+{
+    std::fill_n(words, WORDS, 0);
+}
+
+
+bool Proxy::ChangedParams::is_empty() const noexcept
+{
+    for (size_t i = 0; i != WORDS; ++i) {
+        if (words[i] != 0) {
+            return false;
+        }
     }
 
-    if (parent != NULL) {
-        parent->next = new Entry(name.c_str(), param_id);
+    return true;
+}
 
-        return;
+
+bool Proxy::ChangedParams::contains(ParamId const param_id) const noexcept
+{
+    size_t const index = (size_t)param_id;
+
+    if (MPE_EMULATOR_UNLIKELY(index >= (size_t)ParamId::PARAM_ID_COUNT)) {
+        return false;
     }
 
-    root->set(name.c_str(), param_id);
+    return (words[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
 }
 
 
-void Proxy::ParamIdHashTable::lookup(
-        std::string const& name,
-        Entry** root,
-        Entry** parent,
-        Entry** entry
-) noexcept {
-    char const* const name_ptr = name.c_str();
-    int const hash = this->hash(name);
-    *root = &entries[hash];
+Proxy::DuplicateFilter::Entry::Entry() noexcept
+    : sample_offset(0),
+    block(0),
+    value(0)
+{
+}
 
-    *parent = NULL;
 
-    if ((*root)->param_id == ParamId::INVALID_PARAM_ID) {
-        *entry = NULL;
+Proxy::DuplicateFilter::DuplicateFilter() noexcept : window(0), block(1)
+{
+}
 
-        return;
-    }
 
-    *entry = *root;
+void Proxy::DuplicateFilter::begin_block() noexcept
+{
+    /*
+    Entries which were recorded in a previous block are recognized by their
+    block number, so there's no need to clear the whole table for each block,
+    except for the very rare case when the counter wraps around.
+    */
+    ++block;
 
-    while (strncmp((*entry)->name, name_ptr, Entry::NAME_SIZE) != 0) {
-        *parent = *entry;
-        *entry = (*entry)->next;
+    if (MPE_EMULATOR_UNLIKELY(block == 0)) {
+        clear();
+    }
+}
 
-        if (*entry == NULL) {
-            break;
-        }
+
+void Proxy::DuplicateFilter::clear() noexcept
+{
+    for (size_t i = 0; i != ENTRIES; ++i) {
+        entries[i].block = 0;
     }
+
+    block = 1;
 }
 
 
-Proxy::ParamId Proxy::ParamIdHashTable::lookup(std::string const& name) noexcept
+void Proxy::DuplicateFilter::set_window(Midi::SampleOffset const window) noexcept
 {
-    Entry* root;
-    Entry* parent;
-    Entry* entry;
+    this->window = window;
+}
 
-    lookup(name, &root, &parent, &entry);
 
-    return entry == NULL ? ParamId::INVALID_PARAM_ID : entry->param_id;
+Midi::SampleOffset Proxy::DuplicateFilter::get_window() const noexcept
+{
+    return window;
 }
 
 
-#ifdef MPE_EMULATOR_ASSERTIONS
-void Proxy::ParamIdHashTable::get_statistics(
-        unsigned int& max_collisions,
-        double& avg_collisions,
-        double& avg_bucket_size
-) const noexcept {
-    unsigned int collisions_sum = 0;
-    unsigned int collisions_count = 0;
-    unsigned int bucket_size_sum = 0;
-    unsigned int bucket_count = 0;
+bool Proxy::DuplicateFilter::is_duplicate(
+        EventType const event_type,
+        Midi::Byte const key,
+        Midi::SampleOffset const sample_offset,
+        Midi::Word const value
+) noexcept {
+    size_t const index = get_index(event_type, key);
 
-    max_collisions = 0;
+    if (MPE_EMULATOR_UNLIKELY(index >= ENTRIES)) {
+        return false;
+    }
 
-    for (unsigned int i = 0; i != ENTRIES; ++i) {
-        Entry const* entry = &entries[i];
+    Entry& entry = entries[index];
 
-        if (entry->param_id == ParamId::INVALID_PARAM_ID) {
-            continue;
-        }
+    if (
+            entry.block == block
+            && entry.value == value
+            && (
+                sample_offset > entry.sample_offset
+                    ? sample_offset - entry.sample_offset
+                    : entry.sample_offset - sample_offset
+            ) <= window
+    ) {
+        return true;
+    }
 
-        unsigned int collisions = 1;
-        ++bucket_count;
-        ++bucket_size_sum;
-        entry = entry->next;
+    entry.sample_offset = sample_offset;
+    entry.block = block;
+    entry.value = value;
 
-        while (entry != NULL) {
-            ++collisions;
-            ++bucket_size_sum;
-            entry = entry->next;
-        }
+    return false;
+}
 
-        if (collisions > 1) {
-            collisions_sum += collisions;
-            ++collisions_count;
 
-            if (collisions > max_collisions) {
-                max_collisions = collisions;
-            }
-        }
+void Proxy::DuplicateFilter::forget(
+        EventType const event_type,
+        Midi::Byte const key
+) noexcept {
+    size_t const index = get_index(event_type, key);
+
+    if (MPE_EMULATOR_LIKELY(index < ENTRIES)) {
+        entries[index].block = 0;
     }
+}
+
+
+size_t Proxy::DuplicateFilter::get_index(
+        EventType const event_type,
+        Midi::Byte const key
+) noexcept {
+    switch (event_type) {
+        case EventType::NOTE_ON:
+            return (size_t)(key & Midi::NOTE_MAX);
+
+        case EventType::NOTE_OFF:
+            return (size_t)Midi::NOTES + (size_t)(key & Midi::NOTE_MAX);
 
-    avg_collisions = (double)collisions_sum / (double)collisions_count;
-    avg_bucket_size = (double)bucket_size_sum / (double)bucket_count;
+        default:
+            return CONTROLLERS_OFFSET + (size_t)key;
+    }
 }
-#endif
 
 
-/*
-Inspiration from https://orlp.net/blog/worlds-smallest-hash-table/
-*/
-int Proxy::ParamIdHashTable::hash(std::string const& name) noexcept
+Proxy::ActiveChannels::Mask Proxy::ActiveChannels::to_mask(
+        Midi::Channel const channel
+) noexcept {
+    return MPE_EMULATOR_LIKELY(channel <= Midi::CHANNEL_MAX)
+        ? (Mask)(1 << channel)
+        : 0;
+}
+
+
+Proxy::ActiveChannels::ActiveChannels() noexcept
+{
+    clear();
+}
+
+
+void Proxy::ActiveChannels::clear() noexcept
 {
+    std::fill_n(notes, (size_t)Midi::CHANNELS, 0);
+    mask = 0;
+}
+
+
+void Proxy::ActiveChannels::add(Midi::Channel const channel) noexcept
+{
+    if (MPE_EMULATOR_UNLIKELY(channel > Midi::CHANNEL_MAX)) {
+        return;
+    }
+
     /*
-    We only care about the 36 characters which are used in param names: capital
-    letters and numbers.
+    Normally, there's only one note on each channel, but counting them keeps
+    the mask correct even when a channel is shared.
     */
-    constexpr int alphabet_size = 36;
-    constexpr char letter_offset = 'A' - 10;
-    constexpr char number_offset = '0';
+    ++notes[channel];
+    mask |= to_mask(channel);
+}
 
-    char const* name_ptr = name.c_str();
 
-    if (*name_ptr == '\x00') {
-        return 0;
+void Proxy::ActiveChannels::remove(Midi::Channel const channel) noexcept
+{
+    if (MPE_EMULATOR_UNLIKELY(channel > Midi::CHANNEL_MAX || notes[channel] == 0)) {
+        return;
     }
 
-    int i;
-    int hash = 0;
+    --notes[channel];
 
-    /* The first letter is the same for almost all parameters, let's skip it. */
-    ++name_ptr;
+    if (notes[channel] == 0) {
+        mask &= (Mask)~to_mask(channel);
+    }
+}
 
-    for (i = -1; *name_ptr != '\x00'; ++name_ptr) {
-        char c = *name_ptr;
 
-        if (c >= letter_offset) {
-            c -= letter_offset;
-        } else {
-            c -= number_offset;
-        }
+Proxy::ActiveChannels::Mask Proxy::ActiveChannels::get_mask() const noexcept
+{
+    return mask;
+}
 
-        hash = hash * alphabet_size + c;
 
-        if (++i == 4) {
-            break;
-        }
+Proxy::OutputState::OutputState() noexcept
+{
+    clear();
+}
+
+
+void Proxy::OutputState::clear() noexcept
+{
+    for (size_t i = 0; i != Midi::CHANNELS; ++i) {
+        std::fill_n(values[i], (size_t)ControllerId::CONTROLLER_ID_COUNT, UNKNOWN);
     }
+}
 
-    hash = (hash << 3) + i;
 
-    if (hash < 0) {
-        hash = -hash;
+Midi::Word Proxy::OutputState::get(
+        Midi::Channel const channel,
+        ControllerId const controller_id
+) const noexcept {
+    if (
+            MPE_EMULATOR_UNLIKELY(
+                channel > Midi::CHANNEL_MAX
+                || controller_id >= ControllerId::CONTROLLER_ID_COUNT
+            )
+    ) {
+        return UNKNOWN;
     }
 
-    hash = (hash * MULTIPLIER >> SHIFT) & MASK;
+    return values[channel][controller_id];
+}
 
-    return hash;
+
+bool Proxy::OutputState::holds(
+        Midi::Channel const channel,
+        ControllerId const controller_id,
+        Midi::Word const value
+) const noexcept {
+    if (
+            MPE_EMULATOR_UNLIKELY(
+                channel > Midi::CHANNEL_MAX
+                || controller_id >= ControllerId::CONTROLLER_ID_COUNT
+            )
+    ) {
+        return false;
+    }
+
+    return values[channel][controller_id] == value;
+}
+
+
+void Proxy::OutputState::store(
+        Midi::Channel const channel,
+        ControllerId const controller_id,
+        Midi::Word const value
+) noexcept {
+    if (
+            MPE_EMULATOR_LIKELY(
+                channel <= Midi::CHANNEL_MAX
+                && controller_id < ControllerId::CONTROLLER_ID_COUNT
+            )
+    ) {
+        values[channel][controller_id] = value;
+    }
 }
 
 
-Proxy::ParamIdHashTable::Entry::Entry() noexcept : next(NULL)
+Proxy::RateLimiter::Slot::Slot() noexcept
+    : last_sent(NEVER),
+    deadline(0),
+    value(0.0),
+    controller_id(ControllerId::NONE),
+    held_index(NOT_HELD)
 {
-    set("", ParamId::INVALID_PARAM_ID);
 }
 
 
-Proxy::ParamIdHashTable::Entry::Entry(
-        const char* const name,
-        ParamId const param_id
-) noexcept
-    : next(NULL)
+size_t Proxy::RateLimiter::get_slot_index(
+        size_t const rule_index,
+        Midi::Channel const channel
+) noexcept {
+    return rule_index * Midi::CHANNELS + (size_t)channel;
+}
+
+
+Midi::Channel Proxy::RateLimiter::get_channel(size_t const slot_index) noexcept
 {
-    set(name, param_id);
+    return (Midi::Channel)(slot_index % Midi::CHANNELS);
 }
 
 
-Proxy::ParamIdHashTable::Entry::~Entry()
+Proxy::RateLimiter::RateLimiter() noexcept : held_count(0)
 {
-    if (next != NULL) {
-        delete next;
+    std::fill_n(held, SLOTS, NOT_HELD);
+}
+
 
-        next = NULL;
+void Proxy::RateLimiter::clear() noexcept
+{
+    for (size_t i = 0; i != SLOTS; ++i) {
+        slots[i] = Slot();
     }
+
+    held_count = 0;
 }
 
 
-void Proxy::ParamIdHashTable::Entry::set(
-        const char* const name,
-        ParamId const param_id
+void Proxy::RateLimiter::hold(
+        size_t const slot_index,
+        Time const deadline,
+        ControllerId const controller_id,
+        double const value
 ) noexcept {
-    std::fill_n(this->name, NAME_SIZE, '\x00');
-    strncpy(this->name, name, NAME_MAX_INDEX);
-    this->param_id = param_id;
-}
+    Slot& slot = slots[slot_index];
 
+    slot.deadline = deadline;
+    slot.controller_id = controller_id;
+    slot.value = value;
 
-Proxy::MidiControllerMessage::MidiControllerMessage() : time_offset(-INFINITY), value(0)
-{
+    if (slot.held_index == NOT_HELD) {
+        slot.held_index = (Midi::Byte)held_count;
+        held[held_count++] = (Midi::Byte)slot_index;
+    }
 }
 
 
-Proxy::MidiControllerMessage::MidiControllerMessage(
-        double const time_offset,
-        Midi::Word const value
-) : time_offset(time_offset),
-    value(value)
+void Proxy::RateLimiter::release(size_t const slot_index) noexcept
 {
-}
+    Slot& slot = slots[slot_index];
+
+    if (slot.held_index == NOT_HELD) {
+        return;
+    }
 
+    Midi::Byte const last = held[--held_count];
 
-bool Proxy::MidiControllerMessage::operator==(
-        MidiControllerMessage const& message
-) const noexcept {
-    return value == message.value && time_offset == message.time_offset;
+    held[slot.held_index] = last;
+    slots[last].held_index = slot.held_index;
+    slot.held_index = NOT_HELD;
 }
 
 }
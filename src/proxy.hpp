@@ -21,6 +21,8 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -28,7 +30,9 @@
 #include "midi.hpp"
 #include "note_stack.hpp"
 #include "queue.hpp"
+#include "seqlock.hpp"
 #include "spscqueue.hpp"
+#include "triple_buffer.hpp"
 
 
 namespace MpeEmulator
@@ -54,6 +58,19 @@ class Proxy : public Midi::EventHandler
 
             CLEAR_DIRTY_FLAG = 4,   ///< Clear the dirty flag.
 
+            APPLY_PARAM_SNAPSHOT = 5,   ///< Set all parameters from the latest
+                                        ///< snapshot that was published by
+                                        ///< \c push_param_snapshot().
+                                        ///< \c double_param is the sequence
+                                        ///< number of the snapshot.
+
+            SET_DUPLICATE_FILTER_WINDOW = 6,    ///< Set how far apart (in
+                                                ///< samples) clones of the
+                                                ///< same event may be on
+                                                ///< different channels to
+                                                ///< \c double_param (default:
+                                                ///< 0, i.e. same time only).
+
             INVALID_MESSAGE_TYPE,
         };
 
@@ -171,7 +188,43 @@ class Proxy : public Midi::EventHandler
             Z1R8FB  = 97,           ///< Zone 1 Rule 8 global fallback
             Z1R9FB  = 98,           ///< Zone 1 Rule 9 global fallback
 
-            PARAM_ID_COUNT = 99,
+            Z1SPL   = 99,           ///< Zone 1 lower split point
+            Z1SPH   = 100,          ///< Zone 1 upper split point
+            Z1TRL   = 101,          ///< Zone 1 transpose below lower split point
+            Z1TRH   = 102,          ///< Zone 1 transpose above upper split point
+            Z1SPP   = 103,          ///< Zone 1 separate channels for each split
+
+            Z1R1SC  = 104,          ///< Zone 1 Rule 1 split scope
+            Z1R2SC  = 105,          ///< Zone 1 Rule 2 split scope
+            Z1R3SC  = 106,          ///< Zone 1 Rule 3 split scope
+            Z1R4SC  = 107,          ///< Zone 1 Rule 4 split scope
+            Z1R5SC  = 108,          ///< Zone 1 Rule 5 split scope
+            Z1R6SC  = 109,          ///< Zone 1 Rule 6 split scope
+            Z1R7SC  = 110,          ///< Zone 1 Rule 7 split scope
+            Z1R8SC  = 111,          ///< Zone 1 Rule 8 split scope
+            Z1R9SC  = 112,          ///< Zone 1 Rule 9 split scope
+
+            Z1R1RL  = 113,          ///< Zone 1 Rule 1 rate limit
+            Z1R2RL  = 114,          ///< Zone 1 Rule 2 rate limit
+            Z1R3RL  = 115,          ///< Zone 1 Rule 3 rate limit
+            Z1R4RL  = 116,          ///< Zone 1 Rule 4 rate limit
+            Z1R5RL  = 117,          ///< Zone 1 Rule 5 rate limit
+            Z1R6RL  = 118,          ///< Zone 1 Rule 6 rate limit
+            Z1R7RL  = 119,          ///< Zone 1 Rule 7 rate limit
+            Z1R8RL  = 120,          ///< Zone 1 Rule 8 rate limit
+            Z1R9RL  = 121,          ///< Zone 1 Rule 9 rate limit
+
+            Z1R1DB  = 122,          ///< Zone 1 Rule 1 deadband
+            Z1R2DB  = 123,          ///< Zone 1 Rule 2 deadband
+            Z1R3DB  = 124,          ///< Zone 1 Rule 3 deadband
+            Z1R4DB  = 125,          ///< Zone 1 Rule 4 deadband
+            Z1R5DB  = 126,          ///< Zone 1 Rule 5 deadband
+            Z1R6DB  = 127,          ///< Zone 1 Rule 6 deadband
+            Z1R7DB  = 128,          ///< Zone 1 Rule 7 deadband
+            Z1R8DB  = 129,          ///< Zone 1 Rule 8 deadband
+            Z1R9DB  = 130,          ///< Zone 1 Rule 9 deadband
+
+            PARAM_ID_COUNT = 131,
             INVALID_PARAM_ID = PARAM_ID_COUNT,
         };
 
@@ -350,18 +403,66 @@ class Proxy : public Midi::EventHandler
             RST_INIT = 2,
         };
 
+        /**
+         * \brief Keyboard regions. The anchor separates the lower two splits
+         *        from the upper two, and the split points cut off the outer
+         *        ones, so that the default split points leave only the two
+         *        sides of the anchor.
+         */
+        enum Split {
+            SPL_BELOW_LOWER = 0,        ///< Below the lower split point
+            SPL_BELOW_ANCHOR = 1,       ///< Between the lower split point and the anchor
+            SPL_ABOVE_ANCHOR = 2,       ///< Between the anchor and the upper split point
+            SPL_ABOVE_UPPER = 3,        ///< Above the upper split point
+
+            SPLITS = 4,
+        };
+
+        enum SplitScope {
+            SCP_ALL = 0,
+            SCP_SPLIT_1 = 1,
+            SCP_SPLIT_2 = 2,
+            SCP_SPLIT_3 = 3,
+            SCP_SPLIT_4 = 4,
+        };
+
+        /**
+         * \brief The maximum number of updates per second that a rule may
+         *        send for a controller on a single channel.
+         */
+        enum RateLimit {
+            RL_OFF = 0,
+            RL_1000_HZ = 1,
+            RL_500_HZ = 2,
+            RL_250_HZ = 3,
+            RL_100_HZ = 4,
+            RL_50_HZ = 5,
+            RL_25_HZ = 6,
+
+            RATE_LIMITS = 7,
+        };
+
+        /**
+         * \brief Changes smaller than this many 7 bit steps (or 128 times as
+         *        many 14 bit steps for pitch bend) are held back by a rule
+         *        until the controller stops moving.
+         */
+        static constexpr unsigned int DEADBAND_MAX = 16;
+
+        /**
+         * \brief A parameter's current value and its range. Names are kept in
+         *        the static \c Proxy::PARAM_NAMES table, so that the parameters
+         *        which are read during event processing stay small.
+         */
         class Param
         {
             public:
                 Param(
-                    std::string const& name,
                     unsigned int const min_value,
                     unsigned int const max_value,
                     unsigned int const default_value
                 ) noexcept;
 
-                std::string const& get_name() const noexcept;
-
                 unsigned int get_min_value() const noexcept;
                 unsigned int get_max_value() const noexcept;
                 unsigned int get_value() const noexcept;
@@ -379,25 +480,19 @@ class Proxy : public Midi::EventHandler
                 unsigned int clamp_value(unsigned int const value) const noexcept;
                 double clamp_ratio(double const ratio) const noexcept;
 
-                std::string const name;
-
-                double const min_value_dbl;
-                double const range_dbl;
+                double ratio;
                 double const range_inv;
 
+                unsigned int value;
                 unsigned int const min_value;
                 unsigned int const max_value;
                 unsigned int const default_value;
-
-                double ratio;
-                unsigned int value;
         };
 
         class Rule
         {
             public:
                 explicit Rule(
-                    std::string const& name,
                     ControllerId const in_cc = ControllerId::NONE,
                     ControllerId const out_cc = ControllerId::NONE,
                     Target const target = Target::TRG_NEWEST,
@@ -407,9 +502,7 @@ class Proxy : public Midi::EventHandler
 
                 double distort(double const value) const noexcept;
 
-                bool needs_reset_for_note_event(
-                    bool const is_above_anchor
-                ) const noexcept;
+                bool needs_reset_for_note_event(Split const split) const noexcept;
 
                 double get_reset_value() const noexcept;
 
@@ -423,6 +516,9 @@ class Proxy : public Midi::EventHandler
                 Param reset;
                 Param invert;
                 Param fallback;
+                Param split_scope;
+                Param rate_limit;
+                Param deadband;
 
                 double last_input_value;
         };
@@ -448,10 +544,138 @@ class Proxy : public Midi::EventHandler
                 double double_param;
         };
 
+        /**
+         * \brief Consumers of the parameter change notifications, each of them
+         *        getting its own copy of the flags.
+         */
+        enum ChangedParamsReader {
+            CPR_GUI = 0,            ///< Editor widgets
+            CPR_HOST = 1,           ///< Host-side parameter state (VST3 controller)
+
+            CPR_COUNT = 2,
+        };
+
+        /**
+         * \brief A set of parameters, with one bit for each \c ParamId.
+         */
+        class ChangedParams
+        {
+            public:
+                typedef uint32_t Word;
+
+                static constexpr size_t WORD_BITS = 32;
+
+                static constexpr size_t WORDS = (
+                    ((size_t)ParamId::PARAM_ID_COUNT + WORD_BITS - 1) / WORD_BITS
+                );
+
+                ChangedParams() noexcept;
+
+                void clear() noexcept;
+                bool is_empty() const noexcept;
+                bool contains(ParamId const param_id) const noexcept;
+
+                Word words[WORDS];
+        };
+
+        /**
+         * \brief The ratios of all parameters, for replacing all of them in a
+         *        single step.
+         */
+        class ParamSnapshot
+        {
+            public:
+                ParamSnapshot() noexcept;
+
+                double ratios[ParamId::PARAM_ID_COUNT];
+
+                /**
+                 * \brief Assigned by \c push_param_snapshot().
+                 */
+                uint64_t sequence;
+        };
+
+        /**
+         * \brief Voice pool telemetry: what each channel is doing right now,
+         *        and how the pool coped with the notes that were played since
+         *        the object was created.
+         */
+        class VoiceStats
+        {
+            public:
+                enum ChannelState {
+                    CS_UNUSED = 0,          ///< Not part of the zone
+                    CS_MANAGER = 1,         ///< Manager channel of the zone
+                    CS_FREE = 2,            ///< Member channel without a note
+                    CS_ACTIVE = 3,          ///< Member channel playing a note
+                    CS_SUSTAINED = 4,       ///< Member channel whose note was
+                                            ///< released, but its Note Off is
+                                            ///< deferred by the sustain pedal
+                };
+
+                static constexpr size_t EXCESS_NOTE_HANDLINGS = 5;
+
+                VoiceStats() noexcept;
+
+                Midi::Byte channel_states[Midi::CHANNELS];
+                Midi::Note notes[Midi::CHANNELS];
+
+                /**
+                 * \brief Number of notes which took over the channel of an
+                 *        older note, by \c ExcessNoteHandling.
+                 */
+                uint32_t steals[EXCESS_NOTE_HANDLINGS];
+
+                uint32_t retriggered_notes;     ///< Note On for a playing note
+                uint32_t dropped_notes;         ///< Note On that was ignored
+                uint32_t deferred_note_offs;    ///< Note Off held by the pedal
+
+                Midi::Byte active_voices;
+                Midi::Byte peak_voices;
+                Midi::Byte channel_count;
+        };
+
         typedef std::vector<Midi::Event> OutEvents;
 
         static constexpr size_t RULES = 9;
 
+        /*
+        The most outgoing events that a single incoming event or state change
+        was measured to produce is 163: a reset while all 15 member channels
+        are busy and all 9 rules reset their controllers on each of them. This
+        is rounded up for some headroom.
+        */
+        static constexpr size_t OUT_EVENTS_FAN_OUT_MAX = 256;
+
+        /*
+        A controller which changes on every sample may be sent to all the 15
+        member channels and the manager channel, e.g. with a TRG_ALL target.
+        */
+        static constexpr size_t OUT_EVENTS_PER_SAMPLE = 16;
+
+        /* Used until the host tells the actual maximum block size. */
+        static constexpr size_t DEFAULT_MAX_BLOCK_SIZE = 1024;
+
+        static constexpr size_t MAX_BLOCK_SIZE = 16384;
+
+        /*
+        Large blocks would need megabytes per instance for the worst case,
+        though that many events in a single block are unlikely to be useful
+        for any synthesizer. This is the size of the pool that the FST plugin
+        used to have.
+        */
+        static constexpr size_t OUT_EVENTS_MAX = 16384;
+
+        /**
+         * \brief Number of outgoing events to preallocate for blocks of at
+         *        most the given number of samples, at most \c OUT_EVENTS_MAX.
+         *
+         * The outgoing event buffer never grows beyond this during processing
+         * (growing would allocate in the audio thread), excess events are
+         * dropped instead, see \c get_dropped_events_count().
+         */
+        static size_t get_out_events_capacity(size_t const max_block_size) noexcept;
+
         Proxy() noexcept;
         ~Proxy();
 
@@ -476,12 +700,47 @@ class Proxy : public Midi::EventHandler
          */
         void begin_processing() noexcept;
 
+        /**
+         * \brief Send the controller values which were held back by the rate
+         *        limits and deadbands of the rules and became due during the
+         *        current block, and move the proxy's clock to the beginning
+         *        of the next block.
+         */
+        void end_processing(Midi::SampleOffset const sample_count) noexcept;
+
+        /**
+         * \brief Tell whether any controller values are waiting to be sent by
+         *        a later \c end_processing() call.
+         */
+        bool has_held_controller_values() const noexcept;
+
+        /**
+         * \brief Set the sample rate which is used for converting rate limits
+         *        into sample counts. Not safe to call during processing.
+         */
+        void set_sample_rate(double const sample_rate) noexcept;
+
+        /**
+         * \brief Preallocate the outgoing event buffer for blocks of at most
+         *        the given number of samples, releasing any excess capacity.
+         *        Not safe to call during processing.
+         */
+        void reserve_out_events(size_t const max_block_size) noexcept;
+
         /**
          * \brief Thread-safe way to change the state of the object outside
          *        the audio thread.
          */
         void push_message(Message const& message) noexcept;
 
+        /**
+         * \brief Thread-safe way to replace all parameters at once outside the
+         *        audio thread, e.g. when loading a patch. Must be called from
+         *        the same thread as \c push_message(), and the snapshot takes
+         *        effect in the same order relative to the pushed messages.
+         */
+        void push_param_snapshot(ParamSnapshot const& snapshot) noexcept;
+
         /**
          * \brief Process all previously queued state changing messages inside
          *        the audio thread.
@@ -502,21 +761,54 @@ class Proxy : public Midi::EventHandler
          */
         void process_message(Message const& message) noexcept;
 
-        std::string const& get_param_name(ParamId const param_id) const noexcept;
+        /**
+         * \brief Thread-safe way to find out which parameters have changed
+         *        in the audio thread since the previous call by the same
+         *        reader. The parameters are added to \c changed_params, and
+         *        the reader's flags are cleared.
+         */
+        void collect_changed_params(
+            ChangedParams& changed_params,
+            ChangedParamsReader const reader = ChangedParamsReader::CPR_GUI
+        ) noexcept;
+
+        char const* get_param_name(ParamId const param_id) const noexcept;
         ParamId get_param_id(std::string const& name) const noexcept;
 
         unsigned int get_active_voices_count() const noexcept;
         unsigned int get_channel_count() const noexcept;
 
+        /**
+         * \brief Thread-safe way to get the voice pool telemetry as of the
+         *        beginning of the most recent block.
+         */
+        VoiceStats get_voice_stats() const noexcept;
+
+        /**
+         * \brief Number of input events that were dropped because they were
+         *        clones of an event that had already been processed in the
+         *        same block (e.g. FL Studio sends a copy of the same pitch
+         *        bend event on all 16 channels).
+         */
+        unsigned int get_suppressed_duplicates_count() const noexcept;
+
+        /**
+         * \brief Number of events that were lost because a preallocated
+         *        event buffer was full, either the outgoing event buffer of
+         *        the proxy, or one that a plugin front end reported via
+         *        \c count_dropped_events().
+         */
+        unsigned int get_dropped_events_count() const noexcept;
+
+        /**
+         * \brief Report events that had to be dropped outside the proxy
+         *        because a preallocated buffer was full.
+         */
+        void count_dropped_events(unsigned int const count) noexcept;
+
 #ifdef MPE_EMULATOR_ASSERTIONS
         bool is_lock_free() const noexcept;
 
-        void get_param_id_hash_table_statistics(
-            unsigned int& max_collisions,
-            double& avg_collisions,
-            double& avg_bucket_size
-        ) const noexcept;
-
         unsigned int get_param_value(ParamId const param_id) const noexcept;
 #endif
 
@@ -591,88 +883,213 @@ class Proxy : public Midi::EventHandler
         Param transpose_below_anchor;
         Param transpose_above_anchor;
         Param sustain_pedal_handling;
+        Param lower_split_point;
+        Param upper_split_point;
+        Param transpose_below_lower_split;
+        Param transpose_above_upper_split;
+        Param separate_split_channels;
 
         Rule rules[RULES];
 
         OutEvents const& out_events;
 
     private:
+        /**
+         * \brief Collision-free hash table for looking up parameters by
+         *        name with a single probe. The tables are generated by
+         *        \c scripts/gen_param_id_hash_table.py.
+         */
         class ParamIdHashTable
         {
             public:
-                ParamIdHashTable() noexcept;
-                ~ParamIdHashTable();
+                static ParamId lookup(std::string const& name) noexcept;
 
-                void add(std::string const& name, ParamId const param_id) noexcept;
-                ParamId lookup(std::string const& name) noexcept;
+            private:
+                static constexpr size_t NAME_SIZE = 8;
+                static constexpr size_t HASH_BITS = 9;
+                static constexpr size_t ENTRIES = 1 << HASH_BITS;
+                static constexpr int SHIFT = 64 - HASH_BITS;
 
-#ifdef MPE_EMULATOR_ASSERTIONS
-                void get_statistics(
-                    unsigned int& max_collisions,
-                    double& avg_collisions,
-                    double& avg_bucket_size
-                ) const noexcept;
-#endif
+                static uint64_t const MULTIPLIER;
+                static uint64_t const KEYS[ENTRIES];
+                static ParamId const PARAM_IDS[ENTRIES];
+
+                static uint64_t encode(std::string const& name) noexcept;
+                static size_t hash(uint64_t const key) noexcept;
+        };
+
+        /**
+         * \brief Recognize clones of the same input event which arrive on
+         *        multiple channels within the same processing block. Lookup
+         *        and insertion are O(1), and starting a new block does not
+         *        need to touch the whole table.
+         */
+        class DuplicateFilter
+        {
+            public:
+                enum EventType {
+                    NOTE_ON = 0,
+                    NOTE_OFF = 1,
+                    CONTROLLER = 2,
+                };
+
+                DuplicateFilter() noexcept;
+
+                void begin_block() noexcept;
+                void clear() noexcept;
+
+                void set_window(Midi::SampleOffset const window) noexcept;
+                Midi::SampleOffset get_window() const noexcept;
+
+                bool is_duplicate(
+                    EventType const event_type,
+                    Midi::Byte const key,
+                    Midi::SampleOffset const sample_offset,
+                    Midi::Word const value
+                ) noexcept;
+
+                void forget(EventType const event_type, Midi::Byte const key) noexcept;
 
             private:
                 class Entry
                 {
                     public:
-                        static constexpr size_t NAME_SIZE = 8;
-                        static constexpr size_t NAME_MAX_INDEX = NAME_SIZE - 1;
-
                         Entry() noexcept;
 
-                        Entry(
-                            const char* const name,
-                            ParamId const param_id
-                        ) noexcept;
+                        Midi::SampleOffset sample_offset;
+                        unsigned int block;
+                        Midi::Word value;
+                };
+
+                static constexpr size_t CONTROLLERS_OFFSET = 2 * Midi::NOTES;
+
+                static constexpr size_t ENTRIES = (
+                    CONTROLLERS_OFFSET + ControllerId::CONTROLLER_ID_COUNT
+                );
 
-                        ~Entry();
+                static size_t get_index(
+                    EventType const event_type,
+                    Midi::Byte const key
+                ) noexcept;
+
+                Entry entries[ENTRIES];
+                Midi::SampleOffset window;
+                unsigned int block;
+        };
+
+        /**
+         * \brief The last value that was sent for each controller on each
+         *        channel, so that resets which would not change anything can
+         *        be left out. The values are stored in their 7 or 14 bit MIDI
+         *        representation.
+         */
+        class OutputState
+        {
+            public:
+                static constexpr Midi::Word UNKNOWN = 0xffff;
+
+                OutputState() noexcept;
+
+                void clear() noexcept;
+
+                Midi::Word get(
+                    Midi::Channel const channel,
+                    ControllerId const controller_id
+                ) const noexcept;
+
+                bool holds(
+                    Midi::Channel const channel,
+                    ControllerId const controller_id,
+                    Midi::Word const value
+                ) const noexcept;
 
-                        void set(
-                            const char* const name,
-                            ParamId const param_id
-                        ) noexcept;
+                void store(
+                    Midi::Channel const channel,
+                    ControllerId const controller_id,
+                    Midi::Word const value
+                ) noexcept;
 
-                        Entry *next;
-                        char name[NAME_SIZE];
-                        ParamId param_id;
+            private:
+                Midi::Word values[Midi::CHANNELS][ControllerId::CONTROLLER_ID_COUNT];
+        };
+
+        /**
+         * \brief Controller values which were held back by the rate limits and
+         *        deadbands of the rules, with one slot for each rule and
+         *        channel. The slots which hold a value are also listed in a
+         *        compact array, so that finding the due ones does not need to
+         *        walk the whole table, and releasing a slot is O(1).
+         */
+        class RateLimiter
+        {
+            public:
+                typedef uint64_t Time;
+
+                static constexpr Time NEVER = std::numeric_limits<Time>::max();
+                static constexpr size_t SLOTS = RULES * Midi::CHANNELS;
+                static constexpr Midi::Byte NOT_HELD = 0xff;
+
+                static_assert(SLOTS < (size_t)NOT_HELD, "Slot indices must fit in a byte");
+
+                class Slot
+                {
+                    public:
+                        Slot() noexcept;
+
+                        Time last_sent;
+                        Time deadline;
+                        double value;
+                        ControllerId controller_id;
+                        Midi::Byte held_index;
                 };
 
-                static constexpr size_t ENTRIES = 0x80;
-                static constexpr size_t MASK = ENTRIES - 1;
-                static constexpr int MULTIPLIER = 1679;
-                static constexpr int SHIFT = 5;
+                static size_t get_slot_index(
+                    size_t const rule_index,
+                    Midi::Channel const channel
+                ) noexcept;
+
+                static Midi::Channel get_channel(size_t const slot_index) noexcept;
 
-                static int hash(std::string const& name) noexcept;
+                RateLimiter() noexcept;
 
-                void lookup(
-                    std::string const& name,
-                    Entry** root,
-                    Entry** parent,
-                    Entry** entry
+                void clear() noexcept;
+
+                void hold(
+                    size_t const slot_index,
+                    Time const deadline,
+                    ControllerId const controller_id,
+                    double const value
                 ) noexcept;
 
-                Entry entries[ENTRIES];
+                void release(size_t const slot_index) noexcept;
+
+                Slot slots[SLOTS];
+                Midi::Byte held[SLOTS];
+                size_t held_count;
         };
 
-        class MidiControllerMessage
+        /**
+         * \brief The set of channels which have at least one active note, kept
+         *        as a bit mask, so that sending an event to all of them does
+         *        not need to walk a note stack.
+         */
+        class ActiveChannels
         {
             public:
-                MidiControllerMessage();
-                MidiControllerMessage(MidiControllerMessage const& message) = default;
-                MidiControllerMessage(MidiControllerMessage&& message) = default;
+                typedef uint16_t Mask;
+
+                static Mask to_mask(Midi::Channel const channel) noexcept;
 
-                MidiControllerMessage(double const time_offset, Midi::Word const value);
+                ActiveChannels() noexcept;
 
-                bool operator==(MidiControllerMessage const& message) const noexcept;
-                MidiControllerMessage& operator=(MidiControllerMessage const& message) noexcept = default;
-                MidiControllerMessage& operator=(MidiControllerMessage&& message) noexcept = default;
+                void clear() noexcept;
+                void add(Midi::Channel const channel) noexcept;
+                void remove(Midi::Channel const channel) noexcept;
+                Mask get_mask() const noexcept;
 
             private:
-                double time_offset;
-                Midi::Word value;
+                Midi::Byte notes[Midi::CHANNELS];
+                Mask mask;
         };
 
         struct ZoneTypeDescriptor
@@ -687,18 +1104,34 @@ class Proxy : public Midi::EventHandler
         };
 
         static constexpr SPSCQueue<Message>::SizeType MESSAGE_QUEUE_SIZE = 8192;
+        static constexpr SPSCQueue<Message>::SizeType MESSAGE_BATCH_SIZE = 64;
 
-        static ParamIdHashTable param_id_hash_table;
-        static std::string param_names_by_id[ParamId::PARAM_ID_COUNT];
+        static char const* const PARAM_NAMES[ParamId::PARAM_ID_COUNT];
 
         static constexpr size_t MPE_MEMBER_CHANNELS_MAX = Midi::CHANNELS - 1;
 
+        static constexpr double RATE_LIMIT_FREQUENCIES[RateLimit::RATE_LIMITS] = {
+            [RateLimit::RL_OFF] = 0.0,
+            [RateLimit::RL_1000_HZ] = 1000.0,
+            [RateLimit::RL_500_HZ] = 500.0,
+            [RateLimit::RL_250_HZ] = 250.0,
+            [RateLimit::RL_100_HZ] = 100.0,
+            [RateLimit::RL_50_HZ] = 50.0,
+            [RateLimit::RL_25_HZ] = 25.0,
+        };
+
+        /**
+         * \brief How long (in seconds) a controller needs to stay within the
+         *        deadband before the value that was held back is sent.
+         */
+        static constexpr double GESTURE_END_TIME = 0.04;
+
         void register_param(ParamId const param_id, Param& param) noexcept;
 
-        bool is_repeated_midi_controller_message(
-            ControllerId const controller_id,
-            double const time_offset,
-            Midi::Channel const channel,
+        bool is_duplicate(
+            DuplicateFilter::EventType const event_type,
+            Midi::Byte const key,
+            Midi::SampleOffset const sample_offset,
             Midi::Word const value
         ) noexcept;
 
@@ -710,6 +1143,15 @@ class Proxy : public Midi::EventHandler
         void reset() noexcept;
 
         void reset_available_channels() noexcept;
+        void update_split_tables() noexcept;
+
+        void set_channel_state(
+            Midi::Channel const channel,
+            VoiceStats::ChannelState const state,
+            Midi::Note const note
+        ) noexcept;
+
+        void publish_voice_stats() noexcept;
 
         bool handle_set_param(
             ParamId const param_id,
@@ -717,7 +1159,9 @@ class Proxy : public Midi::EventHandler
         ) noexcept;
 
         void handle_refresh_param(ParamId const param_id) noexcept;
+        void mark_param_as_changed(ParamId const param_id) noexcept;
         bool handle_clear() noexcept;
+        bool handle_apply_param_snapshot(uint64_t const sequence) noexcept;
         double get_param_ratio(ParamId const param_id) const noexcept;
         bool update_zone_config() noexcept;
         void stop_all_notes() noexcept;
@@ -731,8 +1175,40 @@ class Proxy : public Midi::EventHandler
 
         void reset_rules_and_global_controllers() noexcept;
 
+        void update_rate_limit_intervals() noexcept;
+
+        static Midi::Word encode_controller_value(
+            ControllerId const controller_id,
+            double const value
+        ) noexcept;
+
+        void push_rate_limited_controller_event(
+            size_t const rule_index,
+            Midi::SampleOffset const sample_offset,
+            Midi::Channel const channel,
+            ControllerId const controller_id,
+            double const value
+        ) noexcept;
+
+        void push_held_controller_events(
+            RateLimiter::Time const next_block_time
+        ) noexcept;
+
+        void drop_held_controller_values(
+            Midi::Channel const channel,
+            ControllerId const controller_id
+        ) noexcept;
+
         void push_controller_event(
-            double const time_offset,
+            Midi::SampleOffset const sample_offset,
+            Midi::Channel const channel,
+            ControllerId const controller_id,
+            double const value,
+            bool const is_note_on_setup = false
+        ) noexcept;
+
+        void push_reset_event(
+            Midi::SampleOffset const sample_offset,
             Midi::Channel const channel,
             ControllerId const controller_id,
             double const value,
@@ -740,7 +1216,7 @@ class Proxy : public Midi::EventHandler
         ) noexcept;
 
         void push_note_on(
-            double const time_offset,
+            Midi::SampleOffset const sample_offset,
             Midi::Channel const channel,
             Midi::Note const note,
             Midi::Byte velocity
@@ -748,26 +1224,28 @@ class Proxy : public Midi::EventHandler
 
         template<bool is_note_on_setup>
         void push_resets_for_new_note(
-                double const time_offset,
+                Midi::SampleOffset const sample_offset,
                 Midi::Channel const new_note_channel,
                 bool const is_first_note,
-                bool const is_above_anchor,
+                Split const split,
                 NoteStack::ChannelStats const& old_channel_stats,
                 NoteStack::ChannelStats const& old_channel_stats_below,
-                NoteStack::ChannelStats const& old_channel_stats_above
+                NoteStack::ChannelStats const& old_channel_stats_above,
+                NoteStack::ChannelStats const& old_channel_stats_split
         ) noexcept;
 
         void push_resets_for_note_off(
-            double const time_offset,
-            bool const was_above_anchor,
+            Midi::SampleOffset const sample_offset,
+            Split const split,
             NoteStack::ChannelStats const& old_channel_stats,
             NoteStack::ChannelStats const& old_channel_stats_below,
-            NoteStack::ChannelStats const& old_channel_stats_above
+            NoteStack::ChannelStats const& old_channel_stats_above,
+            NoteStack::ChannelStats const& old_channel_stats_split
         ) noexcept;
 
         void reset_outdated_targets_if_changed(
             Rule const& rule,
-            double const time_offset,
+            Midi::SampleOffset const sample_offset,
             Midi::Channel const new_note_channel,
             NoteStack::ChannelStats const& a_channel_stats,
             NoteStack::ChannelStats const& a_channel_stats_below,
@@ -779,14 +1257,41 @@ class Proxy : public Midi::EventHandler
             ControllerId const out_cc
         ) noexcept;
 
+        void reset_outdated_split_target_if_changed(
+            Rule const& rule,
+            Midi::SampleOffset const sample_offset,
+            Midi::Channel const new_note_channel,
+            Split const split,
+            NoteStack::ChannelStats const& a_channel_stats,
+            NoteStack::ChannelStats const& b_channel_stats,
+            double const reset_value,
+            ControllerId const out_cc
+        ) noexcept;
+
+        /**
+         * \brief Find the channel of a single note target within a split.
+         *        Targets which are restricted to the other side of the anchor
+         *        yield \c Midi::INVALID_CHANNEL.
+         */
+        static Midi::Channel get_split_target_channel(
+            Target const target,
+            Split const split,
+            NoteStack::ChannelStats const& channel_stats
+        ) noexcept;
+
+        ActiveChannels::Mask get_split_target_channels(
+            Target const target,
+            Split const split
+        ) const noexcept;
+
         void handle_note_off(
-            double const time_offset,
+            Midi::SampleOffset const sample_offset,
             Midi::Note const note,
             Midi::Byte const velocity
         ) noexcept;
 
         void push_note_off(
-            double const time_offset,
+            Midi::SampleOffset const sample_offset,
             Midi::Channel const channel,
             Midi::Note const note,
             Midi::Byte const velocity
@@ -794,50 +1299,53 @@ class Proxy : public Midi::EventHandler
 
         template<Midi::Command midi_command>
         void process_controller_event(
-            double const time_offset,
+            Midi::SampleOffset const sample_offset,
             ControllerId const controller_id,
             double const value
         ) noexcept;
 
-        void process_deferred_note_offs(double const time_offset) noexcept;
+        void process_deferred_note_offs(Midi::SampleOffset const sample_offset) noexcept;
 
         template<Midi::Command midi_command>
         void push_controller_event(
-            double const time_offset,
+            Midi::SampleOffset const sample_offset,
             Midi::Channel const channel,
             ControllerId const controller_id,
             double const value,
             bool const is_note_on_setup = false
         ) noexcept;
 
-        void push_out_event(Midi::Event const& event) noexcept;
-
-        Midi::Note transpose(
-            Midi::Note const note,
-            bool const is_above_anchor
-        ) const noexcept;
+        void push_out_event(
+            Midi::SampleOffset const sample_offset,
+            Midi::Command const command,
+            Midi::Channel const channel,
+            Midi::Byte const data_1 = 0,
+            Midi::Byte const data_2 = 0,
+            bool const is_pre_note_on_setup = false
+        ) noexcept;
 
-        OutEvents out_events_rw;
-        MidiControllerMessage previous_controller_message[ControllerId::CONTROLLER_ID_COUNT];
-        Param* params[ParamId::PARAM_ID_COUNT];
-        Queue<Midi::Channel, MPE_MEMBER_CHANNELS_MAX> available_channels;
-        NoteStack::ChannelsByNotes channels_by_notes;
-        BasicNoteStack deferred_note_offs;
-        Midi::Byte deferred_note_off_velocities[Midi::NOTES];
-        Midi::Byte velocities_by_notes[Midi::NOTES];
-        std::atomic<double> param_ratios_atomic[ParamId::PARAM_ID_COUNT];
-        SPSCQueue<Message> messages;
-        std::atomic<unsigned int> active_voices_count_atomic;
-        std::atomic<unsigned int> channel_count_atomic;
-        NoteStack note_stack;
-        NoteStack note_stack_below;
-        NoteStack note_stack_above;
+        /*
+        The state which is used for almost every event comes first, so that it
+        occupies as few cache lines as possible, followed by the larger tables
+        which are used less often. The state which is shared with other threads
+        is kept at the end, so that writing it does not invalidate the cache
+        lines of the hot state in other cores.
+        */
         NoteStack::ChannelStats channel_stats;
         NoteStack::ChannelStats channel_stats_below;
         NoteStack::ChannelStats channel_stats_above;
+        NoteStack::ChannelStats channel_stats_by_splits[Split::SPLITS];
+        ActiveChannels active_channels_below;
+        ActiveChannels active_channels_above;
+        ActiveChannels active_channels_by_splits[Split::SPLITS];
+        Midi::Byte pools_by_splits[Split::SPLITS];
+        int offset_below_lower_split;
         int offset_below_anchor;
         int offset_above_anchor;
+        int offset_above_upper_split;
+        Midi::Note lower_split_point_;
         Midi::Note anchor_;
+        Midi::Note upper_split_point_;
         Midi::Channel channel_count;
         Midi::Channel manager_channel;
         Midi::Channel channel_increment;
@@ -848,6 +1356,44 @@ class Proxy : public Midi::EventHandler
         bool is_dirty_;
         bool had_reset;
         bool is_sustain_pedal_on;
+        bool has_voice_stats_changed;
+        bool has_separate_split_channels;
+
+        NoteStack::ChannelsByNotes channels_by_notes;
+        Midi::Byte velocities_by_notes[Midi::NOTES];
+        Midi::Byte splits_by_notes[Midi::NOTES];
+        Midi::Note transposed_notes[Midi::NOTES];
+        NoteStack note_stack;
+        NoteStack note_stack_below;
+        NoteStack note_stack_above;
+        NoteStack note_stacks_by_splits[Split::SPLITS];
+        Queue<Midi::Channel, MPE_MEMBER_CHANNELS_MAX> available_channels[Split::SPLITS];
+        OutEvents out_events_rw;
+
+        OutputState output_state;
+        RateLimiter rate_limiter;
+        RateLimiter::Time rate_limit_intervals[RateLimit::RATE_LIMITS];
+        RateLimiter::Time gesture_end_samples;
+        RateLimiter::Time elapsed_samples;
+        double sample_rate;
+        DuplicateFilter duplicate_filter;
+        BasicNoteStack deferred_note_offs;
+        Midi::Byte deferred_note_off_velocities[Midi::NOTES];
+        Param* params[ParamId::PARAM_ID_COUNT];
+        uint64_t param_snapshot_sequence;
+        VoiceStats voice_stats;
+
+        SPSCQueue<Message> messages;
+        TripleBuffer<ParamSnapshot> param_snapshots;
+        SeqLock<double> param_ratios_atomic[ParamId::PARAM_ID_COUNT];
+        std::atomic<ChangedParams::Word> changed_params_atomic[
+            ChangedParamsReader::CPR_COUNT
+        ][ChangedParams::WORDS];
+        SeqLock<VoiceStats> voice_stats_atomic;
+        std::atomic<unsigned int> active_voices_count_atomic;
+        std::atomic<unsigned int> channel_count_atomic;
+        std::atomic<unsigned int> suppressed_duplicates_count_atomic;
+        std::atomic<unsigned int> dropped_events_count_atomic;
 };
 
 }
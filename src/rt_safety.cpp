@@ -0,0 +1,380 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef MPE_EMULATOR__RT_SAFETY_CPP
+#define MPE_EMULATOR__RT_SAFETY_CPP
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#ifdef __GLIBC__
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "rt_safety.hpp"
+
+#include "common.hpp"
+
+
+namespace MpeEmulator
+{
+
+thread_local int RealTimeSafety::depth = 0;
+
+std::atomic<uint64_t> RealTimeSafety::violations[Violation::V_COUNT] = {{0}, {0}, {0}};
+std::atomic<char const*> RealTimeSafety::last_violation("");
+std::atomic<int> RealTimeSafety::mode(Mode::MODE_COUNT);
+
+
+RealTimeSafety::Scope::Scope() noexcept
+{
+    ++depth;
+}
+
+
+RealTimeSafety::Scope::~Scope()
+{
+    --depth;
+}
+
+
+RealTimeSafety::Exemption::Exemption() noexcept : saved_depth(depth)
+{
+    depth = 0;
+}
+
+
+RealTimeSafety::Exemption::~Exemption()
+{
+    depth = saved_depth;
+}
+
+
+bool RealTimeSafety::is_in_scope() noexcept
+{
+    return depth > 0;
+}
+
+
+void RealTimeSafety::set_mode(Mode const mode) noexcept
+{
+    RealTimeSafety::mode.store(mode);
+}
+
+
+void RealTimeSafety::check(
+        Violation const violation,
+        char const* const function
+) noexcept {
+    if (MPE_EMULATOR_LIKELY(depth <= 0)) {
+        return;
+    }
+
+    violations[violation].fetch_add(1);
+    last_violation.store(function);
+
+    if (mode.load() == Mode::MODE_ABORT) {
+        /* Reporting the violation must not count as another one. */
+        depth = 0;
+
+        fprintf(stderr, "Real-time safety violation: %s()\n", function);
+        fflush(stderr);
+
+#ifdef __GLIBC__
+        void* backtrace_buffer[64];
+        int const backtrace_size = backtrace(backtrace_buffer, 64);
+
+        backtrace_symbols_fd(backtrace_buffer, backtrace_size, 2);
+#endif
+
+        abort();
+    }
+}
+
+
+uint64_t RealTimeSafety::get_violations(Violation const violation) noexcept
+{
+    return violations[violation].load();
+}
+
+
+uint64_t RealTimeSafety::get_total_violations() noexcept
+{
+    uint64_t total = 0;
+
+    for (size_t i = 0; i != Violation::V_COUNT; ++i) {
+        total += violations[i].load();
+    }
+
+    return total;
+}
+
+
+char const* RealTimeSafety::get_last_violation() noexcept
+{
+    return last_violation.load();
+}
+
+
+void RealTimeSafety::reset() noexcept
+{
+    for (size_t i = 0; i != Violation::V_COUNT; ++i) {
+        violations[i].store(0);
+    }
+
+    last_violation.store("");
+}
+
+}
+
+
+/*
+On glibc, the allocator functions are replaced, which covers operator new and
+delete as well, and blocking calls are forwarded to the next definition of the
+symbol after being checked. Elsewhere, only operator new and delete can be
+replaced portably.
+*/
+#ifdef __GLIBC__
+
+extern "C" {
+
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+
+void* malloc(size_t size) noexcept
+{
+    MpeEmulator::RealTimeSafety::check(
+        MpeEmulator::RealTimeSafety::Violation::V_ALLOCATION, "malloc"
+    );
+
+    return __libc_malloc(size);
+}
+
+
+void* calloc(size_t count, size_t size) noexcept
+{
+    MpeEmulator::RealTimeSafety::check(
+        MpeEmulator::RealTimeSafety::Violation::V_ALLOCATION, "calloc"
+    );
+
+    return __libc_calloc(count, size);
+}
+
+
+void* realloc(void* ptr, size_t size) noexcept
+{
+    MpeEmulator::RealTimeSafety::check(
+        MpeEmulator::RealTimeSafety::Violation::V_ALLOCATION, "realloc"
+    );
+
+    return __libc_realloc(ptr, size);
+}
+
+
+void free(void* ptr) noexcept
+{
+    if (ptr != NULL) {
+        MpeEmulator::RealTimeSafety::check(
+            MpeEmulator::RealTimeSafety::Violation::V_DEALLOCATION, "free"
+        );
+    }
+
+    __libc_free(ptr);
+}
+
+}
+
+
+#define MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(name, ...) do {               \
+    static decltype(&name) next = NULL;                                     \
+                                                                            \
+    MpeEmulator::RealTimeSafety::check(                                     \
+        MpeEmulator::RealTimeSafety::Violation::V_BLOCKING_CALL, #name      \
+    );                                                                      \
+                                                                            \
+    if (MPE_EMULATOR_UNLIKELY(next == NULL)) {                              \
+        next = (decltype(&name))dlsym(RTLD_NEXT, #name);                    \
+    }                                                                       \
+                                                                            \
+    return next(__VA_ARGS__);                                               \
+} while (false)
+
+
+extern "C" {
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(pthread_mutex_lock, mutex);
+}
+
+
+int pthread_cond_wait(pthread_cond_t* cond, pthread_mutex_t* mutex)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(pthread_cond_wait, cond, mutex);
+}
+
+
+int pthread_join(pthread_t thread, void** retval)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(pthread_join, thread, retval);
+}
+
+
+int nanosleep(struct timespec const* duration, struct timespec* remaining)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(nanosleep, duration, remaining);
+}
+
+
+int usleep(useconds_t usec)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(usleep, usec);
+}
+
+
+unsigned int sleep(unsigned int seconds)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(sleep, seconds);
+}
+
+
+ssize_t read(int fd, void* buffer, size_t count)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(read, fd, buffer, count);
+}
+
+
+ssize_t write(int fd, void const* buffer, size_t count)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(write, fd, buffer, count);
+}
+
+
+FILE* fopen(char const* path, char const* mode)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(fopen, path, mode);
+}
+
+
+int fclose(FILE* stream)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(fclose, stream);
+}
+
+
+size_t fread(void* buffer, size_t size, size_t count, FILE* stream)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(fread, buffer, size, count, stream);
+}
+
+
+size_t fwrite(void const* buffer, size_t size, size_t count, FILE* stream)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(fwrite, buffer, size, count, stream);
+}
+
+
+int fflush(FILE* stream)
+{
+    MPE_EMULATOR_RT_FORWARD_BLOCKING_CALL(fflush, stream);
+}
+
+}
+
+#else
+
+void* operator new(std::size_t size)
+{
+    MpeEmulator::RealTimeSafety::check(
+        MpeEmulator::RealTimeSafety::Violation::V_ALLOCATION, "operator new"
+    );
+
+    void* const ptr = std::malloc(size == 0 ? 1 : size);
+
+    if (ptr == NULL) {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+    MpeEmulator::RealTimeSafety::check(
+        MpeEmulator::RealTimeSafety::Violation::V_ALLOCATION, "operator new"
+    );
+
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+
+void* operator new[](std::size_t size, std::nothrow_t const& nothrow) noexcept
+{
+    return operator new(size, nothrow);
+}
+
+
+void operator delete(void* ptr) noexcept
+{
+    if (ptr != NULL) {
+        MpeEmulator::RealTimeSafety::check(
+            MpeEmulator::RealTimeSafety::Violation::V_DEALLOCATION,
+            "operator delete"
+        );
+    }
+
+    std::free(ptr);
+}
+
+
+void operator delete[](void* ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+
+void operator delete(void* ptr, std::size_t size) noexcept
+{
+    operator delete(ptr);
+}
+
+
+void operator delete[](void* ptr, std::size_t size) noexcept
+{
+    operator delete(ptr);
+}
+
+#endif
+
+#endif
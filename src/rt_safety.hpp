@@ -0,0 +1,133 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef MPE_EMULATOR__RT_SAFETY_HPP
+#define MPE_EMULATOR__RT_SAFETY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+/*
+MPE_EMULATOR_RT_SCOPE() marks the rest of the enclosing block as real-time
+code. In builds which define MPE_EMULATOR_RT_SAFETY_CHECKS and link
+src/rt_safety.cpp (only the tests do that), memory allocation and blocking
+calls which are made on the thread while such a scope is active are counted
+as violations, or abort the program, depending on RealTimeSafety::Mode.
+
+MPE_EMULATOR_RT_EXEMPT() suspends the checks for the rest of the enclosing
+block; it is meant only for known, documented exceptions which are waiting to
+be fixed, so that they don't hide new regressions.
+*/
+#ifdef MPE_EMULATOR_RT_SAFETY_CHECKS
+
+#define MPE_EMULATOR_RT_SCOPE()                                             \
+    ::MpeEmulator::RealTimeSafety::Scope const _mpe_rt_scope
+
+#define MPE_EMULATOR_RT_EXEMPT()                                            \
+    ::MpeEmulator::RealTimeSafety::Exemption const _mpe_rt_exemption
+
+#else
+
+#define MPE_EMULATOR_RT_SCOPE()
+#define MPE_EMULATOR_RT_EXEMPT()
+
+#endif
+
+
+namespace MpeEmulator
+{
+
+class RealTimeSafety
+{
+    public:
+        enum Violation {
+            V_ALLOCATION = 0,
+            V_DEALLOCATION = 1,
+            V_BLOCKING_CALL = 2,
+
+            V_COUNT = 3,
+        };
+
+        enum Mode {
+            MODE_COUNT = 0,
+            MODE_ABORT = 1,
+        };
+
+        class Scope
+        {
+            public:
+                Scope() noexcept;
+                ~Scope();
+
+                Scope(Scope const& scope) = delete;
+        };
+
+        class Exemption
+        {
+            public:
+                Exemption() noexcept;
+                ~Exemption();
+
+                Exemption(Exemption const& exemption) = delete;
+
+            private:
+                int const saved_depth;
+        };
+
+        static bool is_in_scope() noexcept;
+
+        static void set_mode(Mode const mode) noexcept;
+
+        /**
+         * \brief Register a violation if the calling thread is inside a
+         *        real-time scope.
+         *
+         * \param violation     The kind of the violation.
+         * \param function      Name of the offending function; must be a
+         *                      string literal.
+         */
+        static void check(
+            Violation const violation,
+            char const* const function
+        ) noexcept;
+
+        static uint64_t get_violations(Violation const violation) noexcept;
+        static uint64_t get_total_violations() noexcept;
+
+        /**
+         * \brief Name of the function which caused the most recent violation,
+         *        or an empty string if there were none since the last reset.
+         */
+        static char const* get_last_violation() noexcept;
+
+        static void reset() noexcept;
+
+    private:
+        static thread_local int depth;
+
+        static std::atomic<uint64_t> violations[Violation::V_COUNT];
+        static std::atomic<char const*> last_violation;
+        static std::atomic<int> mode;
+};
+
+}
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2023, 2024  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPE_EMULATOR__SEQLOCK_CPP
+#define MPE_EMULATOR__SEQLOCK_CPP
+
+#include <cstring>
+
+#include "seqlock.hpp"
+
+
+namespace MpeEmulator
+{
+
+template<class Item>
+SeqLock<Item>::SeqLock() noexcept : sequence(0)
+{
+    for (size_t i = 0; i != WORDS; ++i) {
+        words[i].store(0);
+    }
+}
+
+
+template<class Item>
+bool SeqLock<Item>::is_lock_free() const noexcept
+{
+    bool is_lock_free = sequence.is_lock_free();
+
+    for (size_t i = 0; is_lock_free && i != WORDS; ++i) {
+        is_lock_free = words[i].is_lock_free();
+    }
+
+    return is_lock_free;
+}
+
+
+template<class Item>
+void SeqLock<Item>::store(Item const& item) noexcept
+{
+    Word buffer[WORDS] = {};
+
+    memcpy(buffer, &item, sizeof(Item));
+
+    Word const old_sequence = sequence.load(std::memory_order_relaxed);
+
+    sequence.store(old_sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i != WORDS; ++i) {
+        words[i].store(buffer[i], std::memory_order_relaxed);
+    }
+
+    sequence.store(old_sequence + 2, std::memory_order_release);
+}
+
+
+template<class Item>
+Item SeqLock<Item>::load() const noexcept
+{
+    Word buffer[WORDS];
+    Word sequence_before;
+    Word sequence_after;
+
+    do {
+        sequence_before = sequence.load(std::memory_order_acquire);
+
+        for (size_t i = 0; i != WORDS; ++i) {
+            buffer[i] = words[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        sequence_after = sequence.load(std::memory_order_relaxed);
+    } while ((sequence_before & 1) != 0 || sequence_before != sequence_after);
+
+    Item item;
+
+    memcpy(&item, buffer, sizeof(Item));
+
+    return item;
+}
+
+}
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2023, 2024  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPE_EMULATOR__SEQLOCK_HPP
+#define MPE_EMULATOR__SEQLOCK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace MpeEmulator
+{
+
+/*
+See Hans-J. Boehm [MSPC 2012]: Can Seqlocks Get Along With Programming
+Language Memory Models?
+  https://www.hpl.hp.com/techreports/2012/HPL-2012-68.pdf
+*/
+
+/**
+ * \brief Share a trivially copyable object between a single writer thread and
+ *        any number of reader threads. The object is stored in 32 bit atomic
+ *        words, which are lock-free on all supported platforms, including
+ *        32 bit ones where e.g. \c std::atomic<double> may not be.
+ *
+ * The writer never waits. Readers retry while an update is in progress.
+ */
+template<class Item>
+class SeqLock
+{
+    public:
+        SeqLock() noexcept;
+
+        SeqLock(SeqLock<Item> const& seqlock) = delete;
+
+        bool is_lock_free() const noexcept;
+
+        /**
+         * \brief Replace the object. Must always be called from the same thread.
+         */
+        void store(Item const& item) noexcept;
+
+        /**
+         * \brief Get the most recently stored object. May be called from any
+         *        thread.
+         */
+        Item load() const noexcept;
+
+    private:
+        typedef uint32_t Word;
+
+        static constexpr size_t WORDS = (
+            (sizeof(Item) + sizeof(Word) - 1) / sizeof(Word)
+        );
+
+        std::atomic<Word> sequence;
+        std::atomic<Word> words[WORDS];
+};
+
+}
+
+#endif
@@ -20,11 +20,13 @@
 #define MPE_EMULATOR__SERIALIZER_CPP
 
 #include <algorithm>
+#include <charconv>
 #include <cmath>
 #include <cctype>
 #include <cstdio>
 #include <cstring>
 #include <sstream>
+#include <system_error>
 
 #include "serializer.hpp"
 
@@ -35,45 +37,139 @@ namespace MpeEmulator
 std::string const Serializer::LINE_END = "\r\n";
 
 
+thread_local Serializer::CachedParamLine Serializer::param_line_cache[
+    Proxy::ParamId::PARAM_ID_COUNT
+];
+
+
 std::string Serializer::serialize(Proxy const& proxy) noexcept
 {
-    constexpr size_t line_size = 128;
-    char line[line_size];
-    std::string serialized("");
+    size_t const section_name_length = strlen(MPE_EMULATOR_SECTION_NAME);
+    std::string serialized;
+
+    /*
+    The result is written directly into a buffer that is large enough for
+    all parameters, so the only allocation is this one.
+    */
+    serialized.resize(SERIALIZED_MAX_LENGTH);
+
+    char* const begin = &serialized[0];
+    char* next = begin;
 
-    serialized.reserve(MAX_SIZE);
-    serialized += "[";
-    serialized += MPE_EMULATOR_SECTION_NAME;
-    serialized += "]";
-    serialized += LINE_END;
+    *next++ = '[';
+    memcpy(next, MPE_EMULATOR_SECTION_NAME, section_name_length);
+    next += section_name_length;
+    *next++ = ']';
+    memcpy(next, LINE_END.data(), LINE_END.length());
+    next += LINE_END.length();
 
     for (int i = 0; i != Proxy::ParamId::PARAM_ID_COUNT; ++i) {
         Proxy::ParamId const param_id = (Proxy::ParamId)i;
-        std::string const param_name = proxy.get_param_name(param_id);
-
-        if (param_name.length() > 0) {
-            double const set_ratio = proxy.get_param_ratio_atomic(param_id);
-            double const default_ratio = proxy.get_param_default_ratio(param_id);
-
-            if (std::fabs(default_ratio - set_ratio) > 0.000001) {
-                int const length = snprintf(
-                    line,
-                    line_size,
-                    "%s = %.15f",
-                    param_name.c_str(),
-                    set_ratio
-                );
-                trim_excess_zeros_from_end_after_snprintf(line, length, line_size);
-                serialized += line;
-                serialized += LINE_END;
-            }
+        char const* const param_name = proxy.get_param_name(param_id);
+
+        if (param_name[0] == '\x00') {
+            continue;
+        }
+
+        double const set_ratio = proxy.get_param_ratio_atomic(param_id);
+        double const default_ratio = proxy.get_param_default_ratio(param_id);
+
+        if (std::fabs(default_ratio - set_ratio) <= 0.000001) {
+            continue;
+        }
+
+        CachedParamLine& cached = param_line_cache[i];
+
+        if (cached.length == 0 || cached.ratio != set_ratio) {
+            cached.ratio = set_ratio;
+            cached.length = format_param_line(cached.text, param_name, set_ratio);
         }
+
+        memcpy(next, cached.text, cached.length);
+        next += cached.length;
     }
 
+    serialized.resize((size_t)(next - begin));
+
     return serialized;
 }
 
 
+size_t Serializer::format_param_line(
+        char* const line,
+        char const* const param_name,
+        double const ratio
+) noexcept {
+    size_t const param_name_length = strlen(param_name);
+    char* const number_limit = line + PARAM_LINE_MAX_LENGTH - LINE_END.length();
+    char* next = line;
+
+    if (MPE_EMULATOR_UNLIKELY(param_name_length + 3 >= PARAM_LINE_MAX_LENGTH)) {
+        return 0;
+    }
+
+    memcpy(next, param_name, param_name_length);
+    next += param_name_length;
+    memcpy(next, " = ", 3);
+    next += 3;
+
+#ifdef __cpp_lib_to_chars
+    /*
+    Fixed notation with an explicit precision produces the same digits as
+    "%.15f" would, but without parsing a format string.
+    */
+    std::to_chars_result const result = std::to_chars(
+        next, number_limit, ratio, std::chars_format::fixed, 15
+    );
+
+    if (MPE_EMULATOR_UNLIKELY(result.ec != std::errc())) {
+        return 0;
+    }
+
+    next = trim_excess_zeros_from_end(next, result.ptr);
+#else
+    /*
+    Floating point std::to_chars() is missing from the standard library of
+    older compilers, e.g. GCC 10 which is used for MinGW-w64 cross-compiling
+    on Ubuntu 22.04.
+    */
+    size_t const max_length = (size_t)(number_limit - next);
+    int const length = snprintf(next, max_length, "%.15f", ratio);
+
+    if (MPE_EMULATOR_UNLIKELY(length < 1 || (size_t)length >= max_length)) {
+        return 0;
+    }
+
+    trim_excess_zeros_from_end_after_snprintf(next, length, max_length);
+    next += strlen(next);
+#endif
+    memcpy(next, LINE_END.data(), LINE_END.length());
+    next += LINE_END.length();
+
+    return (size_t)(next - line);
+}
+
+
+char* Serializer::trim_excess_zeros_from_end(
+        char* const number,
+        char* const end
+) noexcept {
+    char const* const dot = std::find(number, end, '.');
+
+    if (dot == end) {
+        return end;
+    }
+
+    char* new_end = end;
+
+    while (new_end - 1 > dot && *(new_end - 1) == '0') {
+        --new_end;
+    }
+
+    return new_end == end ? end : new_end + 1;
+}
+
+
 void Serializer::trim_excess_zeros_from_end_after_snprintf(
         char* const number,
         int const length,
@@ -260,6 +356,29 @@ void Serializer::process_lines(Proxy& proxy, Lines* const lines) noexcept
         }
     }
 
+    if constexpr (thread == Thread::GUI) {
+        /*
+        Instead of flooding the message queue and letting the audio thread
+        apply the parameters one by one, the whole state is handed over at
+        once.
+        */
+        Proxy::ParamSnapshot snapshot;
+
+        for (int i = 0; i != Proxy::ParamId::PARAM_ID_COUNT; ++i) {
+            snapshot.ratios[i] = proxy.get_param_default_ratio((Proxy::ParamId)i);
+        }
+
+        for (Messages::const_iterator it = messages.begin(); it != messages.end(); ++it) {
+            if (it->type == Proxy::MessageType::SET_PARAM) {
+                snapshot.ratios[(size_t)it->param_id] = it->double_param;
+            }
+        }
+
+        proxy.push_param_snapshot(snapshot);
+
+        return;
+    }
+
     send_message<thread>(
         proxy,
         Proxy::Message(
@@ -93,6 +93,34 @@ class Serializer
 
         static constexpr char const* MPE_EMULATOR_SECTION_NAME = "mpeemulator";
 
+        /*
+        Long enough for the longest param name, the equal sign, a ratio with
+        15 decimal digits, and the line end.
+        */
+        static constexpr size_t PARAM_LINE_MAX_LENGTH = 48;
+
+        static constexpr size_t SERIALIZED_MAX_LENGTH = (
+            SECTION_NAME_MAX_LENGTH
+            + 4
+            + PARAM_LINE_MAX_LENGTH * (size_t)Proxy::ParamId::PARAM_ID_COUNT
+        );
+
+        /**
+         * \brief The most recently formatted line of a parameter, so that
+         *        unchanged parameters can be copied as they are.
+         */
+        class CachedParamLine
+        {
+            public:
+                double ratio;
+                size_t length;
+                char text[PARAM_LINE_MAX_LENGTH];
+        };
+
+        static thread_local CachedParamLine param_line_cache[
+            Proxy::ParamId::PARAM_ID_COUNT
+        ];
+
         template<Thread thread>
         static void import_settings(
             Proxy& proxy,
@@ -140,6 +168,17 @@ class Serializer
         ) noexcept;
 
         static double to_number(std::string const& text) noexcept;
+
+        static size_t format_param_line(
+            char* const line,
+            char const* const param_name,
+            double const ratio
+        ) noexcept;
+
+        static char* trim_excess_zeros_from_end(
+            char* const number,
+            char* const end
+        ) noexcept;
 };
 
 }
@@ -19,6 +19,7 @@
 #ifndef MPE_EMULATOR__SPSCQUEUE_CPP
 #define MPE_EMULATOR__SPSCQUEUE_CPP
 
+#include <algorithm>
 #include <utility>
 
 #include "spscqueue.hpp"
@@ -29,18 +30,37 @@ namespace MpeEmulator
 
 template<class ItemClass>
 SPSCQueue<ItemClass>::SPSCQueue(SizeType const capacity) noexcept
-    : capacity(capacity + 1),
+    : capacity(capacity),
+    mask(round_up_to_power_of_two(capacity) - 1),
     next_push(0),
-    next_pop(0)
+    cached_next_pop(0),
+    next_pop(0),
+    cached_next_push(0)
 {
-    items.reserve(this->capacity);
+    SizeType const size = mask + 1;
 
-    for (SizeType i = 0; i != this->capacity; ++i) {
+    items.reserve(size);
+
+    for (SizeType i = 0; i != size; ++i) {
         items.push_back(ItemClass());
     }
 }
 
 
+template<class ItemClass>
+typename SPSCQueue<ItemClass>::SizeType SPSCQueue<ItemClass>::round_up_to_power_of_two(
+        SizeType const value
+) noexcept {
+    SizeType result = 1;
+
+    while (result < value) {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+
 template<class ItemClass>
 bool SPSCQueue<ItemClass>::is_empty() const noexcept
 {
@@ -51,14 +71,10 @@ bool SPSCQueue<ItemClass>::is_empty() const noexcept
 template<class ItemClass>
 typename SPSCQueue<ItemClass>::SizeType SPSCQueue<ItemClass>::length() const noexcept
 {
-    size_t const next_pop = this->next_pop.load();
-    size_t const next_push = this->next_push.load();
+    SizeType const next_pop = this->next_pop.load(std::memory_order_acquire);
+    SizeType const next_push = this->next_push.load(std::memory_order_acquire);
 
-    if (next_push < next_pop) {
-        return capacity + next_push - next_pop;
-    } else {
-        return next_push - next_pop;
-    }
+    return next_push - next_pop;
 }
 
 
@@ -70,53 +86,111 @@ bool SPSCQueue<ItemClass>::is_lock_free() const noexcept
 
 
 template<class ItemClass>
-bool SPSCQueue<ItemClass>::push(ItemClass const& item) noexcept
-{
-    size_t const old_next_push = next_push.load();
-    size_t const next_pop = this->next_pop.load();
-    size_t const new_next_push = advance(old_next_push);
-
-    if (next_pop == new_next_push) {
-        return false;
+typename SPSCQueue<ItemClass>::SizeType SPSCQueue<ItemClass>::free_slots(
+        SizeType const next_push,
+        SizeType const needed
+) noexcept {
+    SizeType free_slots = capacity - (next_push - cached_next_pop);
+
+    if (free_slots < needed) {
+        cached_next_pop = next_pop.load(std::memory_order_acquire);
+        free_slots = capacity - (next_push - cached_next_pop);
     }
 
-    items[old_next_push] = item;
-    next_push.store(new_next_push);
+    return free_slots;
+}
 
-    return true;
+
+template<class ItemClass>
+typename SPSCQueue<ItemClass>::SizeType SPSCQueue<ItemClass>::available_items(
+        SizeType const next_pop,
+        SizeType const needed
+) noexcept {
+    SizeType available_items = cached_next_push - next_pop;
+
+    if (available_items < needed) {
+        cached_next_push = next_push.load(std::memory_order_acquire);
+        available_items = cached_next_push - next_pop;
+    }
+
+    return available_items;
 }
 
 
 template<class ItemClass>
-typename SPSCQueue<ItemClass>::SizeType SPSCQueue<ItemClass>::advance(
-        SizeType const index
-) const noexcept {
-    SizeType const new_index = index + 1;
+bool SPSCQueue<ItemClass>::push(ItemClass const& item) noexcept
+{
+    SizeType const next_push = this->next_push.load(std::memory_order_relaxed);
+
+    if (free_slots(next_push, 1) == 0) {
+        return false;
+    }
+
+    items[next_push & mask] = item;
+    this->next_push.store(next_push + 1, std::memory_order_release);
 
-    return new_index >= capacity ? new_index - capacity : new_index;
+    return true;
 }
 
 
 template<class ItemClass>
 bool SPSCQueue<ItemClass>::pop(ItemClass& item) noexcept
 {
-    size_t const next_pop = this->next_pop.load();
-    size_t const next_push = this->next_push.load();
+    SizeType const next_pop = this->next_pop.load(std::memory_order_relaxed);
 
-    if (next_push == next_pop) {
+    if (available_items(next_pop, 1) == 0) {
         return false;
     }
 
-    ItemClass replacement;
+    ItemClass replacement = ItemClass();
 
-    std::swap(items[next_pop], replacement);
+    std::swap(items[next_pop & mask], replacement);
     item = std::move(replacement);
 
-    this->next_pop.store(advance(next_pop));
+    this->next_pop.store(next_pop + 1, std::memory_order_release);
 
     return true;
 }
 
+
+template<class ItemClass>
+typename SPSCQueue<ItemClass>::SizeType SPSCQueue<ItemClass>::push_bulk(
+        ItemClass const* const items,
+        SizeType const count
+) noexcept {
+    SizeType const next_push = this->next_push.load(std::memory_order_relaxed);
+    SizeType const push_count = std::min(count, free_slots(next_push, count));
+
+    for (SizeType i = 0; i != push_count; ++i) {
+        this->items[(next_push + i) & mask] = items[i];
+    }
+
+    this->next_push.store(next_push + push_count, std::memory_order_release);
+
+    return push_count;
+}
+
+
+template<class ItemClass>
+typename SPSCQueue<ItemClass>::SizeType SPSCQueue<ItemClass>::pop_bulk(
+        ItemClass* const items,
+        SizeType const max_count
+) noexcept {
+    SizeType const next_pop = this->next_pop.load(std::memory_order_relaxed);
+    SizeType const pop_count = std::min(max_count, available_items(next_pop, max_count));
+
+    for (SizeType i = 0; i != pop_count; ++i) {
+        ItemClass replacement = ItemClass();
+
+        std::swap(this->items[(next_pop + i) & mask], replacement);
+        items[i] = std::move(replacement);
+    }
+
+    this->next_pop.store(next_pop + pop_count, std::memory_order_release);
+
+    return pop_count;
+}
+
 }
 
 #endif
@@ -51,15 +51,70 @@ class SPSCQueue
         bool push(ItemClass const& item) noexcept;
         bool pop(ItemClass& item) noexcept;
 
+        /**
+         * \brief Push as many of the given items as there is room for, and
+         *        publish them to the consumer at once.
+         *
+         * \return The number of items that were pushed.
+         */
+        SizeType push_bulk(
+            ItemClass const* const items,
+            SizeType const count
+        ) noexcept;
+
+        /**
+         * \brief Pop at most \c max_count items, and release their slots to
+         *        the producer at once.
+         *
+         * \return The number of items that were popped.
+         */
+        SizeType pop_bulk(ItemClass* const items, SizeType const max_count) noexcept;
+
     private:
-        SizeType advance(SizeType const index) const noexcept;
+        /*
+        The producer's and the consumer's data are kept on separate cache lines
+        so that the two threads don't keep invalidating each other's caches.
+        */
+        static constexpr size_t CACHE_LINE_SIZE = 64;
+
+        static SizeType round_up_to_power_of_two(SizeType const value) noexcept;
+
+        SizeType free_slots(
+            SizeType const next_push,
+            SizeType const needed
+        ) noexcept;
+
+        SizeType available_items(
+            SizeType const next_pop,
+            SizeType const needed
+        ) noexcept;
 
         SizeType const capacity;
+        SizeType const mask;
 
         std::vector<ItemClass> items;
 
+        char padding_0[CACHE_LINE_SIZE];
+
+        /*
+        The indices are never wrapped around, only the positions which are
+        derived from them via the mask, so that a full queue can be told apart
+        from an empty one without wasting a slot, and since the storage size
+        is a power of two, unsigned overflow of the indices is harmless.
+
+        Each side also keeps a possibly outdated copy of the other side's index,
+        and reloads it only when the copy suggests that there is not enough
+        room or there are not enough items.
+        */
         std::atomic<SizeType> next_push;
+        SizeType cached_next_pop;
+
+        char padding_1[CACHE_LINE_SIZE];
+
         std::atomic<SizeType> next_pop;
+        SizeType cached_next_push;
+
+        char padding_2[CACHE_LINE_SIZE];
 };
 
 }
@@ -542,6 +542,38 @@ char const* const Strings::TRANSPOSE_OPTIONS[] = {
 size_t const Strings::TRANSPOSE_OPTIONS_COUNT = 97;
 
 
+char const* const Strings::SPLIT_SCOPES[] = {
+    [Proxy::SplitScope::SCP_ALL] = "All",
+    [Proxy::SplitScope::SCP_SPLIT_1] = "Split 1",
+    [Proxy::SplitScope::SCP_SPLIT_2] = "Split 2",
+    [Proxy::SplitScope::SCP_SPLIT_3] = "Split 3",
+    [Proxy::SplitScope::SCP_SPLIT_4] = "Split 4",
+};
+
+size_t const Strings::SPLIT_SCOPES_COUNT = 5;
+
+
+char const* const Strings::RATE_LIMITS[] = {
+    [Proxy::RateLimit::RL_OFF] = "OFF",
+    [Proxy::RateLimit::RL_1000_HZ] = "1 kHz",
+    [Proxy::RateLimit::RL_500_HZ] = "500 Hz",
+    [Proxy::RateLimit::RL_250_HZ] = "250 Hz",
+    [Proxy::RateLimit::RL_100_HZ] = "100 Hz",
+    [Proxy::RateLimit::RL_50_HZ] = "50 Hz",
+    [Proxy::RateLimit::RL_25_HZ] = "25 Hz",
+};
+
+size_t const Strings::RATE_LIMITS_COUNT = 7;
+
+
+char const* const Strings::DEADBANDS[] = {
+    "OFF", "1", "2", "3", "4", "5", "6", "7", "8",
+    "9", "10", "11", "12", "13", "14", "15", "16",
+};
+
+size_t const Strings::DEADBANDS_COUNT = 17;
+
+
 char const* const Strings::PARAMS[Proxy::ParamId::PARAM_ID_COUNT] = {
     [Proxy::ParamId::MCM] = "Emit MCM on reset",
     [Proxy::ParamId::Z1TYP] = "Zone type",
@@ -642,9 +674,46 @@ char const* const Strings::PARAMS[Proxy::ParamId::PARAM_ID_COUNT] = {
     [Proxy::ParamId::Z1R7FB] = "Rule 7 global fallback",
     [Proxy::ParamId::Z1R8FB] = "Rule 8 global fallback",
     [Proxy::ParamId::Z1R9FB] = "Rule 9 global fallback",
+    [Proxy::ParamId::Z1SPL] = "Lower split point",
+    [Proxy::ParamId::Z1SPH] = "Upper split point",
+    [Proxy::ParamId::Z1TRL] = "Transpose below lower split point",
+    [Proxy::ParamId::Z1TRH] = "Transpose above upper split point",
+    [Proxy::ParamId::Z1SPP] = "Separate channels for each split",
+    [Proxy::ParamId::Z1R1SC] = "Rule 1 split scope",
+    [Proxy::ParamId::Z1R2SC] = "Rule 2 split scope",
+    [Proxy::ParamId::Z1R3SC] = "Rule 3 split scope",
+    [Proxy::ParamId::Z1R4SC] = "Rule 4 split scope",
+    [Proxy::ParamId::Z1R5SC] = "Rule 5 split scope",
+    [Proxy::ParamId::Z1R6SC] = "Rule 6 split scope",
+    [Proxy::ParamId::Z1R7SC] = "Rule 7 split scope",
+    [Proxy::ParamId::Z1R8SC] = "Rule 8 split scope",
+    [Proxy::ParamId::Z1R9SC] = "Rule 9 split scope",
+    [Proxy::ParamId::Z1R1RL] = "Rule 1 rate limit",
+    [Proxy::ParamId::Z1R2RL] = "Rule 2 rate limit",
+    [Proxy::ParamId::Z1R3RL] = "Rule 3 rate limit",
+    [Proxy::ParamId::Z1R4RL] = "Rule 4 rate limit",
+    [Proxy::ParamId::Z1R5RL] = "Rule 5 rate limit",
+    [Proxy::ParamId::Z1R6RL] = "Rule 6 rate limit",
+    [Proxy::ParamId::Z1R7RL] = "Rule 7 rate limit",
+    [Proxy::ParamId::Z1R8RL] = "Rule 8 rate limit",
+    [Proxy::ParamId::Z1R9RL] = "Rule 9 rate limit",
+    [Proxy::ParamId::Z1R1DB] = "Rule 1 deadband",
+    [Proxy::ParamId::Z1R2DB] = "Rule 2 deadband",
+    [Proxy::ParamId::Z1R3DB] = "Rule 3 deadband",
+    [Proxy::ParamId::Z1R4DB] = "Rule 4 deadband",
+    [Proxy::ParamId::Z1R5DB] = "Rule 5 deadband",
+    [Proxy::ParamId::Z1R6DB] = "Rule 6 deadband",
+    [Proxy::ParamId::Z1R7DB] = "Rule 7 deadband",
+    [Proxy::ParamId::Z1R8DB] = "Rule 8 deadband",
+    [Proxy::ParamId::Z1R9DB] = "Rule 9 deadband",
 };
 
 
+thread_local Strings::CachedDisplayStr Strings::display_str_cache[
+    Proxy::ParamId::PARAM_ID_COUNT
+];
+
+
 Strings::ParamFormat Strings::PARAM_FORMATS[Proxy::ParamId::PARAM_ID_COUNT] = {
     [Proxy::ParamId::MCM] = {Strings::TOGGLE_STATES, Strings::TOGGLE_STATES_COUNT},
     [Proxy::ParamId::Z1TYP] = {Strings::ZONE_TYPES, Strings::ZONE_TYPES_COUNT},
@@ -757,6 +826,42 @@ Strings::ParamFormat Strings::PARAM_FORMATS[Proxy::ParamId::PARAM_ID_COUNT] = {
     [Proxy::ParamId::Z1R7FB] = {Strings::TOGGLE_STATES, Strings::TOGGLE_STATES_COUNT},
     [Proxy::ParamId::Z1R8FB] = {Strings::TOGGLE_STATES, Strings::TOGGLE_STATES_COUNT},
     [Proxy::ParamId::Z1R9FB] = {Strings::TOGGLE_STATES, Strings::TOGGLE_STATES_COUNT},
+
+    [Proxy::ParamId::Z1SPL] = {Strings::ANCHORS, Strings::ANCHORS_COUNT},
+    [Proxy::ParamId::Z1SPH] = {Strings::ANCHORS, Strings::ANCHORS_COUNT},
+    [Proxy::ParamId::Z1TRL] = {Strings::TRANSPOSE_OPTIONS, Strings::TRANSPOSE_OPTIONS_COUNT},
+    [Proxy::ParamId::Z1TRH] = {Strings::TRANSPOSE_OPTIONS, Strings::TRANSPOSE_OPTIONS_COUNT},
+    [Proxy::ParamId::Z1SPP] = {Strings::TOGGLE_STATES, Strings::TOGGLE_STATES_COUNT},
+
+    [Proxy::ParamId::Z1R1SC] = {Strings::SPLIT_SCOPES, Strings::SPLIT_SCOPES_COUNT},
+    [Proxy::ParamId::Z1R2SC] = {Strings::SPLIT_SCOPES, Strings::SPLIT_SCOPES_COUNT},
+    [Proxy::ParamId::Z1R3SC] = {Strings::SPLIT_SCOPES, Strings::SPLIT_SCOPES_COUNT},
+    [Proxy::ParamId::Z1R4SC] = {Strings::SPLIT_SCOPES, Strings::SPLIT_SCOPES_COUNT},
+    [Proxy::ParamId::Z1R5SC] = {Strings::SPLIT_SCOPES, Strings::SPLIT_SCOPES_COUNT},
+    [Proxy::ParamId::Z1R6SC] = {Strings::SPLIT_SCOPES, Strings::SPLIT_SCOPES_COUNT},
+    [Proxy::ParamId::Z1R7SC] = {Strings::SPLIT_SCOPES, Strings::SPLIT_SCOPES_COUNT},
+    [Proxy::ParamId::Z1R8SC] = {Strings::SPLIT_SCOPES, Strings::SPLIT_SCOPES_COUNT},
+    [Proxy::ParamId::Z1R9SC] = {Strings::SPLIT_SCOPES, Strings::SPLIT_SCOPES_COUNT},
+
+    [Proxy::ParamId::Z1R1RL] = {Strings::RATE_LIMITS, Strings::RATE_LIMITS_COUNT},
+    [Proxy::ParamId::Z1R2RL] = {Strings::RATE_LIMITS, Strings::RATE_LIMITS_COUNT},
+    [Proxy::ParamId::Z1R3RL] = {Strings::RATE_LIMITS, Strings::RATE_LIMITS_COUNT},
+    [Proxy::ParamId::Z1R4RL] = {Strings::RATE_LIMITS, Strings::RATE_LIMITS_COUNT},
+    [Proxy::ParamId::Z1R5RL] = {Strings::RATE_LIMITS, Strings::RATE_LIMITS_COUNT},
+    [Proxy::ParamId::Z1R6RL] = {Strings::RATE_LIMITS, Strings::RATE_LIMITS_COUNT},
+    [Proxy::ParamId::Z1R7RL] = {Strings::RATE_LIMITS, Strings::RATE_LIMITS_COUNT},
+    [Proxy::ParamId::Z1R8RL] = {Strings::RATE_LIMITS, Strings::RATE_LIMITS_COUNT},
+    [Proxy::ParamId::Z1R9RL] = {Strings::RATE_LIMITS, Strings::RATE_LIMITS_COUNT},
+
+    [Proxy::ParamId::Z1R1DB] = {Strings::DEADBANDS, Strings::DEADBANDS_COUNT},
+    [Proxy::ParamId::Z1R2DB] = {Strings::DEADBANDS, Strings::DEADBANDS_COUNT},
+    [Proxy::ParamId::Z1R3DB] = {Strings::DEADBANDS, Strings::DEADBANDS_COUNT},
+    [Proxy::ParamId::Z1R4DB] = {Strings::DEADBANDS, Strings::DEADBANDS_COUNT},
+    [Proxy::ParamId::Z1R5DB] = {Strings::DEADBANDS, Strings::DEADBANDS_COUNT},
+    [Proxy::ParamId::Z1R6DB] = {Strings::DEADBANDS, Strings::DEADBANDS_COUNT},
+    [Proxy::ParamId::Z1R7DB] = {Strings::DEADBANDS, Strings::DEADBANDS_COUNT},
+    [Proxy::ParamId::Z1R8DB] = {Strings::DEADBANDS, Strings::DEADBANDS_COUNT},
+    [Proxy::ParamId::Z1R9DB] = {Strings::DEADBANDS, Strings::DEADBANDS_COUNT},
 };
 
 
@@ -789,6 +894,16 @@ void Strings::param_ratio_to_str(
         double const ratio,
         char* const buffer,
         size_t const buffer_size
+) noexcept {
+    strncpy(buffer, param_ratio_to_display_str(proxy, param_id, ratio), buffer_size);
+    buffer[buffer_size - 1] = '\x00';
+}
+
+
+char const* Strings::param_ratio_to_display_str(
+        Proxy const& proxy,
+        Proxy::ParamId const param_id,
+        double const ratio
 ) noexcept {
     if (
             MPE_EMULATOR_UNLIKELY(
@@ -796,14 +911,32 @@ void Strings::param_ratio_to_str(
                 || param_id >= Proxy::ParamId::INVALID_PARAM_ID
             )
     ) {
-        buffer[0] = '\x00';
+        return "";
+    }
+
+    ParamFormat const& param_format = PARAM_FORMATS[(size_t)param_id];
+
+    /*
+    Hosts keep polling the display strings of every parameter even when
+    nothing changes. Discrete parameters can be answered directly from the
+    immutable option tables, and continuous ones are only formatted again
+    when their value differs from the previous query.
+    */
+    if (param_format.format == NULL && param_format.options != NULL) {
+        return param_format.ratio_to_option(proxy, param_id, ratio);
+    }
+
+    CachedDisplayStr& cached = display_str_cache[(size_t)param_id];
 
-        return;
+    if (!cached.is_valid || cached.ratio != ratio) {
+        param_format.ratio_to_str(
+            proxy, param_id, ratio, cached.text, DISPLAY_STR_MAX_LENGTH
+        );
+        cached.ratio = ratio;
+        cached.is_valid = true;
     }
 
-    PARAM_FORMATS[(size_t)param_id].ratio_to_str(
-        proxy, param_id, ratio, buffer, buffer_size
-    );
+    return cached.text;
 }
 
 
@@ -886,22 +1019,29 @@ void Strings::ParamFormat::ratio_to_str_float(
 }
 
 
-void Strings::ParamFormat::ratio_to_str_options(
+char const* Strings::ParamFormat::ratio_to_option(
         Proxy const& proxy,
         Proxy::ParamId const param_id,
-        double const ratio,
-        char* const buffer,
-        size_t const buffer_size
+        double const ratio
 ) const noexcept {
     size_t const value = (size_t)proxy.param_ratio_to_value(param_id, ratio);
 
     if (MPE_EMULATOR_UNLIKELY(value >= number_of_options)) {
-        buffer[0] = '\x00';
-
-        return;
+        return "";
     }
 
-    strncpy(buffer, options[value], buffer_size);
+    return options[value];
+}
+
+
+void Strings::ParamFormat::ratio_to_str_options(
+        Proxy const& proxy,
+        Proxy::ParamId const param_id,
+        double const ratio,
+        char* const buffer,
+        size_t const buffer_size
+) const noexcept {
+    strncpy(buffer, ratio_to_option(proxy, param_id, ratio), buffer_size);
     buffer[buffer_size - 1] = '\x00';
 }
 
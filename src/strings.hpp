@@ -64,6 +64,15 @@ class Strings
         static char const* const TRANSPOSE_OPTIONS[];
         static size_t const TRANSPOSE_OPTIONS_COUNT;
 
+        static char const* const SPLIT_SCOPES[];
+        static size_t const SPLIT_SCOPES_COUNT;
+
+        static char const* const RATE_LIMITS[];
+        static size_t const RATE_LIMITS_COUNT;
+
+        static char const* const DEADBANDS[];
+        static size_t const DEADBANDS_COUNT;
+
         static char const* const PARAMS[Proxy::ParamId::PARAM_ID_COUNT];
 
         static char const* const* get_options(
@@ -79,7 +88,23 @@ class Strings
             size_t const buffer_size
         ) noexcept;
 
+        /**
+         * \brief Return the display string of a parameter value without
+         *        formatting it again when the value did not change.
+         *
+         * \warning For continuous parameters, the returned string belongs to
+         *          a per-thread cache, and it is overwritten by the next call
+         *          for the same parameter with a different ratio.
+         */
+        static char const* param_ratio_to_display_str(
+            Proxy const& proxy,
+            Proxy::ParamId const param_id,
+            double const ratio
+        ) noexcept;
+
     private:
+        static constexpr size_t DISPLAY_STR_MAX_LENGTH = 32;
+
         class ParamFormat
         {
             public:
@@ -103,6 +128,12 @@ class Strings
                     size_t const buffer_size
                 ) const noexcept;
 
+                char const* ratio_to_option(
+                    Proxy const& proxy,
+                    Proxy::ParamId const param_id,
+                    double const ratio
+                ) const noexcept;
+
                 char const* const format;
                 char const* const* const options;
 
@@ -133,7 +164,19 @@ class Strings
                 ) const noexcept;
         };
 
+        class CachedDisplayStr
+        {
+            public:
+                double ratio;
+                bool is_valid;
+                char text[DISPLAY_STR_MAX_LENGTH];
+        };
+
         static ParamFormat PARAM_FORMATS[Proxy::ParamId::PARAM_ID_COUNT];
+
+        static thread_local CachedDisplayStr display_str_cache[
+            Proxy::ParamId::PARAM_ID_COUNT
+        ];
 };
 
 }
@@ -0,0 +1,425 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPE_EMULATOR__TRACE_CPP
+#define MPE_EMULATOR__TRACE_CPP
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+#include <map>
+#include <vector>
+
+/*
+MinGW's win32 threading model does not provide std::thread, in which case the
+records are only written when tracing is stopped, and the ones which do not fit
+into the rings are dropped.
+*/
+#if !defined(__GLIBCXX__) || defined(_GLIBCXX_HAS_GTHREADS)
+#define MPE_EMULATOR_TRACE_THREADS
+#include <thread>
+#endif
+
+#include "trace.hpp"
+
+#include "spscqueue.cpp"
+
+
+namespace MpeEmulator
+{
+
+#ifdef MPE_EMULATOR_TRACE_THREADS
+static std::thread trace_writer;
+#endif
+
+constexpr char const Trace::MAGIC[];
+
+thread_local Trace::Ring* Trace::ring = NULL;
+Trace::Ring* Trace::rings = NULL;
+FILE* Trace::output_file = NULL;
+std::atomic<bool> Trace::is_running(false);
+std::atomic<bool> Trace::is_stopping(false);
+std::atomic<int> Trace::start_count(0);
+std::atomic<size_t> Trace::next_ring(0);
+std::atomic<uint64_t> Trace::unassigned_dropped(0);
+
+
+bool Trace::start(char const* const path) noexcept
+{
+    if (start_count.fetch_add(1) != 0) {
+        return true;
+    }
+
+    output_file = fopen(path, "wb");
+
+    if (output_file == NULL) {
+        start_count.fetch_sub(1);
+
+        return false;
+    }
+
+    uint32_t const version = VERSION;
+
+    fwrite(MAGIC, 1, MAGIC_SIZE, output_file);
+    fwrite(&version, sizeof(version), 1, output_file);
+
+    /*
+    Threads keep pointing to the rings that they have claimed, so the rings are
+    never freed.
+    */
+    if (rings == NULL) {
+        rings = new Ring[MAX_THREADS];
+    }
+
+    is_stopping = false;
+    is_running = true;
+
+#ifdef MPE_EMULATOR_TRACE_THREADS
+    trace_writer = std::thread(&Trace::run_writer, output_file);
+#endif
+
+    return true;
+}
+
+
+void Trace::stop() noexcept
+{
+    if (start_count.load() <= 0 || start_count.fetch_sub(1) != 1) {
+        return;
+    }
+
+    is_running = false;
+    is_stopping = true;
+
+#ifdef MPE_EMULATOR_TRACE_THREADS
+    trace_writer.join();
+#else
+    run_writer(output_file);
+#endif
+
+    write_dropped(output_file);
+    fclose(output_file);
+    output_file = NULL;
+}
+
+
+void Trace::record_args(Record& record, size_t const index) noexcept
+{
+    std::fill(record.args + index, record.args + MAX_ARGS, 0.0);
+}
+
+
+Trace::Ring* Trace::get_ring() noexcept
+{
+    if (MPE_EMULATOR_LIKELY(ring != NULL)) {
+        return ring;
+    }
+
+    size_t const index = next_ring.fetch_add(1);
+
+    if (index >= MAX_THREADS) {
+        return NULL;
+    }
+
+    ring = &rings[index];
+    ring->is_claimed = true;
+
+    return ring;
+}
+
+
+uint64_t Trace::now_ns() noexcept
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+
+void Trace::push(Record& record) noexcept
+{
+    Ring* const own_ring = get_ring();
+
+    if (MPE_EMULATOR_UNLIKELY(own_ring == NULL)) {
+        unassigned_dropped.fetch_add(1, std::memory_order_relaxed);
+
+        return;
+    }
+
+    record.thread_index = (uint32_t)(own_ring - rings);
+
+    if (MPE_EMULATOR_UNLIKELY(!own_ring->records.push(record))) {
+        own_ring->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+
+void Trace::run_writer(FILE* const file) noexcept
+{
+    SiteIds site_ids;
+
+    while (!is_stopping.load()) {
+        if (write_pending(file, site_ids) == 0) {
+#ifdef MPE_EMULATOR_TRACE_THREADS
+            fflush(file);
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+#endif
+        }
+    }
+
+    while (write_pending(file, site_ids) != 0) {
+    }
+}
+
+
+size_t Trace::write_pending(FILE* const file, SiteIds& site_ids) noexcept
+{
+    constexpr size_t batch_size = 64;
+
+    Record batch[batch_size];
+    size_t written = 0;
+
+    for (size_t i = 0; i != MAX_THREADS; ++i) {
+        Ring& claimed_ring = rings[i];
+
+        if (!claimed_ring.is_claimed.load()) {
+            continue;
+        }
+
+        size_t const count = (size_t)claimed_ring.records.pop_bulk(batch, batch_size);
+
+        for (size_t j = 0; j != count; ++j) {
+            Record const& record = batch[j];
+
+            if (site_ids.find(record.site_id) == site_ids.end()) {
+                site_ids.insert(record.site_id);
+                write_site(file, *(Site const*)(uintptr_t)record.site_id, record.site_id);
+            }
+
+            uint8_t const type = EntryType::ET_RECORD;
+
+            fwrite(&type, sizeof(type), 1, file);
+            fwrite(&record, sizeof(record), 1, file);
+        }
+
+        written += count;
+    }
+
+    return written;
+}
+
+
+void Trace::write_site(FILE* const file, Site const& site, uint64_t const site_id) noexcept
+{
+    uint8_t const type = EntryType::ET_SITE;
+    int32_t const line = (int32_t)site.line;
+
+    fwrite(&type, sizeof(type), 1, file);
+    fwrite(&site_id, sizeof(site_id), 1, file);
+    fwrite(&line, sizeof(line), 1, file);
+    write_string(file, site.file);
+    write_string(file, site.function);
+    write_string(file, site.message);
+}
+
+
+void Trace::write_dropped(FILE* const file) noexcept
+{
+    uint8_t const type = EntryType::ET_DROPPED;
+
+    for (size_t i = 0; i != MAX_THREADS + 1; ++i) {
+        uint32_t const thread_index = (uint32_t)i;
+        uint64_t const dropped = (
+            i == MAX_THREADS
+                ? unassigned_dropped.exchange(0)
+                : rings[i].dropped.exchange(0)
+        );
+
+        if (dropped == 0) {
+            continue;
+        }
+
+        fwrite(&type, sizeof(type), 1, file);
+        fwrite(&thread_index, sizeof(thread_index), 1, file);
+        fwrite(&dropped, sizeof(dropped), 1, file);
+    }
+}
+
+
+void Trace::write_string(FILE* const file, char const* const string) noexcept
+{
+    uint16_t const length = (uint16_t)std::min((size_t)UINT16_MAX, strlen(string));
+
+    fwrite(&length, sizeof(length), 1, file);
+    fwrite(string, 1, length, file);
+}
+
+
+bool Trace::read_string(FILE* const file, std::string& string) noexcept
+{
+    uint16_t length;
+
+    if (fread(&length, sizeof(length), 1, file) != 1) {
+        return false;
+    }
+
+    string.resize(length);
+
+    return length == 0 || fread(&string[0], 1, length, file) == length;
+}
+
+
+bool Trace::decode(FILE* const input, FILE* const output) noexcept
+{
+    struct DecodedSite
+    {
+        std::string file;
+        std::string function;
+        std::string message;
+        int32_t line;
+    };
+
+    char magic[MAGIC_SIZE];
+    uint32_t version;
+
+    if (
+            fread(magic, 1, MAGIC_SIZE, input) != MAGIC_SIZE
+            || memcmp(magic, MAGIC, MAGIC_SIZE) != 0
+            || fread(&version, sizeof(version), 1, input) != 1
+            || version != VERSION
+    ) {
+        fprintf(stderr, "ERROR: not an MPE Emulator trace file\n");
+
+        return false;
+    }
+
+    std::map<uint64_t, DecodedSite> sites;
+    std::vector<Record> records;
+    std::map<uint32_t, uint64_t> dropped;
+    uint8_t type;
+
+    while (fread(&type, sizeof(type), 1, input) == 1) {
+        if (type == EntryType::ET_SITE) {
+            uint64_t site_id;
+            DecodedSite site;
+
+            if (
+                    fread(&site_id, sizeof(site_id), 1, input) != 1
+                    || fread(&site.line, sizeof(site.line), 1, input) != 1
+                    || !read_string(input, site.file)
+                    || !read_string(input, site.function)
+                    || !read_string(input, site.message)
+            ) {
+                break;
+            }
+
+            sites[site_id] = site;
+        } else if (type == EntryType::ET_RECORD) {
+            Record record;
+
+            if (fread(&record, sizeof(record), 1, input) != 1) {
+                break;
+            }
+
+            records.push_back(record);
+        } else if (type == EntryType::ET_DROPPED) {
+            uint32_t thread_index;
+            uint64_t count;
+
+            if (
+                    fread(&thread_index, sizeof(thread_index), 1, input) != 1
+                    || fread(&count, sizeof(count), 1, input) != 1
+            ) {
+                break;
+            }
+
+            dropped[thread_index] += count;
+        } else {
+            fprintf(stderr, "ERROR: unknown entry type: %d\n", (int)type);
+
+            return false;
+        }
+    }
+
+    /* Records are written ring by ring, so they need to be put in order. */
+    std::stable_sort(
+        records.begin(),
+        records.end(),
+        [](Record const& a, Record const& b) {
+            return a.timestamp_ns < b.timestamp_ns;
+        }
+    );
+
+    uint64_t const first_timestamp_ns = records.empty() ? 0 : records[0].timestamp_ns;
+
+    for (std::vector<Record>::const_iterator it = records.begin(); it != records.end(); ++it) {
+        std::map<uint64_t, DecodedSite>::const_iterator const site = sites.find(it->site_id);
+
+        fprintf(
+            output,
+            "%14.6f\tT%" PRIu32 "\t",
+            (double)(it->timestamp_ns - first_timestamp_ns) / 1000000.0,
+            it->thread_index
+        );
+
+        if (site == sites.end()) {
+            fprintf(output, "<unknown site>");
+        } else {
+            char const* const last_slash = strrchr(site->second.file.c_str(), '/');
+
+            fprintf(
+                output,
+                "%s:%d %s():\t%s",
+                last_slash != NULL ? last_slash + 1 : site->second.file.c_str(),
+                (int)site->second.line,
+                site->second.function.c_str(),
+                site->second.message.c_str()
+            );
+        }
+
+        for (uint32_t i = 0; i != std::min(it->args_count, (uint32_t)MAX_ARGS); ++i) {
+            fprintf(output, "\t%.9g", it->args[i]);
+        }
+
+        fprintf(output, "\n");
+    }
+
+    for (std::map<uint32_t, uint64_t>::const_iterator it = dropped.begin(); it != dropped.end(); ++it) {
+        fprintf(
+            output,
+            "Dropped records (T%" PRIu32 "): %" PRIu64 "\n",
+            it->first,
+            it->second
+        );
+    }
+
+    return true;
+}
+
+
+Trace::Ring::Ring() noexcept
+    : records(RING_SIZE),
+    is_claimed(false),
+    dropped(0)
+{
+}
+
+}
+
+#endif
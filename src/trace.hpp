@@ -0,0 +1,214 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPE_EMULATOR__TRACE_HPP
+#define MPE_EMULATOR__TRACE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_set>
+
+#include "common.hpp"
+#include "spscqueue.hpp"
+
+
+/*
+Unlike MPE_EMULATOR_DEBUG() which formats and writes the message on the
+calling thread, MPE_EMULATOR_TRACE() only copies a fixed-size binary record
+into a lock-free ring which belongs to the calling thread, so it is safe to
+use on the audio thread. The records are written to the file that is given in
+MPE_EMULATOR_TRACE_LOG by a background thread, and can be turned into text
+with the trace-decoder tool.
+
+The message must be a string literal, and at most Trace::MAX_ARGS numeric
+arguments can be recorded with it.
+*/
+#ifdef MPE_EMULATOR_TRACE_LOG
+
+#define MPE_EMULATOR_TRACE(message, ...) do {                               \
+    static ::MpeEmulator::Trace::Site const _mpe_trace_site = {             \
+        __FILE__, __func__, (message), __LINE__                             \
+    };                                                                      \
+                                                                            \
+    ::MpeEmulator::Trace::record(_mpe_trace_site, ## __VA_ARGS__);          \
+} while (false)
+
+#define MPE_EMULATOR_TRACE_START()                                          \
+    ::MpeEmulator::Trace::start(MPE_EMULATOR_TO_STRING(MPE_EMULATOR_TRACE_LOG))
+
+#define MPE_EMULATOR_TRACE_STOP() ::MpeEmulator::Trace::stop()
+
+#else
+
+#define MPE_EMULATOR_TRACE(message, ...)
+#define MPE_EMULATOR_TRACE_START()
+#define MPE_EMULATOR_TRACE_STOP()
+
+#endif
+
+
+namespace MpeEmulator
+{
+
+class Trace
+{
+    public:
+        static constexpr size_t MAX_ARGS = 4;
+        static constexpr size_t MAX_THREADS = 16;
+        static constexpr size_t RING_SIZE = 2048;
+
+        /**
+         * \brief Static description of a trace point; records refer to it
+         *        by its address.
+         */
+        struct Site
+        {
+            char const* const file;
+            char const* const function;
+            char const* const message;
+            int const line;
+        };
+
+        struct Record
+        {
+            uint64_t timestamp_ns;
+            uint64_t site_id;
+            uint32_t thread_index;
+            uint32_t args_count;
+            double args[MAX_ARGS];
+            uint64_t reserved;
+        };
+
+        /**
+         * \brief Allocate the rings and start the background thread which
+         *        writes the records to the given file. Calls are counted, only
+         *        the first one has an effect.
+         */
+        static bool start(char const* const path) noexcept;
+
+        /**
+         * \brief Stop the background thread after writing all pending
+         *        records, once every \c start() call has been matched.
+         */
+        static void stop() noexcept;
+
+        /**
+         * \brief Record an event on the calling thread. Does not allocate,
+         *        lock, or make system calls; when tracing is not running,
+         *        or the thread's ring is full, the record is dropped.
+         */
+        template<typename... ArgTypes>
+        static void record(Site const& site, ArgTypes const... args) noexcept;
+
+        /**
+         * \brief Format the contents of a trace file as text.
+         */
+        static bool decode(FILE* const input, FILE* const output) noexcept;
+
+    private:
+        static constexpr char const MAGIC[] = "MPETRACE";
+        static constexpr size_t MAGIC_SIZE = 8;
+        static constexpr uint32_t VERSION = 1;
+
+        typedef std::unordered_set<uint64_t> SiteIds;
+
+        enum EntryType {
+            ET_SITE = 1,
+            ET_RECORD = 2,
+            ET_DROPPED = 3,
+        };
+
+        class Ring
+        {
+            public:
+                Ring() noexcept;
+
+                SPSCQueue<Record> records;
+                std::atomic<bool> is_claimed;
+                std::atomic<uint64_t> dropped;
+        };
+
+        static void record_args(Record& record, size_t const index) noexcept;
+
+        template<typename ArgType, typename... ArgTypes>
+        static void record_args(
+            Record& record,
+            size_t const index,
+            ArgType const arg,
+            ArgTypes const... args
+        ) noexcept;
+
+        static Ring* get_ring() noexcept;
+        static uint64_t now_ns() noexcept;
+        static void push(Record& record) noexcept;
+        static void run_writer(FILE* const file) noexcept;
+        static size_t write_pending(FILE* const file, SiteIds& site_ids) noexcept;
+        static void write_site(FILE* const file, Site const& site, uint64_t const site_id) noexcept;
+        static void write_dropped(FILE* const file) noexcept;
+        static void write_string(FILE* const file, char const* const string) noexcept;
+        static bool read_string(FILE* const file, std::string& string) noexcept;
+
+        static thread_local Ring* ring;
+        static Ring* rings;
+        static FILE* output_file;
+        static std::atomic<bool> is_running;
+        static std::atomic<bool> is_stopping;
+        static std::atomic<int> start_count;
+        static std::atomic<size_t> next_ring;
+        static std::atomic<uint64_t> unassigned_dropped;
+};
+
+
+template<typename... ArgTypes>
+void Trace::record(Site const& site, ArgTypes const... args) noexcept
+{
+    static_assert(sizeof...(args) <= MAX_ARGS, "Too many trace arguments");
+
+    if (MPE_EMULATOR_LIKELY(!is_running.load(std::memory_order_relaxed))) {
+        return;
+    }
+
+    Record record;
+
+    record.timestamp_ns = now_ns();
+    record.site_id = (uint64_t)(uintptr_t)&site;
+    record.args_count = (uint32_t)sizeof...(args);
+    record.reserved = 0;
+    record_args(record, 0, args...);
+
+    push(record);
+}
+
+
+template<typename ArgType, typename... ArgTypes>
+void Trace::record_args(
+        Record& record,
+        size_t const index,
+        ArgType const arg,
+        ArgTypes const... args
+) noexcept {
+    record.args[index] = (double)arg;
+    record_args(record, index + 1, args...);
+}
+
+}
+
+#endif
@@ -0,0 +1,67 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstdio>
+
+#include "trace.cpp"
+
+
+int usage(char const* const name)
+{
+    fprintf(stderr, "Usage: %s trace_file [output.txt]\n", name);
+    fprintf(stderr, "\n");
+    fprintf(stderr, "The output is written to stdout when no output file is given.\n");
+
+    return 1;
+}
+
+
+int main(int argc, char const* argv[])
+{
+    if (argc < 2 || argc > 3) {
+        return usage(argv[0]);
+    }
+
+    FILE* const input = fopen(argv[1], "rb");
+
+    if (input == NULL) {
+        fprintf(stderr, "ERROR: unable to open trace file: %s\n", argv[1]);
+
+        return 1;
+    }
+
+    FILE* const output = argc == 3 ? fopen(argv[2], "w") : stdout;
+
+    if (output == NULL) {
+        fprintf(stderr, "ERROR: unable to open output file: %s\n", argv[2]);
+        fclose(input);
+
+        return 1;
+    }
+
+    bool const is_decoded = MpeEmulator::Trace::decode(input, output);
+
+    fclose(input);
+
+    if (output != stdout) {
+        fclose(output);
+    }
+
+    return is_decoded ? 0 : 1;
+}
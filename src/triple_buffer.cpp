@@ -0,0 +1,79 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2023, 2024  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPE_EMULATOR__TRIPLE_BUFFER_CPP
+#define MPE_EMULATOR__TRIPLE_BUFFER_CPP
+
+#include "triple_buffer.hpp"
+
+
+namespace MpeEmulator
+{
+
+template<class Item>
+TripleBuffer<Item>::TripleBuffer() noexcept
+    : middle(1),
+    back(2),
+    front(0)
+{
+}
+
+
+template<class Item>
+bool TripleBuffer<Item>::is_lock_free() const noexcept
+{
+    return middle.is_lock_free();
+}
+
+
+template<class Item>
+Item& TripleBuffer<Item>::get_back() noexcept
+{
+    return items[back];
+}
+
+
+template<class Item>
+void TripleBuffer<Item>::publish() noexcept
+{
+    back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+
+template<class Item>
+bool TripleBuffer<Item>::consume() noexcept
+{
+    if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+        return false;
+    }
+
+    front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+
+    return true;
+}
+
+
+template<class Item>
+Item const& TripleBuffer<Item>::get_front() const noexcept
+{
+    return items[front];
+}
+
+}
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2023, 2024  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPE_EMULATOR__TRIPLE_BUFFER_HPP
+#define MPE_EMULATOR__TRIPLE_BUFFER_HPP
+
+#include <atomic>
+
+
+namespace MpeEmulator
+{
+
+/**
+ * \brief A lockless, waitless container for handing over the latest version
+ *        of an object from a single writer thread to a single reader thread.
+ *
+ * The writer fills the back buffer, then publishes it, while the reader can
+ * keep using the front buffer undisturbed until it asks for the latest
+ * published version. Versions which are published while the reader is busy
+ * are overwritten by newer ones.
+ */
+template<class Item>
+class TripleBuffer
+{
+    public:
+        TripleBuffer() noexcept;
+
+        TripleBuffer(TripleBuffer<Item> const& buffer) = delete;
+
+        bool is_lock_free() const noexcept;
+
+        Item& get_back() noexcept;
+        void publish() noexcept;
+
+        /**
+         * \brief Swap the latest published version to the front, if there is
+         *        one that the reader hasn't seen yet.
+         *
+         * \return Whether the front buffer has changed.
+         */
+        bool consume() noexcept;
+
+        Item const& get_front() const noexcept;
+
+    private:
+        static constexpr unsigned int INDEX_MASK = 3;
+        static constexpr unsigned int FRESH = 4;
+
+        Item items[3];
+
+        std::atomic<unsigned int> middle;
+        unsigned int back;
+        unsigned int front;
+};
+
+}
+
+#endif
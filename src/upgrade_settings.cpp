@@ -16,19 +16,98 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
-#include <istream>
-#include <iostream>
+#include <filesystem>
 #include <fstream>
+#include <iomanip>
+#include <iostream>
 #include <ostream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+/*
+MinGW's win32 threading model does not provide std::thread, in which case the
+files are processed one after the other.
+*/
+#if !defined(__GLIBCXX__) || defined(_GLIBCXX_HAS_GTHREADS)
+#define MPE_EMULATOR_UPGRADE_SETTINGS_THREADS
+#include <mutex>
+#include <thread>
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "common.hpp"
 #include "serializer.hpp"
 #include "proxy.hpp"
 
 
-bool read_settings(char const* const file_path, std::string& result)
+typedef std::chrono::steady_clock Clock;
+
+typedef std::vector<std::string> FilePaths;
+
+
+struct Stats
+{
+    Stats() : files(0), failed(0), bytes(0)
+    {
+    }
+
+    size_t files;
+    size_t failed;
+    size_t bytes;
+};
+
+
+std::string format_error(
+        char const* const message,
+        std::string const& file_path,
+        int const error_number
+) {
+    std::ostringstream error;
+
+    error
+        << "ERROR: "
+        << message
+        << std::endl
+        << "  File: " << file_path << std::endl
+        << "  Errno: " << error_number << std::endl
+        << "  Message: " << std::strerror(error_number) << std::endl;
+
+    return error.str();
+}
+
+
+/*
+The serializer stops at the first NUL byte and never looks beyond MAX_SIZE
+bytes, so only that much of the file is copied.
+*/
+void assign_settings(char const* const data, size_t const size, std::string& result)
+{
+    size_t const max_size = std::min(size, MpeEmulator::Serializer::MAX_SIZE);
+    char const* const end = std::find(data, data + max_size, '\x00');
+
+    result.assign(data, (size_t)(end - data));
+}
+
+
+#ifdef _WIN32
+
+bool read_settings(std::string const& file_path, std::string& result)
 {
     std::ifstream settings_file(file_path, std::ios::in | std::ios::binary);
 
@@ -36,18 +115,70 @@ bool read_settings(char const* const file_path, std::string& result)
         return false;
     }
 
-    char* const buffer = new char[MpeEmulator::Serializer::MAX_SIZE];
+    std::vector<char> buffer(MpeEmulator::Serializer::MAX_SIZE);
+
+    settings_file.read(buffer.data(), (std::streamsize)buffer.size());
+
+    if (settings_file.bad()) {
+        return false;
+    }
+
+    assign_settings(buffer.data(), (size_t)settings_file.gcount(), result);
+
+    return true;
+}
+
+#else
+
+bool read_settings(std::string const& file_path, std::string& result)
+{
+    int const fd = open(file_path.c_str(), O_RDONLY);
+
+    if (fd == -1) {
+        return false;
+    }
+
+    struct stat file_stat;
+
+    if (fstat(fd, &file_stat) != 0) {
+        int const error_number = errno;
+
+        close(fd);
+        errno = error_number;
+
+        return false;
+    }
+
+    size_t const size = std::min(
+        (size_t)file_stat.st_size, MpeEmulator::Serializer::MAX_SIZE
+    );
+
+    if (size == 0) {
+        close(fd);
+        result.clear();
+
+        return true;
+    }
+
+    void* const data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    int const error_number = errno;
 
-    std::fill_n(buffer, MpeEmulator::Serializer::MAX_SIZE, '\x00');
-    settings_file.read(buffer, MpeEmulator::Serializer::MAX_SIZE);
+    close(fd);
 
-    result = buffer;
+    if (data == MAP_FAILED) {
+        errno = error_number;
 
-    delete[] buffer;
+        return false;
+    }
+
+    assign_settings((char const*)data, size, result);
+    munmap(data, size);
 
     return true;
 }
 
+#endif
+
 
 bool is_whole_line_comment_or_white_space(std::string const& line)
 {
@@ -70,82 +201,337 @@ void collect_comments(std::string const& settings, MpeEmulator::Serializer::Line
             comments.push_back(line);
         }
     }
+
+    delete lines;
 }
 
 
+/*
+The upgraded settings are written to a temporary file next to the original
+one, and then moved over it, so that an interrupted run cannot leave a
+truncated settings file behind.
+*/
 bool write_settings(
-        char const* const file_path,
+        std::string const& file_path,
         std::string const& settings,
         MpeEmulator::Serializer::Lines const& comments
 ) {
-    std::ofstream settings_file(file_path, std::ios::out | std::ios::binary);
+    std::string const temp_file_path = file_path + ".upgrade-tmp";
+    std::string const line_end = MpeEmulator::Serializer::LINE_END;
+
+    {
+        std::ofstream settings_file(
+            temp_file_path, std::ios::out | std::ios::binary | std::ios::trunc
+        );
+
+        if (!settings_file.is_open()) {
+            return false;
+        }
+
+        for (MpeEmulator::Serializer::Lines::const_iterator it = comments.begin(); it != comments.end(); ++it) {
+            std::string const& comment = *it;
+
+            settings_file.write(comment.c_str(), comment.length());
+            settings_file.write(line_end.c_str(), line_end.length());
+        }
+
+        settings_file.write(settings.c_str(), settings.length());
+        settings_file.close();
+
+        if (settings_file.fail()) {
+            int const error_number = errno;
+
+            std::remove(temp_file_path.c_str());
+            errno = error_number;
+
+            return false;
+        }
+    }
+
+    std::error_code error_code;
+
+    std::filesystem::rename(temp_file_path, file_path, error_code);
+
+    if (error_code) {
+        std::remove(temp_file_path.c_str());
+        errno = error_code.value();
 
-    if (!settings_file.is_open()) {
         return false;
     }
 
-    std::string const line_end = MpeEmulator::Serializer::LINE_END;
+    return true;
+}
+
+
+double to_mib_per_second(size_t const bytes, double const seconds)
+{
+    return seconds > 0.0 ? (double)bytes / (1024.0 * 1024.0 * seconds) : 0.0;
+}
+
+
+bool upgrade_settings(
+        MpeEmulator::Proxy& proxy,
+        std::string const& file_path,
+        size_t& bytes,
+        std::string& report
+) {
+    Clock::time_point const start = Clock::now();
+    std::string settings;
+
+    if (!read_settings(file_path, settings)) {
+        report = format_error("Error reading settings file", file_path, errno);
 
-    for (MpeEmulator::Serializer::Lines::const_iterator it = comments.begin(); it != comments.end(); ++it) {
-        std::string const& comment = *it;
-        std::cout << "c: " << comment << std::endl;
+        return false;
+    }
+
+    MpeEmulator::Serializer::Lines comments;
+
+    MpeEmulator::Serializer::import_settings_in_audio_thread(proxy, settings);
 
-        settings_file.write(comment.c_str(), comment.length());
-        settings_file.write(line_end.c_str(), line_end.length());
+    collect_comments(settings, comments);
+
+    if (!write_settings(file_path, MpeEmulator::Serializer::serialize(proxy), comments)) {
+        report = format_error("Error writing settings file", file_path, errno);
+
+        return false;
     }
 
-    settings_file.write(settings.c_str(), settings.length());
+    double const seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::ostringstream message;
+
+    bytes = settings.length();
+
+    message
+        << "Upgraded " << file_path
+        << " (" << bytes << " bytes, "
+        << std::fixed << std::setprecision(3) << seconds * 1000.0 << " ms, "
+        << std::setprecision(2) << to_mib_per_second(bytes, seconds) << " MiB/s)"
+        << std::endl;
+
+    report = message.str();
 
     return true;
 }
 
 
-int error(char const* const message, char const* const file_path)
+bool is_settings_file(std::filesystem::directory_entry const& entry)
 {
-    std::cerr
-        << "ERROR: "
-        << message
-        << std::endl
-        << "  File: " << file_path << std::endl
-        << "  Errno: " << errno << std::endl
-        << "  Message: " << std::strerror(errno) << std::endl;
+    std::error_code error_code;
 
-    return 1;
+    return (
+        entry.is_regular_file(error_code)
+        && entry.path().extension() == ".mpe"
+    );
 }
 
 
-int upgrade_settings(char const* const settings_file)
+/*
+Files which are given explicitly are upgraded regardless of their extension,
+directories are searched recursively for .mpe files.
+*/
+bool collect_settings_files(std::string const& path, FilePaths& file_paths)
 {
-    std::cout << "Upgrading " << settings_file << std::endl;
+    std::error_code error_code;
 
-    std::string settings;
+    if (!std::filesystem::is_directory(path, error_code)) {
+        file_paths.push_back(path);
 
-    if (!read_settings(settings_file, settings)) {
-        return error("Error reading settings file", settings_file);
+        return true;
     }
 
-    MpeEmulator::Proxy proxy;
-    MpeEmulator::Serializer::Lines comments;
+    std::filesystem::recursive_directory_iterator it(path, error_code);
+    std::filesystem::recursive_directory_iterator const end;
+    FilePaths found;
 
-    MpeEmulator::Serializer::import_settings_in_audio_thread(proxy, settings);
+    for (; !error_code && it != end; it.increment(error_code)) {
+        if (is_settings_file(*it)) {
+            found.push_back(it->path().string());
+        }
+    }
 
-    collect_comments(settings, comments);
+    if (error_code) {
+        std::cerr << format_error("Error reading directory", path, error_code.value());
+
+        return false;
+    }
+
+    std::sort(found.begin(), found.end());
+    file_paths.insert(file_paths.end(), found.begin(), found.end());
+
+    return true;
+}
+
+
+class Worker
+{
+    public:
+        Worker(FilePaths const& file_paths, std::atomic<size_t>& next_file)
+            : file_paths(file_paths),
+            next_file(next_file)
+        {
+        }
+
+        void run()
+        {
+            MpeEmulator::Proxy proxy;
+            std::string report;
+
+            for (;;) {
+                size_t const index = next_file.fetch_add(1);
+
+                if (index >= file_paths.size()) {
+                    break;
+                }
+
+                size_t bytes = 0;
+                bool const success = upgrade_settings(
+                    proxy, file_paths[index], bytes, report
+                );
+
+                ++stats.files;
+
+                if (success) {
+                    stats.bytes += bytes;
+                } else {
+                    ++stats.failed;
+                }
+
+                print(report, success);
+            }
+        }
+
+        Stats stats;
+
+    private:
+        void print(std::string const& report, bool const success)
+        {
+#ifdef MPE_EMULATOR_UPGRADE_SETTINGS_THREADS
+            std::lock_guard<std::mutex> lock(output_mutex);
+#endif
+
+            (success ? std::cout : std::cerr) << report;
+        }
+
+#ifdef MPE_EMULATOR_UPGRADE_SETTINGS_THREADS
+        static std::mutex output_mutex;
+#endif
+
+        FilePaths const& file_paths;
+        std::atomic<size_t>& next_file;
+};
+
+
+#ifdef MPE_EMULATOR_UPGRADE_SETTINGS_THREADS
+std::mutex Worker::output_mutex;
+#endif
+
+
+Stats upgrade_settings_files(FilePaths const& file_paths, size_t jobs)
+{
+    std::atomic<size_t> next_file(0);
+    std::vector<Worker> workers;
+    Stats stats;
 
-    if (!write_settings(settings_file, MpeEmulator::Serializer::serialize(proxy), comments)) {
-        return error("Error writing settings file", settings_file);
+#ifdef MPE_EMULATOR_UPGRADE_SETTINGS_THREADS
+    jobs = std::max((size_t)1, std::min(jobs, file_paths.size()));
+#else
+    jobs = 1;
+#endif
+
+    workers.reserve(jobs);
+
+    for (size_t i = 0; i != jobs; ++i) {
+        workers.emplace_back(file_paths, next_file);
+    }
+
+#ifdef MPE_EMULATOR_UPGRADE_SETTINGS_THREADS
+    std::vector<std::thread> threads;
+
+    threads.reserve(jobs - 1);
+
+    for (size_t i = 1; i < jobs; ++i) {
+        threads.emplace_back(&Worker::run, &workers[i]);
     }
 
-    return 0;
+    workers[0].run();
+
+    for (std::vector<std::thread>::iterator it = threads.begin(); it != threads.end(); ++it) {
+        it->join();
+    }
+#else
+    workers[0].run();
+#endif
+
+    for (std::vector<Worker>::const_iterator it = workers.begin(); it != workers.end(); ++it) {
+        stats.files += it->stats.files;
+        stats.failed += it->stats.failed;
+        stats.bytes += it->stats.bytes;
+    }
+
+    return stats;
+}
+
+
+size_t get_default_jobs()
+{
+#ifdef MPE_EMULATOR_UPGRADE_SETTINGS_THREADS
+    return std::max(1U, std::thread::hardware_concurrency());
+#else
+    return 1;
+#endif
+}
+
+
+int usage(char const* const name)
+{
+    std::cerr
+        << "Usage: " << name << " [-j jobs] settings_file.mpe|directory [...]" << std::endl
+        << std::endl
+        << "Directories are searched recursively for .mpe files." << std::endl;
+
+    return 1;
 }
 
 
 int main(int argc, char const* argv[])
 {
-    if (argc < 2) {
-        std::cerr << "Usage: " << argv[0] << " settings_file.mp" << std::endl;
+    size_t jobs = get_default_jobs();
+    FilePaths file_paths;
+    int i = 1;
+
+    if (argc > 2 && std::strcmp(argv[1], "-j") == 0) {
+        int const requested_jobs = std::atoi(argv[2]);
+
+        if (requested_jobs < 1) {
+            return usage(argv[0]);
+        }
+
+        jobs = (size_t)requested_jobs;
+        i = 3;
+    }
 
-        return 1;
+    if (i >= argc) {
+        return usage(argv[0]);
     }
 
-    return upgrade_settings(argv[1]);
+    bool collected_all = true;
+
+    for (; i != argc; ++i) {
+        collected_all = collect_settings_files(argv[i], file_paths) && collected_all;
+    }
+
+    Clock::time_point const start = Clock::now();
+    Stats const stats = upgrade_settings_files(file_paths, jobs);
+    double const seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::cout
+        << "Upgraded " << (stats.files - stats.failed) << " of " << stats.files
+        << " file(s), " << stats.bytes << " bytes in "
+        << std::fixed << std::setprecision(3) << seconds << " s ("
+        << std::setprecision(1)
+        << (seconds > 0.0 ? (double)stats.files / seconds : 0.0) << " files/s, "
+        << std::setprecision(2) << to_mib_per_second(stats.bytes, seconds) << " MiB/s)"
+        << std::endl;
+
+    return (collected_all && stats.failed == 0) ? 0 : 1;
 }
@@ -0,0 +1,181 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "plugin/fst/plugin.hpp"
+
+
+using namespace MpeEmulator;
+
+
+typedef std::chrono::steady_clock Clock;
+
+
+constexpr VstInt32 BLOCK_SIZE = 32;
+constexpr int IN_EVENTS = 4;
+
+
+struct VstEventsBuffer
+{
+    int numEvents;
+    VstIntPtr _pad;
+    VstEvent* events[IN_EVENTS];
+};
+
+
+size_t host_process_events_calls = 0;
+size_t host_received_events = 0;
+
+
+VstIntPtr VSTCALLBACK host_callback(
+        AEffect* effect,
+        VstInt32 op_code,
+        VstInt32 index,
+        VstIntPtr ivalue,
+        void* pointer,
+        float fvalue
+) {
+    if (op_code == audioMasterProcessEvents) {
+        ++host_process_events_calls;
+        host_received_events += (size_t)((VstEvents*)pointer)->numEvents;
+    }
+
+    return 0;
+}
+
+
+void usage(char const* const name)
+{
+    fprintf(
+        stderr,
+        (
+            "Usage: %s blocks\n\n"
+            "Measure the average time it takes to process a block of %d samples\n"
+            "when there are no MIDI events (idle) and when every block contains\n"
+            "a few notes and controller changes (busy).\n"
+        ),
+        name,
+        (int)BLOCK_SIZE
+    );
+}
+
+
+void set_midi_event(
+        VstMidiEvent& event,
+        VstInt32 const delta_frames,
+        char const status,
+        char const data_1,
+        char const data_2
+) {
+    memset(&event, 0, sizeof(VstMidiEvent));
+
+    event.type = kVstMidiType;
+    event.byteSize = sizeof(VstMidiEvent);
+    event.deltaFrames = delta_frames;
+    event.midiData[0] = status;
+    event.midiData[1] = data_1;
+    event.midiData[2] = data_2;
+}
+
+
+double process_blocks(AEffect* const effect, int const blocks, bool const is_busy)
+{
+    float left[BLOCK_SIZE];
+    float right[BLOCK_SIZE];
+    float* outputs[] = {left, right};
+
+    VstMidiEvent midi_events[IN_EVENTS];
+    VstEventsBuffer in_events;
+
+    set_midi_event(midi_events[0], 0, (char)0x90, 60, 100);
+    set_midi_event(midi_events[1], 8, (char)0xb0, 1, 64);
+    set_midi_event(midi_events[2], 16, (char)0xe0, 0, 72);
+    set_midi_event(midi_events[3], 24, (char)0x80, 60, 64);
+
+    in_events.numEvents = IN_EVENTS;
+    in_events._pad = 0;
+
+    for (int i = 0; i != IN_EVENTS; ++i) {
+        in_events.events[i] = (VstEvent*)&midi_events[i];
+    }
+
+    Clock::time_point const begin = Clock::now();
+
+    for (int i = 0; i != blocks; ++i) {
+        if (is_busy) {
+            effect->dispatcher(effect, effProcessEvents, 0, 0, &in_events, 0.0f);
+        }
+
+        effect->processReplacing(effect, NULL, outputs, BLOCK_SIZE);
+    }
+
+    return (
+        (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - begin
+        ).count()
+        / (double)blocks
+    );
+}
+
+
+int main(int argc, char const* argv[])
+{
+    if (argc < 2) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    int const blocks = atoi(argv[1]);
+
+    if (blocks < 1) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    AEffect* const effect = FstPlugin::create_instance(&host_callback, NULL);
+
+    effect->dispatcher(effect, effOpen, 0, 0, NULL, 0.0f);
+    effect->dispatcher(effect, effSetSampleRate, 0, 0, NULL, 48000.0f);
+    effect->dispatcher(effect, effSetBlockSize, 0, BLOCK_SIZE, NULL, 0.0f);
+    effect->dispatcher(effect, effMainsChanged, 0, 1, NULL, 0.0f);
+
+    double const idle_avg_ns = process_blocks(effect, blocks, false);
+    size_t const idle_calls = host_process_events_calls;
+
+    double const busy_avg_ns = process_blocks(effect, blocks, true);
+    size_t const busy_calls = host_process_events_calls - idle_calls;
+
+    effect->dispatcher(effect, effMainsChanged, 0, 0, NULL, 0.0f);
+    effect->dispatcher(effect, effClose, 0, 0, NULL, 0.0f);
+
+    delete effect;
+
+    fprintf(stdout, "idle_block_avg_ns\t%f\n", idle_avg_ns);
+    fprintf(stdout, "idle_host_process_events_calls\t%lu\n", (long unsigned int)idle_calls);
+    fprintf(stdout, "busy_block_avg_ns\t%f\n", busy_avg_ns);
+    fprintf(stdout, "busy_host_process_events_calls\t%lu\n", (long unsigned int)busy_calls);
+    fprintf(stdout, "host_received_events\t%lu\n", (long unsigned int)host_received_events);
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "proxy.hpp"
+
+#include "gui/gui.hpp"
+
+
+using namespace MpeEmulator;
+
+
+typedef std::chrono::steady_clock Clock;
+
+
+void usage(char const* const name)
+{
+    fprintf(
+        stderr,
+        (
+            "Usage: %s iterations\n\n"
+            "Measure how long it takes to open and close an editor when no\n"
+            "other editor is open (cold), and when another editor is already\n"
+            "open in the same process (warm).\n"
+        ),
+        name
+    );
+}
+
+
+double open_and_close_editors(Proxy& proxy, int const iterations)
+{
+    Clock::time_point const begin = Clock::now();
+
+    for (int i = 0; i != iterations; ++i) {
+        GUI* const gui = new GUI(NULL, NULL, NULL, proxy, false);
+        gui->show();
+        delete gui;
+    }
+
+    return (
+        (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - begin
+        ).count()
+        / 1000.0
+        / (double)iterations
+    );
+}
+
+
+int main(int argc, char const* argv[])
+{
+    if (argc < 2) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    int const iterations = atoi(argv[1]);
+
+    if (iterations < 1) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    Proxy proxy;
+
+    double const cold_avg_us = open_and_close_editors(proxy, iterations);
+
+    GUI* const other_gui = new GUI(NULL, NULL, NULL, proxy, false);
+    double const warm_avg_us = open_and_close_editors(proxy, iterations);
+    delete other_gui;
+
+    fprintf(stdout, "cold_editor_open_avg_us\t%f\n", cold_avg_us);
+    fprintf(stdout, "warm_editor_open_avg_us\t%f\n", warm_avg_us);
+
+    return 0;
+}
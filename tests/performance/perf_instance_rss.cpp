@@ -0,0 +1,215 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include "plugin/fst/plugin.hpp"
+
+
+using namespace MpeEmulator;
+
+
+constexpr int IN_EVENTS = 4;
+constexpr int BUSY_BLOCKS = 64;
+
+
+struct VstEventsBuffer
+{
+    int numEvents;
+    VstIntPtr _pad;
+    VstEvent* events[IN_EVENTS];
+};
+
+
+VstIntPtr VSTCALLBACK host_callback(
+        AEffect* effect,
+        VstInt32 op_code,
+        VstInt32 index,
+        VstIntPtr ivalue,
+        void* pointer,
+        float fvalue
+) {
+    return 0;
+}
+
+
+void usage(char const* const name)
+{
+    fprintf(
+        stderr,
+        (
+            "Usage: %s instances [block_size]\n\n"
+            "Create the given number of plugin instances, and report how much\n"
+            "the resident set size of the process grows per instance, right\n"
+            "after the instances are resumed with the given maximum block size\n"
+            "(default: 512), and after they have processed a few blocks with\n"
+            "MIDI events in them.\n"
+        ),
+        name
+    );
+}
+
+
+long get_rss_bytes()
+{
+#ifdef __linux__
+    FILE* const statm = fopen("/proc/self/statm", "r");
+
+    if (statm == NULL) {
+        return -1;
+    }
+
+    long size_pages = 0;
+    long resident_pages = 0;
+    int const matched = fscanf(statm, "%ld %ld", &size_pages, &resident_pages);
+
+    fclose(statm);
+
+    if (matched != 2) {
+        return -1;
+    }
+
+    return resident_pages * sysconf(_SC_PAGESIZE);
+#else
+    return -1;
+#endif
+}
+
+
+void set_midi_event(
+        VstMidiEvent& event,
+        VstInt32 const delta_frames,
+        char const status,
+        char const data_1,
+        char const data_2
+) {
+    memset(&event, 0, sizeof(VstMidiEvent));
+
+    event.type = kVstMidiType;
+    event.byteSize = sizeof(VstMidiEvent);
+    event.deltaFrames = delta_frames;
+    event.midiData[0] = status;
+    event.midiData[1] = data_1;
+    event.midiData[2] = data_2;
+}
+
+
+void process_busy_blocks(AEffect* const effect, VstInt32 const block_size)
+{
+    std::vector<float> left((size_t)block_size);
+    std::vector<float> right((size_t)block_size);
+    float* outputs[] = {left.data(), right.data()};
+
+    VstMidiEvent midi_events[IN_EVENTS];
+    VstEventsBuffer in_events;
+
+    set_midi_event(midi_events[0], 0, (char)0x90, 60, 100);
+    set_midi_event(midi_events[1], block_size / 4, (char)0xb0, 1, 64);
+    set_midi_event(midi_events[2], block_size / 2, (char)0xe0, 0, 72);
+    set_midi_event(midi_events[3], block_size - 1, (char)0x80, 60, 64);
+
+    in_events.numEvents = IN_EVENTS;
+    in_events._pad = 0;
+
+    for (int i = 0; i != IN_EVENTS; ++i) {
+        in_events.events[i] = (VstEvent*)&midi_events[i];
+    }
+
+    for (int i = 0; i != BUSY_BLOCKS; ++i) {
+        effect->dispatcher(effect, effProcessEvents, 0, 0, &in_events, 0.0f);
+        effect->processReplacing(effect, NULL, outputs, block_size);
+    }
+}
+
+
+int main(int argc, char const* argv[])
+{
+    if (argc < 2) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    int const instances = atoi(argv[1]);
+    VstInt32 const block_size = argc > 2 ? (VstInt32)atoi(argv[2]) : 512;
+
+    if (instances < 1 || block_size < 1) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    long const rss_before = get_rss_bytes();
+
+    if (rss_before < 0) {
+        fprintf(stderr, "Reading the resident set size is not supported on this platform.\n");
+
+        return 1;
+    }
+
+    std::vector<AEffect*> effects;
+
+    effects.reserve((size_t)instances);
+
+    for (int i = 0; i != instances; ++i) {
+        AEffect* const effect = FstPlugin::create_instance(&host_callback, NULL);
+
+        effect->dispatcher(effect, effOpen, 0, 0, NULL, 0.0f);
+        effect->dispatcher(effect, effSetSampleRate, 0, 0, NULL, 48000.0f);
+        effect->dispatcher(effect, effSetBlockSize, 0, block_size, NULL, 0.0f);
+        effect->dispatcher(effect, effMainsChanged, 0, 1, NULL, 0.0f);
+
+        effects.push_back(effect);
+    }
+
+    long const rss_resumed = get_rss_bytes();
+
+    for (AEffect* const effect : effects) {
+        process_busy_blocks(effect, block_size);
+    }
+
+    long const rss_processed = get_rss_bytes();
+
+    for (AEffect* const effect : effects) {
+        effect->dispatcher(effect, effMainsChanged, 0, 0, NULL, 0.0f);
+        effect->dispatcher(effect, effClose, 0, 0, NULL, 0.0f);
+    }
+
+    fprintf(stdout, "instances\t%d\n", instances);
+    fprintf(stdout, "block_size\t%d\n", (int)block_size);
+    fprintf(stdout, "sizeof_fst_plugin_bytes\t%lu\n", (long unsigned int)sizeof(FstPlugin));
+    fprintf(
+        stdout,
+        "rss_per_instance_resumed_kib\t%f\n",
+        (double)(rss_resumed - rss_before) / (1024.0 * (double)instances)
+    );
+    fprintf(
+        stdout,
+        "rss_per_instance_processed_kib\t%f\n",
+        (double)(rss_processed - rss_before) / (1024.0 * (double)instances)
+    );
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "plugin/fst/plugin.hpp"
+
+
+using namespace MpeEmulator;
+
+
+typedef std::chrono::steady_clock Clock;
+
+
+constexpr VstInt32 BLOCK_SIZE = 32;
+
+
+VstIntPtr VSTCALLBACK host_callback(
+        AEffect* effect,
+        VstInt32 op_code,
+        VstInt32 index,
+        VstIntPtr ivalue,
+        void* pointer,
+        float fvalue
+) {
+    return 0;
+}
+
+
+void usage(char const* const name)
+{
+    fprintf(
+        stderr,
+        (
+            "Usage: %s sweeps\n\n"
+            "Measure the average time it takes to query the display string of\n"
+            "all %d parameters when their values do not change between sweeps\n"
+            "(polling), and when every parameter is changed before each sweep\n"
+            "(changing).\n"
+        ),
+        name,
+        (int)FstPlugin::NUMBER_OF_PARAMETERS
+    );
+}
+
+
+void change_all_parameters(AEffect* const effect, int const sweep)
+{
+    float left[BLOCK_SIZE];
+    float right[BLOCK_SIZE];
+    float* outputs[] = {left, right};
+
+    for (VstInt32 i = 0; i != effect->numParams; ++i) {
+        float const value = (float)((sweep * 37 + i * 11) % 1000) / 999.0f;
+
+        effect->setParameter(effect, i, value);
+    }
+
+    effect->processReplacing(effect, NULL, outputs, BLOCK_SIZE);
+}
+
+
+double sweep_all_parameters(AEffect* const effect, size_t& total_length)
+{
+    char buffer[kVstMaxParamStrLen];
+
+    Clock::time_point const begin = Clock::now();
+
+    for (VstInt32 i = 0; i != effect->numParams; ++i) {
+        effect->dispatcher(effect, effGetParamDisplay, i, 0, buffer, 0.0f);
+        total_length += strlen(buffer);
+    }
+
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now() - begin
+    ).count();
+}
+
+
+int main(int argc, char const* argv[])
+{
+    if (argc < 2) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    int const sweeps = atoi(argv[1]);
+
+    if (sweeps < 1) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    AEffect* const effect = FstPlugin::create_instance(&host_callback, NULL);
+
+    effect->dispatcher(effect, effOpen, 0, 0, NULL, 0.0f);
+    effect->dispatcher(effect, effSetSampleRate, 0, 0, NULL, 48000.0f);
+    effect->dispatcher(effect, effSetBlockSize, 0, BLOCK_SIZE, NULL, 0.0f);
+    effect->dispatcher(effect, effMainsChanged, 0, 1, NULL, 0.0f);
+
+    double polling_ns = 0.0;
+    double changing_ns = 0.0;
+    size_t total_length = 0;
+
+    change_all_parameters(effect, 0);
+
+    for (int i = 0; i != sweeps; ++i) {
+        polling_ns += sweep_all_parameters(effect, total_length);
+    }
+
+    for (int i = 0; i != sweeps; ++i) {
+        change_all_parameters(effect, i + 1);
+        changing_ns += sweep_all_parameters(effect, total_length);
+    }
+
+    effect->dispatcher(effect, effMainsChanged, 0, 0, NULL, 0.0f);
+    effect->dispatcher(effect, effClose, 0, 0, NULL, 0.0f);
+
+    delete effect;
+
+    fprintf(stdout, "parameters\t%d\n", (int)FstPlugin::NUMBER_OF_PARAMETERS);
+    fprintf(stdout, "polling_sweep_avg_ns\t%f\n", polling_ns / (double)sweeps);
+    fprintf(stdout, "changing_sweep_avg_ns\t%f\n", changing_ns / (double)sweeps);
+    fprintf(stdout, "total_length\t%lu\n", (long unsigned int)total_length);
+
+    return 0;
+}
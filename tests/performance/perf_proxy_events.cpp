@@ -0,0 +1,245 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "proxy.cpp"
+
+
+using namespace MpeEmulator;
+
+
+typedef std::chrono::steady_clock Clock;
+
+
+constexpr int EVENTS_PER_BLOCK = 24;
+
+
+void usage(char const* const name)
+{
+    fprintf(
+        stderr,
+        (
+            "Usage: %s instances blocks\n\n"
+            "Feed the given number of blocks of notes and controller events to\n"
+            "the given number of Proxy instances in a round-robin fashion (like\n"
+            "a host would do with multiple plugin instances), and report the\n"
+            "average time, and where the platform supports it, the average\n"
+            "number of L1 data cache and last level cache misses per event.\n"
+        ),
+        name
+    );
+}
+
+
+class Counter
+{
+    public:
+        Counter(unsigned int const type, unsigned long long const config)
+            : fd(-1)
+        {
+#ifdef __linux__
+            perf_event_attr attr;
+
+            memset(&attr, 0, sizeof(attr));
+
+            attr.type = type;
+            attr.size = sizeof(attr);
+            attr.config = config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+
+            fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+        }
+
+        ~Counter()
+        {
+#ifdef __linux__
+            if (fd >= 0) {
+                close(fd);
+            }
+#endif
+        }
+
+        bool is_available() const
+        {
+            return fd >= 0;
+        }
+
+        void start()
+        {
+#ifdef __linux__
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        unsigned long long stop()
+        {
+            unsigned long long count = 0;
+
+#ifdef __linux__
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+                if (read(fd, &count, sizeof(count)) != sizeof(count)) {
+                    count = 0;
+                }
+            }
+#endif
+
+            return count;
+        }
+
+    private:
+        int fd;
+};
+
+
+void process_block(Proxy& proxy, int const block)
+{
+    Midi::Note const root = (Midi::Note)(36 + (block % 24));
+
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, root, 100);
+    proxy.note_on(0.0, 0, root + 4, 100);
+    proxy.note_on(0.0, 0, root + 7, 100);
+    proxy.note_on(0.0, 0, root + 12, 100);
+
+    for (int i = 0; i != 8; ++i) {
+        double const time_offset = (double)(i * 4);
+
+        proxy.pitch_wheel_change(time_offset, 0, (Midi::Word)(8192 + 512 * i));
+        proxy.channel_pressure(time_offset + 1.0, 0, (Midi::Byte)(64 + i));
+    }
+
+    proxy.control_change(
+        30.0, 0, Proxy::ControllerId::MODULATION_WHEEL, (Midi::Byte)block & 0x7f
+    );
+    proxy.note_off(31.0, 0, root, 64);
+    proxy.note_off(31.0, 0, root + 4, 64);
+    proxy.note_off(31.0, 0, root + 7, 64);
+    proxy.note_off(31.0, 0, root + 12, 64);
+}
+
+
+void print_per_event(
+        char const* const name,
+        Counter const& counter,
+        unsigned long long const count,
+        double const events
+) {
+    if (counter.is_available()) {
+        fprintf(stdout, "%s\t%f\n", name, (double)count / events);
+    } else {
+        fprintf(stdout, "%s\tn/a\n", name);
+    }
+}
+
+
+int main(int argc, char const* argv[])
+{
+    if (argc < 3) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    int const instances = atoi(argv[1]);
+    int const blocks = atoi(argv[2]);
+
+    if (instances < 1 || blocks < 1) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    Proxy** const proxies = new Proxy*[(size_t)instances];
+
+    for (int i = 0; i != instances; ++i) {
+        proxies[i] = new Proxy();
+        proxies[i]->rules[3].in_cc.set_value(Proxy::ControllerId::MODULATION_WHEEL);
+        proxies[i]->rules[3].out_cc.set_value(Proxy::ControllerId::MODULATION_WHEEL);
+        proxies[i]->rules[3].target.set_value(Proxy::Target::TRG_ALL_BELOW_ANCHOR);
+    }
+
+    Counter l1d_misses(
+        PERF_TYPE_HW_CACHE,
+        (
+            PERF_COUNT_HW_CACHE_L1D
+            | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+            | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+        )
+    );
+    Counter llc_misses(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+
+    size_t out_events_count = 0;
+
+    l1d_misses.start();
+    llc_misses.start();
+
+    Clock::time_point const begin = Clock::now();
+
+    for (int b = 0; b != blocks; ++b) {
+        for (int i = 0; i != instances; ++i) {
+            process_block(*proxies[i], b);
+            out_events_count += proxies[i]->out_events.size();
+        }
+    }
+
+    double const elapsed_ns = (double)(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - begin
+        ).count()
+    );
+
+    unsigned long long const l1d_misses_count = l1d_misses.stop();
+    unsigned long long const llc_misses_count = llc_misses.stop();
+
+    double const events = (double)instances * (double)blocks * EVENTS_PER_BLOCK;
+
+    for (int i = 0; i != instances; ++i) {
+        delete proxies[i];
+    }
+
+    delete[] proxies;
+
+    fprintf(stdout, "sizeof_proxy\t%lu\n", (long unsigned int)sizeof(Proxy));
+    fprintf(stdout, "sizeof_param\t%lu\n", (long unsigned int)sizeof(Proxy::Param));
+    fprintf(stdout, "event_avg_ns\t%f\n", elapsed_ns / events);
+    print_per_event("l1d_read_misses_per_event", l1d_misses, l1d_misses_count, events);
+    print_per_event("llc_misses_per_event", llc_misses, llc_misses_count, events);
+    fprintf(stdout, "out_events\t%lu\n", (long unsigned int)out_events_count);
+
+    return 0;
+}
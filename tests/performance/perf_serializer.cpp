@@ -0,0 +1,132 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "bank.hpp"
+#include "proxy.hpp"
+#include "serializer.hpp"
+
+
+using namespace MpeEmulator;
+
+
+typedef std::chrono::steady_clock Clock;
+
+
+void usage(char const* const name)
+{
+    fprintf(
+        stderr,
+        (
+            "Usage: %s iterations\n\n"
+            "Serialize all %d programs of a bank the given number of times, with\n"
+            "every parameter set to a non-default value. Measure the time it takes\n"
+            "to serialize a program that differs from the previous one (bank),\n"
+            "to serialize it again without changes (flush), and to serialize the\n"
+            "whole bank.\n"
+        ),
+        name,
+        (int)Bank::NUMBER_OF_PROGRAMS
+    );
+}
+
+
+void load_program(Proxy& proxy, size_t const program_index)
+{
+    for (int i = 0; i != Proxy::ParamId::PARAM_ID_COUNT; ++i) {
+        double const ratio = (
+            (double)((program_index * 31 + (size_t)i * 17) % 997 + 1) / 999.0
+        );
+
+        proxy.push_message(Proxy::MessageType::SET_PARAM, (Proxy::ParamId)i, ratio);
+    }
+
+    proxy.process_messages();
+}
+
+
+double elapsed_ns(Clock::time_point const& since)
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now() - since
+    ).count();
+}
+
+
+int main(int argc, char const* argv[])
+{
+    if (argc < 2) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    int const iterations = atoi(argv[1]);
+
+    if (iterations < 1) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    Proxy* const proxy = new Proxy();
+    Bank* const bank = new Bank();
+    double program_ns = 0.0;
+    double flush_ns = 0.0;
+    double bank_ns = 0.0;
+    size_t serialized_bytes = 0;
+
+    for (int i = 0; i != iterations; ++i) {
+        for (size_t p = 0; p != Bank::NUMBER_OF_PROGRAMS; ++p) {
+            load_program(*proxy, p);
+
+            Clock::time_point begin = Clock::now();
+            std::string const program = Serializer::serialize(*proxy);
+            program_ns += elapsed_ns(begin);
+
+            begin = Clock::now();
+            std::string const flushed = Serializer::serialize(*proxy);
+            flush_ns += elapsed_ns(begin);
+
+            serialized_bytes += program.length() + flushed.length();
+            (*bank)[p].import(program);
+        }
+
+        Clock::time_point const begin = Clock::now();
+        std::string const serialized_bank = bank->serialize();
+        bank_ns += elapsed_ns(begin);
+
+        serialized_bytes += serialized_bank.length();
+    }
+
+    delete bank;
+    delete proxy;
+
+    double const programs = (double)iterations * (double)Bank::NUMBER_OF_PROGRAMS;
+
+    fprintf(stdout, "bank_program_serialize_avg_ns\t%f\n", program_ns / programs);
+    fprintf(stdout, "flush_program_serialize_avg_ns\t%f\n", flush_ns / programs);
+    fprintf(stdout, "full_bank_avg_ns\t%f\n", (program_ns + bank_ns) / (double)iterations);
+    fprintf(stdout, "serialized_bytes\t%lu\n", (long unsigned int)serialized_bytes);
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+
+typedef std::chrono::steady_clock Clock;
+
+
+/*
+Static objects within the same translation unit are initialized in the order
+of their definition, so this one is initialized before everything that the
+plugin would initialize when its shared object is loaded.
+*/
+static Clock::time_point const load_time = Clock::now();
+
+
+#include "proxy.cpp"
+
+
+using namespace MpeEmulator;
+
+
+void usage(char const* const name)
+{
+    fprintf(
+        stderr,
+        (
+            "Usage: %s iterations\n\n"
+            "Measure how long it takes from loading the program to the end of\n"
+            "processing the first block, then measure creating a new Proxy and\n"
+            "processing its first block the given number of times.\n"
+        ),
+        name
+    );
+}
+
+
+unsigned int process_first_block(Proxy& proxy)
+{
+    proxy.rules[0].distortion_level.set_ratio(1.0);
+
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, 60, 100);
+    proxy.control_change(1.0, 0, Proxy::ControllerId::MODULATION_WHEEL, 64);
+    proxy.channel_pressure(2.0, 0, 90);
+    proxy.pitch_wheel_change(3.0, 0, 10000);
+    proxy.note_off(4.0, 0, 60, 64);
+
+    return (unsigned int)proxy.out_events.size();
+}
+
+
+double elapsed_us(Clock::time_point const& since)
+{
+    return (
+        (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now() - since
+        ).count()
+        / 1000.0
+    );
+}
+
+
+int main(int argc, char const* argv[])
+{
+    if (argc < 2) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    int const iterations = atoi(argv[1]);
+
+    if (iterations < 1) {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    unsigned int out_events_count = 0;
+
+    Proxy* proxy = new Proxy();
+    out_events_count += process_first_block(*proxy);
+    delete proxy;
+
+    double const load_to_first_process_us = elapsed_us(load_time);
+
+    Clock::time_point const begin = Clock::now();
+
+    for (int i = 0; i != iterations; ++i) {
+        proxy = new Proxy();
+        out_events_count += process_first_block(*proxy);
+        delete proxy;
+    }
+
+    double const total_us = elapsed_us(begin);
+
+    fprintf(stdout, "load_to_first_process_us\t%f\n", load_to_first_process_us);
+    fprintf(stdout, "new_proxy_to_first_process_avg_us\t%f\n", total_us / (double)iterations);
+    fprintf(stdout, "out_events\t%u\n", out_events_count);
+
+    return 0;
+}
@@ -0,0 +1,353 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstddef>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "test.cpp"
+
+#include "proxy.cpp"
+#include "bridge/bridge.cpp"
+
+
+using namespace MpeEmulator;
+
+
+class Pipe
+{
+    public:
+        Pipe()
+        {
+            int fds[2];
+
+            assert_eq(0, pipe(fds));
+
+            read_fd = fds[0];
+            write_fd = fds[1];
+
+            fcntl(read_fd, F_SETFL, fcntl(read_fd, F_GETFL) | O_NONBLOCK);
+        }
+
+        ~Pipe()
+        {
+            close_read_end();
+            close_write_end();
+        }
+
+        void write_bytes(std::string const& bytes)
+        {
+            assert_eq(
+                (long long int)bytes.length(),
+                (long long int)write(write_fd, bytes.data(), bytes.length())
+            );
+        }
+
+        std::string read_bytes()
+        {
+            std::string bytes;
+            char buffer[256];
+            ssize_t size;
+
+            while ((size = read(read_fd, buffer, sizeof(buffer))) > 0) {
+                bytes.append(buffer, (size_t)size);
+            }
+
+            return bytes;
+        }
+
+        void close_read_end()
+        {
+            if (read_fd != -1) {
+                close(read_fd);
+                read_fd = -1;
+            }
+        }
+
+        void close_write_end()
+        {
+            if (write_fd != -1) {
+                close(write_fd);
+                write_fd = -1;
+            }
+        }
+
+        int read_fd;
+        int write_fd;
+};
+
+
+/*
+Feed the same input directly to a separate Proxy instance, and tell what the
+bridge is expected to write.
+*/
+class ReferenceProxy
+{
+    public:
+        ReferenceProxy() : running_status(0)
+        {
+            proxy.resume();
+            proxy.begin_processing();
+        }
+
+        std::string process_initial_events()
+        {
+            std::string const bytes = encode_with_running_status();
+
+            proxy.begin_processing();
+
+            return bytes;
+        }
+
+        std::string process(std::string const& input)
+        {
+            Midi::EventDispatcher<Proxy>::dispatch_events(
+                proxy, 0.0, (Midi::Byte const*)input.data(), input.length()
+            );
+
+            std::string const bytes = encode_with_running_status();
+
+            proxy.begin_processing();
+
+            return bytes;
+        }
+
+    private:
+        std::string encode_with_running_status()
+        {
+            std::string bytes;
+            Midi::Byte buffer[3];
+
+            for (Proxy::OutEvents::const_iterator it = proxy.out_events.begin(); it != proxy.out_events.end(); ++it) {
+                size_t const size = Bridge::encode(*it, running_status, buffer);
+
+                bytes.append((char const*)buffer, size);
+            }
+
+            return bytes;
+        }
+
+        Proxy proxy;
+        Midi::Byte running_status;
+};
+
+
+TEST(complete_messages_are_found_in_partially_received_input, {
+    Midi::Byte const note_on[] = {0x90, 0x3c, 0x7f, 0x90, 0x3e};
+    Midi::Byte const running_status[] = {0x3c, 0x7f, 0x3e, 0x7f, 0x40};
+    Midi::Byte const program_change[] = {0xc0, 0x01, 0x02};
+    Midi::Byte const sysex[] = {0xf0, 0x01, 0x02, 0x03};
+
+    assert_eq(0, (int)Bridge::find_complete_messages(note_on, 0, 0x00));
+    assert_eq(0, (int)Bridge::find_complete_messages(note_on, 1, 0x00));
+    assert_eq(0, (int)Bridge::find_complete_messages(note_on, 2, 0x00));
+    assert_eq(3, (int)Bridge::find_complete_messages(note_on, 5, 0x00));
+    assert_eq(4, (int)Bridge::find_complete_messages(running_status, 5, 0x90));
+    assert_eq(3, (int)Bridge::find_complete_messages(program_change, 3, 0x00));
+    assert_eq(4, (int)Bridge::find_complete_messages(sysex, 4, 0x00));
+    assert_eq(2, (int)Bridge::find_complete_messages(running_status, 2, 0x00));
+})
+
+
+TEST(real_time_messages_are_removed_from_the_input, {
+    Midi::Byte buffer[] = {0x90, 0xf8, 0x3c, 0xfe, 0x7f, 0xfa};
+    Midi::Byte const expected[] = {0x90, 0x3c, 0x7f};
+
+    assert_eq(3, (int)Bridge::remove_real_time_messages(buffer, 6));
+    assert_eq(expected, buffer, 3);
+})
+
+
+TEST(status_byte_is_omitted_when_it_matches_the_running_status, {
+    Midi::Byte running_status = 0;
+    Midi::Byte buffer[3] = {0, 0, 0};
+
+    assert_eq(
+        3,
+        (int)Bridge::encode(
+            Midi::Event(0, Midi::NOTE_ON, 1, 60, 127), running_status, buffer
+        )
+    );
+    assert_eq(0x91, (int)buffer[0]);
+    assert_eq(0x91, (int)running_status);
+
+    assert_eq(
+        2,
+        (int)Bridge::encode(
+            Midi::Event(0, Midi::NOTE_ON, 1, 62, 100), running_status, buffer
+        )
+    );
+    assert_eq(62, (int)buffer[0]);
+    assert_eq(100, (int)buffer[1]);
+
+    assert_eq(
+        2,
+        (int)Bridge::encode(
+            Midi::Event(0, Midi::CHANNEL_PRESSURE, 2, 42), running_status, buffer
+        )
+    );
+    assert_eq(0xd2, (int)buffer[0]);
+    assert_eq(42, (int)buffer[1]);
+})
+
+
+TEST(bridge_writes_the_same_events_as_the_proxy_would_send_to_a_plugin_host, {
+    std::string const input_1("\x90\x3c\x7f\xb0\x4a\x20", 6);
+    std::string const input_2("\x3e\x60\xe0\x00\x50\x80\x3c\x40", 8);
+    ReferenceProxy reference;
+    Proxy proxy;
+    Pipe input;
+    Pipe output;
+    Bridge bridge(proxy, input.read_fd, output.write_fd);
+
+    assert_true(bridge.start());
+    assert_eq(reference.process_initial_events(), output.read_bytes());
+
+    assert_eq((int)Bridge::Status::IDLE, (int)bridge.process(0));
+
+    input.write_bytes(input_1);
+    assert_eq((int)Bridge::Status::PROCESSED, (int)bridge.process(0));
+    assert_eq(reference.process(input_1), output.read_bytes());
+
+    input.write_bytes(input_2);
+    assert_eq((int)Bridge::Status::PROCESSED, (int)bridge.process(0));
+    assert_eq(reference.process(input_2), output.read_bytes());
+
+    assert_eq(2, (int)bridge.get_latency_stats().get_count());
+    assert_lte(
+        (long long int)bridge.get_latency_stats().get_min(),
+        (long long int)bridge.get_latency_stats().get_max()
+    );
+})
+
+
+TEST(messages_which_are_split_between_reads_are_processed_when_complete, {
+    std::string const note_on("\x90\x3c\x7f", 3);
+    ReferenceProxy reference;
+    Proxy proxy;
+    Pipe input;
+    Pipe output;
+    Bridge bridge(proxy, input.read_fd, output.write_fd);
+
+    assert_true(bridge.start());
+    reference.process_initial_events();
+    output.read_bytes();
+
+    input.write_bytes(note_on.substr(0, 2));
+    bridge.process(0);
+    assert_eq("", output.read_bytes());
+
+    input.write_bytes(note_on.substr(2));
+    assert_eq((int)Bridge::Status::PROCESSED, (int)bridge.process(0));
+    assert_eq(reference.process(note_on), output.read_bytes());
+})
+
+
+TEST(when_input_is_closed_then_bridge_reports_end_of_input_and_releases_notes, {
+    std::string const note_on("\x90\x3c\x7f", 3);
+    Proxy proxy;
+    Pipe input;
+    Pipe output;
+    Bridge bridge(proxy, input.read_fd, output.write_fd);
+
+    assert_true(bridge.start());
+    input.write_bytes(note_on);
+    bridge.process(0);
+    output.read_bytes();
+
+    input.close_write_end();
+    assert_eq((int)Bridge::Status::END_OF_INPUT, (int)bridge.process(0));
+
+    assert_true(bridge.stop());
+
+    std::string const released = output.read_bytes();
+
+    assert_true(released.find("\x3c\x40", 0, 2) != std::string::npos);
+})
+
+
+TEST(when_rate_limit_holds_back_the_final_value_of_a_gesture_then_bridge_sends_it_when_due, {
+    std::string const note_on("\x90\x3c\x7f", 3);
+    std::string const pitch_bend_1("\xe0\x00\x50", 3);
+    std::string const pitch_bend_2("\xe0\x00\x60", 3);
+    Proxy proxy;
+    Pipe input;
+    Pipe output;
+    Bridge bridge(proxy, input.read_fd, output.write_fd);
+
+    for (size_t i = 0; i != Proxy::RULES; ++i) {
+        proxy.rules[i].rate_limit.set_value(Proxy::RateLimit::RL_25_HZ);
+    }
+
+    assert_true(bridge.start());
+    input.write_bytes(note_on);
+    bridge.process(0);
+    output.read_bytes();
+
+    input.write_bytes(pitch_bend_1);
+    assert_eq((int)Bridge::Status::PROCESSED, (int)bridge.process(0));
+    assert_true(output.read_bytes().find("\x00\x50", 0, 2) != std::string::npos);
+
+    input.write_bytes(pitch_bend_2);
+    assert_eq((int)Bridge::Status::PROCESSED, (int)bridge.process(0));
+    assert_eq("", output.read_bytes());
+    assert_true(proxy.has_held_controller_values());
+
+    usleep(60000);
+
+    assert_eq((int)Bridge::Status::IDLE, (int)bridge.process(0));
+    assert_true(output.read_bytes().find("\x00\x60", 0, 2) != std::string::npos);
+    assert_false(proxy.has_held_controller_values());
+})
+
+
+TEST(when_deadband_holds_back_the_final_value_of_a_gesture_then_bridge_sends_it_at_gesture_end, {
+    std::string const note_on("\x90\x3c\x7f", 3);
+    std::string const pitch_bend_1("\xe0\x00\x50", 3);
+    std::string const pitch_bend_2("\xe0\x00\x52", 3);
+    Proxy proxy;
+    Pipe input;
+    Pipe output;
+    Bridge bridge(proxy, input.read_fd, output.write_fd);
+
+    for (size_t i = 0; i != Proxy::RULES; ++i) {
+        proxy.rules[i].deadband.set_value(8);
+    }
+
+    assert_true(bridge.start());
+    input.write_bytes(note_on);
+    bridge.process(0);
+    output.read_bytes();
+
+    input.write_bytes(pitch_bend_1);
+    assert_eq((int)Bridge::Status::PROCESSED, (int)bridge.process(0));
+    assert_true(output.read_bytes().find("\x00\x50", 0, 2) != std::string::npos);
+
+    input.write_bytes(pitch_bend_2);
+    assert_eq((int)Bridge::Status::PROCESSED, (int)bridge.process(0));
+    assert_eq("", output.read_bytes());
+    assert_true(proxy.has_held_controller_values());
+
+    usleep(60000);
+
+    assert_eq((int)Bridge::Status::IDLE, (int)bridge.process(0));
+    assert_true(output.read_bytes().find("\x00\x52", 0, 2) != std::string::npos);
+    assert_false(proxy.has_held_controller_values());
+})
@@ -47,3 +47,26 @@ TEST(gui_initialization, {
     GUI gui(NULL, NULL, NULL, proxy, false);
     gui.show();
 })
+
+
+TEST(images_are_shared_between_gui_instances, {
+    Proxy proxy_1;
+    Proxy proxy_2;
+
+    GUI* gui_1 = new GUI(NULL, NULL, NULL, proxy_1, false);
+    GUI* gui_2 = new GUI(NULL, NULL, NULL, proxy_2, true);
+
+    gui_1->show();
+    gui_2->show();
+
+    delete gui_1;
+
+    gui_2->show();
+
+    delete gui_2;
+
+    gui_1 = new GUI(NULL, NULL, NULL, proxy_1, false);
+    gui_1->show();
+
+    delete gui_1;
+})
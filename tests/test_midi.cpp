@@ -260,6 +260,79 @@ TEST(running_status, {
 })
 
 
+
+class NoteOnOrderRecorder : public Midi::EventHandler
+{
+    public:
+        NoteOnOrderRecorder(char const name, std::string& log)
+            : name(name),
+            log(log)
+        {
+        }
+
+        void note_on(
+                double const time_offset,
+                Midi::Channel const channel,
+                Midi::Note const note,
+                Midi::Byte const velocity
+        ) noexcept MPE_EMULATOR_OVERRIDE {
+            log += name;
+        }
+
+    private:
+        char const name;
+        std::string& log;
+};
+
+
+TEST(fan_out_event_handler_forwards_each_parsed_event_to_all_handlers, {
+    typedef Midi::FanOutEventHandler<MidiEventLogger, MidiEventLogger> Handlers;
+
+    constexpr size_t buffer_size = 14;
+
+    char const* const buffer = (
+        "\x97\x61\x70"
+            "\x62\x71"
+        "\xb7\x01\x60"
+        "\xe6\x3c\x15"
+        "\xb6\x78\x00"
+    );
+    MidiEventLogger logger_1;
+    MidiEventLogger logger_2;
+    Handlers handlers(logger_1, logger_2);
+    size_t const processed_bytes = (
+        Midi::EventDispatcher<Handlers>::dispatch_events(
+            handlers, 1.0, (Midi::Byte const*)buffer, buffer_size
+        )
+    );
+
+    assert_all_bytes_were_processed(buffer_size, processed_bytes);
+    assert_eq(parse_midi(1.0, buffer, buffer_size), logger_1.events);
+    assert_eq(logger_1.events, logger_2.events);
+    assert_eq(0xb6, (int)handlers.running_status);
+    assert_eq(0, (int)logger_1.running_status);
+    assert_eq(0, (int)logger_2.running_status);
+})
+
+
+TEST(fan_out_event_handler_notifies_handlers_in_the_given_order, {
+    typedef Midi::FanOutEventHandler<
+        NoteOnOrderRecorder, NoteOnOrderRecorder, NoteOnOrderRecorder
+    > Handlers;
+
+    std::string log;
+    NoteOnOrderRecorder recorder_a('a', log);
+    NoteOnOrderRecorder recorder_b('b', log);
+    NoteOnOrderRecorder recorder_c('c', log);
+    Handlers handlers(recorder_a, recorder_b, recorder_c);
+
+    Midi::EventDispatcher<Handlers>::dispatch_events(
+        handlers, 0.0, (Midi::Byte const*)"\x90\x3c\x7f\x3e\x7f", 5
+    );
+
+    assert_eq("abcabc", log);
+})
+
 TEST(type_conversions, {
     assert_eq(0, Midi::float_to_byte<float>(-0.1f));
     assert_eq(0, Midi::float_to_byte<float>(0.0f));
@@ -285,31 +358,64 @@ TEST(type_conversions, {
 })
 
 
+TEST(time_offset_to_sample_offset_conversion, {
+    assert_eq(0, (int)Midi::to_sample_offset(0.0));
+    assert_eq(0, (int)Midi::to_sample_offset(-0.0));
+    assert_eq(0, (int)Midi::to_sample_offset(-1.0));
+    assert_eq(0, (int)Midi::to_sample_offset(0.4));
+    assert_eq(1, (int)Midi::to_sample_offset(0.5));
+    assert_eq(255, (int)Midi::to_sample_offset(255.0));
+    assert_eq(
+        (long long int)UINT32_MAX,
+        (long long int)Midi::to_sample_offset(1e12)
+    );
+})
+
+
 void assert_event_sample_offset(
         int const expected_offset,
         double const time_offset,
-        double const sample_rate,
         int const last_sample_offset
 ) {
-    Midi::Event event(time_offset, Midi::NOTE_OFF, 1);
+    Midi::Event event(Midi::to_sample_offset(time_offset), Midi::NOTE_OFF, 1);
 
     assert_eq(
         expected_offset,
-        event.get_sample_offset(sample_rate, last_sample_offset),
-        "time_offset=%f, sample_rate=%f, last_sample_offset=%d",
+        event.get_sample_offset<int>(last_sample_offset),
+        "time_offset=%f, last_sample_offset=%d",
         time_offset,
-        sample_rate,
         last_sample_offset
     );
 }
 
 
-TEST(event_time_offset_to_sample_offset_conversion, {
-    assert_event_sample_offset(0, 0.0, 44100.0, 255);
-    assert_event_sample_offset(0, -0.0, 44100.0, 255);
-    assert_event_sample_offset(0, -1.0, 44100.0, 255);
-    assert_event_sample_offset(0, 0.000001, 44100.0, 255);
-    assert_event_sample_offset(255, 1.0, 44100.0, 255);
-    assert_event_sample_offset(100, 0.01, 10000.0, 255);
-    assert_event_sample_offset(100, 0.999999, 100.0, 999);
+TEST(event_sample_offset_is_limited_to_the_last_sample_of_the_block, {
+    assert_event_sample_offset(0, 0.0, 255);
+    assert_event_sample_offset(0, -1.0, 255);
+    assert_event_sample_offset(100, 100.0, 255);
+    assert_event_sample_offset(255, 255.0, 255);
+    assert_event_sample_offset(255, 44100.0, 255);
+})
+
+
+TEST(event_is_packed_into_8_bytes, {
+    Midi::Event const event(42, Midi::PITCH_BEND_CHANGE, 5, 0x7f, 0x3f, true);
+
+    assert_eq((int)sizeof(Midi::Event), 8);
+    assert_eq((int)Midi::PITCH_BEND_CHANGE, (int)event.get_command());
+    assert_eq(5, (int)event.get_channel());
+    assert_true(event.is_pre_note_on_setup());
+    assert_eq(
+        Midi::word_to_float<double>(0x1fff), event.get_value(), 0.000001
+    );
+    assert_eq(
+        1.0,
+        Midi::Event(0, Midi::CHANNEL_PRESSURE, 0, 127).get_value(),
+        0.000001
+    );
+    assert_eq(
+        0.5,
+        Midi::Event(0, Midi::CONTROL_CHANGE, 0, 1, 0x40).get_value(),
+        0.01
+    );
 })
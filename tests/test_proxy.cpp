@@ -85,21 +85,17 @@ void set_param(Proxy& proxy, Proxy::ParamId const param_id, double const ratio)
 
 TEST(can_look_up_param_id_by_name, {
     Proxy proxy;
-    double avg_collisions;
-    double avg_bucket_size;
-    unsigned int max_collisions;
-
-    proxy.get_param_id_hash_table_statistics(
-        max_collisions, avg_collisions, avg_bucket_size
-    );
-
-    assert_lte((int)max_collisions, 2);
-    assert_lte(avg_bucket_size, 1.3);
-    assert_lte(avg_collisions, 2.1);
 
     assert_eq(Proxy::ParamId::INVALID_PARAM_ID, proxy.get_param_id(""));
     assert_eq(Proxy::ParamId::INVALID_PARAM_ID, proxy.get_param_id(" \n"));
     assert_eq(Proxy::ParamId::INVALID_PARAM_ID, proxy.get_param_id("NO_SUCH_PARAM"));
+    assert_eq(Proxy::ParamId::INVALID_PARAM_ID, proxy.get_param_id("Z1R1"));
+    assert_eq(Proxy::ParamId::INVALID_PARAM_ID, proxy.get_param_id("Z1R1INX"));
+    assert_eq(Proxy::ParamId::INVALID_PARAM_ID, proxy.get_param_id("z1r1in"));
+    assert_eq(
+        Proxy::ParamId::INVALID_PARAM_ID,
+        proxy.get_param_id(std::string("Z1R1IN\x00\x01", 8))
+    );
 
     for (int i = 0; i != Proxy::ParamId::PARAM_ID_COUNT; ++i) {
         std::string const name = proxy.get_param_name((Proxy::ParamId)i);
@@ -109,6 +105,16 @@ TEST(can_look_up_param_id_by_name, {
 })
 
 
+TEST(params_are_compact, {
+    /*
+    Rules are scanned for every controller event, so their parameters should
+    not carry anything which is not needed for processing events.
+    */
+    assert_lte((int)sizeof(Proxy::Param), 32);
+    assert_lte((int)sizeof(Proxy::Rule), 13 * 32 + 8);
+})
+
+
 void assert_message_dirtiness(
         Proxy& proxy,
         Proxy::MessageType const message_type,
@@ -190,6 +196,52 @@ TEST(can_process_messages_synchronously, {
 })
 
 
+TEST(param_snapshot_replaces_all_params_in_the_order_of_messages, {
+    Proxy proxy;
+    Proxy::ParamSnapshot snapshot;
+
+    for (int i = 0; i != Proxy::ParamId::PARAM_ID_COUNT; ++i) {
+        snapshot.ratios[i] = proxy.get_param_default_ratio((Proxy::ParamId)i);
+    }
+
+    snapshot.ratios[Proxy::ParamId::Z1ANC] = 0.123;
+
+    proxy.push_message(SET_PARAM, Proxy::ParamId::Z1CHN, 0.5);
+    proxy.push_param_snapshot(snapshot);
+    proxy.push_message(SET_PARAM, Proxy::ParamId::Z1R1IN, 0.5);
+    proxy.push_message(SET_PARAM, Proxy::ParamId::Z1R2IN, 0.5);
+
+    snapshot.ratios[Proxy::ParamId::Z1R2IN] = 0.25;
+    proxy.push_param_snapshot(snapshot);
+
+    proxy.begin_processing();
+
+    assert_true(proxy.is_dirty());
+    assert_eq(
+        0.123, proxy.get_param_ratio_atomic(Proxy::ParamId::Z1ANC), 0.000001
+    );
+    assert_eq(
+        proxy.get_param_default_ratio(Proxy::ParamId::Z1CHN),
+        proxy.get_param_ratio_atomic(Proxy::ParamId::Z1CHN),
+        0.000001
+    );
+    assert_eq(
+        proxy.get_param_default_ratio(Proxy::ParamId::Z1R1IN),
+        proxy.get_param_ratio_atomic(Proxy::ParamId::Z1R1IN),
+        0.000001
+    );
+    assert_eq(
+        0.25, proxy.get_param_ratio_atomic(Proxy::ParamId::Z1R2IN), 0.000001
+    );
+
+    proxy.push_param_snapshot(snapshot);
+    proxy.push_message(CLEAR_DIRTY_FLAG, Proxy::ParamId::INVALID_PARAM_ID, 0.0);
+    proxy.begin_processing();
+
+    assert_false(proxy.is_dirty());
+})
+
+
 void turn_off_reset_for_all_rules(Proxy& proxy)
 {
     for (size_t i = 0; i != Proxy::RULES; ++i) {
@@ -198,6 +250,81 @@ void turn_off_reset_for_all_rules(Proxy& proxy)
 }
 
 
+TEST(changed_params_are_collected_until_the_next_collection, {
+    Proxy proxy;
+    Proxy::ChangedParams changed_params;
+
+    proxy.collect_changed_params(changed_params);
+    assert_true(changed_params.is_empty());
+
+    set_param(proxy, Proxy::ParamId::Z1ANC, 0.123);
+    set_param(proxy, Proxy::ParamId::Z1R3IN, 0.5);
+    set_param(
+        proxy,
+        Proxy::ParamId::Z1R9FB,
+        proxy.get_param_default_ratio(Proxy::ParamId::Z1R9FB)
+    );
+    proxy.process_messages();
+
+    proxy.collect_changed_params(changed_params);
+    assert_false(changed_params.is_empty());
+
+    for (int i = 0; i != Proxy::ParamId::PARAM_ID_COUNT; ++i) {
+        Proxy::ParamId const param_id = (Proxy::ParamId)i;
+
+        assert_eq(
+            param_id == Proxy::ParamId::Z1ANC || param_id == Proxy::ParamId::Z1R3IN,
+            changed_params.contains(param_id),
+            "param_id=%d",
+            i
+        );
+    }
+
+    changed_params.clear();
+    proxy.collect_changed_params(changed_params);
+    assert_true(changed_params.is_empty());
+
+    proxy.rules[1].in_cc.set_value(Proxy::ControllerId::MIDI_LEARN);
+    proxy.control_change(0.0, 0, Proxy::ControllerId::VOLUME, 64);
+    proxy.collect_changed_params(changed_params);
+    assert_true(changed_params.contains(Proxy::ParamId::Z1R2IN));
+    assert_false(changed_params.contains(Proxy::ParamId::Z1R1IN));
+})
+
+
+
+TEST(each_changed_params_reader_collects_changes_independently, {
+    Proxy proxy;
+    Proxy::ChangedParams changed_params_gui;
+    Proxy::ChangedParams changed_params_host;
+
+    set_param(proxy, Proxy::ParamId::Z1ANC, 0.123);
+    proxy.process_messages();
+
+    proxy.collect_changed_params(changed_params_gui);
+    assert_true(changed_params_gui.contains(Proxy::ParamId::Z1ANC));
+
+    set_param(proxy, Proxy::ParamId::Z1R3IN, 0.5);
+    proxy.process_messages();
+
+    proxy.collect_changed_params(
+        changed_params_host, Proxy::ChangedParamsReader::CPR_HOST
+    );
+    assert_true(changed_params_host.contains(Proxy::ParamId::Z1ANC));
+    assert_true(changed_params_host.contains(Proxy::ParamId::Z1R3IN));
+
+    changed_params_gui.clear();
+    proxy.collect_changed_params(changed_params_gui);
+    assert_false(changed_params_gui.contains(Proxy::ParamId::Z1ANC));
+    assert_true(changed_params_gui.contains(Proxy::ParamId::Z1R3IN));
+
+    changed_params_host.clear();
+    proxy.collect_changed_params(
+        changed_params_host, Proxy::ChangedParamsReader::CPR_HOST
+    );
+    assert_true(changed_params_host.is_empty());
+})
+
 TEST(when_sending_mcm_is_turned_off_then_does_not_send_mcm_on_reset, {
     Proxy proxy;
 
@@ -251,9 +378,9 @@ TEST(when_proxy_is_resumed_then_previous_notes_are_turned_off, {
 
     assert_out_events<3>(
         {
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=1 d1=0x40 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=NOTE_OFF ch=1 d1=0x3c d2=0x40 (v=0.504)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=1 d1=0x40 d2=0x00 (v=0.000)",
+            "t=0 cmd=NOTE_OFF ch=1 d1=0x3c d2=0x40 (v=0.504)",
         },
         proxy
     );
@@ -275,12 +402,12 @@ TEST(when_sending_mcm_is_turned_on_then_sends_mcm_on_reset, {
 
     assert_out_events<6>(
         {
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x65 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x64 d2=0x06 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x06 d2=0x0a (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x65 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x64 d2=0x06 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x06 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x65 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x64 d2=0x06 (v=0.047)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x06 d2=0x0a (v=0.079)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x65 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x64 d2=0x06 (v=0.047)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x06 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -306,12 +433,12 @@ TEST(resetting_clears_out_events, {
 
     assert_out_events<6>(
         {
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x65 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x64 d2=0x06 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x06 d2=0x0a (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x65 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x64 d2=0x06 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x06 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x65 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x64 d2=0x06 (v=0.047)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x06 d2=0x0a (v=0.079)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x65 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x64 d2=0x06 (v=0.047)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x06 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -336,15 +463,15 @@ TEST(when_settings_are_changed_then_processing_triggers_reset, {
 
     assert_out_events<9>(
         {
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=1 d1=0x40 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=NOTE_OFF ch=1 d1=0x3c d2=0x40 (v=0.504)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x65 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x64 d2=0x06 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x06 d2=0x0a (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x65 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x64 d2=0x06 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x06 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=1 d1=0x40 d2=0x00 (v=0.000)",
+            "t=0 cmd=NOTE_OFF ch=1 d1=0x3c d2=0x40 (v=0.504)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x65 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x64 d2=0x06 (v=0.047)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x06 d2=0x0a (v=0.079)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x65 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x64 d2=0x06 (v=0.047)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x06 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -405,12 +532,12 @@ TEST(when_sending_mcm_is_turned_on_then_sends_mcm_on_config_change, {
 
     assert_out_events<6>(
         {
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x65 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x64 d2=0x06 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=15 d1=0x06 d2=0x0a (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x65 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x64 d2=0x06 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x06 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x65 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x64 d2=0x06 (v=0.047)",
+            "t=0 cmd=CONTROL_CHANGE ch=15 d1=0x06 d2=0x0a (v=0.079)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x65 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x64 d2=0x06 (v=0.047)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x06 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -431,9 +558,9 @@ TEST(when_a_cc_does_not_match_any_rule_then_it_is_sent_unmodified_via_the_manage
 
     assert_out_events<3>(
         {
-            "t=1.000 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x6e (v=0.866)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x10 d2=0x4e (v=0.610)",
-            "t=3.000 cmd=CHANNEL_PRESSURE ch=0 d1=0x1e d2=0x00 (v=0.236)",
+            "t=1 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x6e (v=0.866)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=0 d1=0x10 d2=0x4e (v=0.610)",
+            "t=3 cmd=CHANNEL_PRESSURE ch=0 d1=0x1e d2=0x00 (v=0.236)",
         },
         proxy
     );
@@ -462,9 +589,9 @@ TEST(when_the_target_of_a_cc_is_global_then_it_is_sent_via_the_manager_channel,
 
     assert_out_events<3>(
         {
-            "t=1.000 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x6e (v=0.866)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x10 d2=0x4e (v=0.610)",
-            "t=3.000 cmd=CHANNEL_PRESSURE ch=0 d1=0x1e d2=0x00 (v=0.236)",
+            "t=1 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x6e (v=0.866)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=0 d1=0x10 d2=0x4e (v=0.610)",
+            "t=3 cmd=CHANNEL_PRESSURE ch=0 d1=0x1e d2=0x00 (v=0.236)",
         },
         proxy
     );
@@ -521,9 +648,119 @@ TEST(repeated_cc_events_are_sent_only_once_on_the_manager_channel, {
     proxy.control_change(1.0, 7, Proxy::ControllerId::VOLUME, 110);
 
     assert_out_events<1>(
-        {"t=1.000 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x6e (v=0.866)"},
+        {"t=1 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x6e (v=0.866)"},
+        proxy
+    );
+})
+
+
+TEST(cloned_input_events_are_processed_only_once_even_when_interleaved, {
+    Proxy proxy;
+
+    turn_off_reset_for_all_rules(proxy);
+
+    for (size_t i = 0; i != Proxy::RULES; ++i) {
+        proxy.rules[i].in_cc.set_value(Proxy::ControllerId::NONE);
+    }
+
+    proxy.zone_type.set_value(Proxy::ZoneType::ZT_UPPER);
+    proxy.begin_processing();
+
+    for (Midi::Channel channel = 0; channel != Midi::CHANNELS; ++channel) {
+        proxy.note_on(1.0, channel, 60, 96);
+        proxy.channel_pressure(1.0, channel, 100);
+        proxy.control_change(1.0, channel, Proxy::ControllerId::VOLUME, 110);
+        proxy.pitch_wheel_change(1.0, channel, 10000);
+    }
+
+    for (Midi::Channel channel = 0; channel != Midi::CHANNELS; ++channel) {
+        proxy.note_off(2.0, channel, 60, 64);
+    }
+
+    assert_out_events<5>(
+        {
+            "t=1 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=15 d1=0x64 d2=0x00 (v=0.787)",
+            "t=1 cmd=CONTROL_CHANGE ch=15 d1=0x07 d2=0x6e (v=0.866)",
+            "t=1 cmd=PITCH_BEND_CHANGE ch=15 d1=0x10 d2=0x4e (v=0.610)",
+            "t=2 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
+        },
+        proxy
+    );
+    assert_eq(15 * 5, (int)proxy.get_suppressed_duplicates_count());
+})
+
+
+TEST(cloned_events_are_recognized_within_the_configured_time_window, {
+    Proxy proxy;
+
+    for (size_t i = 0; i != Proxy::RULES; ++i) {
+        proxy.rules[i].in_cc.set_value(Proxy::ControllerId::NONE);
+    }
+
+    proxy.push_message(
+        Proxy::MessageType::SET_DUPLICATE_FILTER_WINDOW,
+        Proxy::ParamId::INVALID_PARAM_ID,
+        2.0
+    );
+    proxy.begin_processing();
+    proxy.control_change(1.0, 0, Proxy::ControllerId::VOLUME, 110);
+    proxy.control_change(2.5, 1, Proxy::ControllerId::VOLUME, 110);
+    proxy.control_change(3.0, 2, Proxy::ControllerId::VOLUME, 110);
+    proxy.control_change(6.0, 3, Proxy::ControllerId::VOLUME, 110);
+
+    assert_out_events<2>(
+        {
+            "t=1 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x6e (v=0.866)",
+            "t=6 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x6e (v=0.866)",
+        },
+        proxy
+    );
+    assert_eq(2, (int)proxy.get_suppressed_duplicates_count());
+})
+
+
+TEST(duplicate_suppression_does_not_span_multiple_blocks, {
+    Proxy proxy;
+
+    for (size_t i = 0; i != Proxy::RULES; ++i) {
+        proxy.rules[i].in_cc.set_value(Proxy::ControllerId::NONE);
+    }
+
+    proxy.begin_processing();
+    proxy.control_change(1.0, 5, Proxy::ControllerId::VOLUME, 110);
+    proxy.begin_processing();
+    proxy.control_change(1.0, 5, Proxy::ControllerId::VOLUME, 110);
+
+    assert_out_events<1>(
+        {"t=1 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x6e (v=0.866)"},
+        proxy
+    );
+    assert_eq(0, (int)proxy.get_suppressed_duplicates_count());
+})
+
+
+TEST(a_note_may_be_retriggered_at_the_same_time_offset, {
+    Proxy proxy;
+
+    turn_off_reset_for_all_rules(proxy);
+
+    proxy.zone_type.set_value(Proxy::ZoneType::ZT_UPPER);
+    proxy.begin_processing();
+
+    proxy.note_on(1.0, 1, 60, 96);
+    proxy.note_off(1.0, 1, 60, 64);
+    proxy.note_on(1.0, 1, 60, 96);
+
+    assert_out_events<3>(
+        {
+            "t=1 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=1 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
+            "t=1 cmd=NOTE_ON ch=13 d1=0x3c d2=0x60 (v=0.756)",
+        },
         proxy
     );
+    assert_eq(0, (int)proxy.get_suppressed_duplicates_count());
 })
 
 
@@ -542,9 +779,9 @@ TEST(allocates_new_channel_for_each_note, {
 
     assert_out_events<3>(
         {
-            "t=1.000 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
-            "t=2.000 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
-            "t=3.000 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
+            "t=1 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=2 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
+            "t=3 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
         },
         proxy
     );
@@ -569,9 +806,9 @@ TEST(can_ignore_new_notes_when_running_out_of_available_channels, {
 
     assert_out_events<3>(
         {
-            "t=1.000 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
-            "t=2.000 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
-            "t=3.000 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
+            "t=1 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=2 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
+            "t=3 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
         },
         proxy
     );
@@ -595,9 +832,9 @@ TEST(when_excess_notes_are_to_be_ignored_then_ignores_repeated_note_on, {
 
     assert_out_events<3>(
         {
-            "t=1.000 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
-            "t=2.000 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
-            "t=3.000 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
+            "t=1 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=2 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
+            "t=3 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
         },
         proxy
     );
@@ -624,13 +861,13 @@ TEST(can_steal_channel_when_running_out_of_available_channels, {
 
     assert_out_events<7>(
         {
-            "t=1.000 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
-            "t=2.000 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
-            "t=3.000 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
-            "t=4.000 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
-            "t=4.000 cmd=NOTE_ON ch=14 d1=0x60 d2=0x73 (v=0.906)",
-            "t=5.000 cmd=NOTE_OFF ch=13 d1=0x48 d2=0x40 (v=0.504)",
-            "t=5.000 cmd=NOTE_ON ch=13 d1=0x62 d2=0x78 (v=0.945)",
+            "t=1 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=2 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
+            "t=3 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
+            "t=4 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
+            "t=4 cmd=NOTE_ON ch=14 d1=0x60 d2=0x73 (v=0.906)",
+            "t=5 cmd=NOTE_OFF ch=13 d1=0x48 d2=0x40 (v=0.504)",
+            "t=5 cmd=NOTE_ON ch=13 d1=0x62 d2=0x78 (v=0.945)",
         },
         proxy
     );
@@ -654,13 +891,13 @@ TEST(when_excess_notes_are_to_steal_channels_then_repeated_note_on_replaces_exis
 
     assert_out_events<7>(
         {
-            "t=1.000 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
-            "t=2.000 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
-            "t=3.000 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
-            "t=4.000 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
-            "t=4.000 cmd=NOTE_ON ch=14 d1=0x3c d2=0x7f (v=1.000)",
-            "t=5.000 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
-            "t=5.000 cmd=NOTE_ON ch=14 d1=0x3c d2=0x6e (v=0.866)",
+            "t=1 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=2 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
+            "t=3 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
+            "t=4 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
+            "t=4 cmd=NOTE_ON ch=14 d1=0x3c d2=0x7f (v=1.000)",
+            "t=5 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
+            "t=5 cmd=NOTE_ON ch=14 d1=0x3c d2=0x6e (v=0.866)",
         },
         proxy
     );
@@ -720,9 +957,9 @@ void test_global_cc_reset(Proxy::Reset const reset)
 
     assert_out_events<3>(
         {
-            "t=0.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x40 (v=0.500)",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=0 d1=0x19 d2=0x00 (v=0.200)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x26 (v=0.300)",
+            "t=0 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x40 (v=0.500)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=0 d1=0x19 d2=0x00 (v=0.197)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x26 (v=0.299)",
         },
         proxy
     );
@@ -774,35 +1011,30 @@ TEST(when_reset_is_set_to_init_value_for_a_non_global_cc_event_then_its_initial_
     proxy.note_on(2.0, 2, 72, 111);
     proxy.note_on(3.0, 2, 84, 127);
 
-    assert_out_events<27>(
-        {
-            "t=1.000 cmd=PITCH_BEND_CHANGE ch=14 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=14 d1=0x19 d2=0x00 (v=0.200) pre-NOTE_ON setup",
-            "t=1.000 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x40 (v=0.500) pre-NOTE_ON setup",
-            "t=1.000 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
-            "t=1.000 cmd=PITCH_BEND_CHANGE ch=14 d1=0x00 d2=0x40 (v=0.500)",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=14 d1=0x19 d2=0x00 (v=0.200)",
-            "t=1.000 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x40 (v=0.500)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=14 d1=0x00 d2=0x40 (v=0.500)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=13 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
-            "t=2.000 cmd=CHANNEL_PRESSURE ch=14 d1=0x19 d2=0x00 (v=0.200)",
-            "t=2.000 cmd=CHANNEL_PRESSURE ch=13 d1=0x19 d2=0x00 (v=0.200) pre-NOTE_ON setup",
-            "t=2.000 cmd=CONTROL_CHANGE ch=13 d1=0x4a d2=0x40 (v=0.500) pre-NOTE_ON setup",
-            "t=2.000 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=13 d1=0x00 d2=0x40 (v=0.500)",
-            "t=2.000 cmd=CHANNEL_PRESSURE ch=13 d1=0x19 d2=0x00 (v=0.200)",
-            "t=2.000 cmd=CONTROL_CHANGE ch=13 d1=0x4a d2=0x40 (v=0.500)",
-            "t=3.000 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=13 d1=0x4a d2=0x40 (v=0.500)",
-            "t=3.000 cmd=PITCH_BEND_CHANGE ch=13 d1=0x00 d2=0x40 (v=0.500)",
-            "t=3.000 cmd=PITCH_BEND_CHANGE ch=14 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
-            "t=3.000 cmd=CHANNEL_PRESSURE ch=13 d1=0x19 d2=0x00 (v=0.200)",
-            "t=3.000 cmd=CHANNEL_PRESSURE ch=14 d1=0x19 d2=0x00 (v=0.200) pre-NOTE_ON setup",
-            "t=3.000 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x40 (v=0.500) pre-NOTE_ON setup",
-            "t=3.000 cmd=NOTE_ON ch=14 d1=0x54 d2=0x7f (v=1.000)",
-            "t=3.000 cmd=PITCH_BEND_CHANGE ch=14 d1=0x00 d2=0x40 (v=0.500)",
-            "t=3.000 cmd=CHANNEL_PRESSURE ch=14 d1=0x19 d2=0x00 (v=0.200)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x40 (v=0.500)",
+    assert_out_events<22>(
+        {
+            "t=1 cmd=PITCH_BEND_CHANGE ch=14 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
+            "t=1 cmd=CHANNEL_PRESSURE ch=14 d1=0x19 d2=0x00 (v=0.197) pre-NOTE_ON setup",
+            "t=1 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x40 (v=0.504) pre-NOTE_ON setup",
+            "t=1 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=1 cmd=PITCH_BEND_CHANGE ch=14 d1=0x00 d2=0x40 (v=0.500)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=14 d1=0x19 d2=0x00 (v=0.197)",
+            "t=1 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x40 (v=0.504)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=13 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
+            "t=2 cmd=CHANNEL_PRESSURE ch=13 d1=0x19 d2=0x00 (v=0.197) pre-NOTE_ON setup",
+            "t=2 cmd=CONTROL_CHANGE ch=13 d1=0x4a d2=0x40 (v=0.504) pre-NOTE_ON setup",
+            "t=2 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=13 d1=0x00 d2=0x40 (v=0.500)",
+            "t=2 cmd=CHANNEL_PRESSURE ch=13 d1=0x19 d2=0x00 (v=0.197)",
+            "t=2 cmd=CONTROL_CHANGE ch=13 d1=0x4a d2=0x40 (v=0.504)",
+            "t=3 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
+            "t=3 cmd=PITCH_BEND_CHANGE ch=14 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
+            "t=3 cmd=CHANNEL_PRESSURE ch=14 d1=0x19 d2=0x00 (v=0.197) pre-NOTE_ON setup",
+            "t=3 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x40 (v=0.504) pre-NOTE_ON setup",
+            "t=3 cmd=NOTE_ON ch=14 d1=0x54 d2=0x7f (v=1.000)",
+            "t=3 cmd=PITCH_BEND_CHANGE ch=14 d1=0x00 d2=0x40 (v=0.500)",
+            "t=3 cmd=CHANNEL_PRESSURE ch=14 d1=0x19 d2=0x00 (v=0.197)",
+            "t=3 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x40 (v=0.504)",
         },
         proxy
     );
@@ -848,35 +1080,30 @@ TEST(when_reset_is_set_to_last_value_for_a_non_global_cc_event_then_its_last_val
     proxy.note_on(2.0, 2, 72, 111);
     proxy.note_on(3.0, 2, 84, 127);
 
-    assert_out_events<27>(
-        {
-            "t=1.000 cmd=PITCH_BEND_CHANGE ch=14 d1=0x7f d2=0x7f (v=1.000) pre-NOTE_ON setup",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=14 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
-            "t=1.000 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x7f (v=1.000) pre-NOTE_ON setup",
-            "t=1.000 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
-            "t=1.000 cmd=PITCH_BEND_CHANGE ch=14 d1=0x7f d2=0x7f (v=1.000)",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=14 d1=0x7f d2=0x00 (v=1.000)",
-            "t=1.000 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x7f (v=1.000)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=14 d1=0x7f d2=0x7f (v=1.000)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=13 d1=0x7f d2=0x7f (v=1.000) pre-NOTE_ON setup",
-            "t=2.000 cmd=CHANNEL_PRESSURE ch=14 d1=0x7f d2=0x00 (v=1.000)",
-            "t=2.000 cmd=CHANNEL_PRESSURE ch=13 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
-            "t=2.000 cmd=CONTROL_CHANGE ch=13 d1=0x4a d2=0x7f (v=1.000) pre-NOTE_ON setup",
-            "t=2.000 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=13 d1=0x7f d2=0x7f (v=1.000)",
-            "t=2.000 cmd=CHANNEL_PRESSURE ch=13 d1=0x7f d2=0x00 (v=1.000)",
-            "t=2.000 cmd=CONTROL_CHANGE ch=13 d1=0x4a d2=0x7f (v=1.000)",
-            "t=3.000 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=13 d1=0x4a d2=0x7f (v=1.000)",
-            "t=3.000 cmd=PITCH_BEND_CHANGE ch=13 d1=0x7f d2=0x7f (v=1.000)",
-            "t=3.000 cmd=PITCH_BEND_CHANGE ch=14 d1=0x7f d2=0x7f (v=1.000) pre-NOTE_ON setup",
-            "t=3.000 cmd=CHANNEL_PRESSURE ch=13 d1=0x7f d2=0x00 (v=1.000)",
-            "t=3.000 cmd=CHANNEL_PRESSURE ch=14 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
-            "t=3.000 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x7f (v=1.000) pre-NOTE_ON setup",
-            "t=3.000 cmd=NOTE_ON ch=14 d1=0x54 d2=0x7f (v=1.000)",
-            "t=3.000 cmd=PITCH_BEND_CHANGE ch=14 d1=0x7f d2=0x7f (v=1.000)",
-            "t=3.000 cmd=CHANNEL_PRESSURE ch=14 d1=0x7f d2=0x00 (v=1.000)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x7f (v=1.000)",
+    assert_out_events<22>(
+        {
+            "t=1 cmd=PITCH_BEND_CHANGE ch=14 d1=0x7f d2=0x7f (v=1.000) pre-NOTE_ON setup",
+            "t=1 cmd=CHANNEL_PRESSURE ch=14 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
+            "t=1 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x7f (v=1.000) pre-NOTE_ON setup",
+            "t=1 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=1 cmd=PITCH_BEND_CHANGE ch=14 d1=0x7f d2=0x7f (v=1.000)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=14 d1=0x7f d2=0x00 (v=1.000)",
+            "t=1 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x7f (v=1.000)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=13 d1=0x7f d2=0x7f (v=1.000) pre-NOTE_ON setup",
+            "t=2 cmd=CHANNEL_PRESSURE ch=13 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
+            "t=2 cmd=CONTROL_CHANGE ch=13 d1=0x4a d2=0x7f (v=1.000) pre-NOTE_ON setup",
+            "t=2 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=13 d1=0x7f d2=0x7f (v=1.000)",
+            "t=2 cmd=CHANNEL_PRESSURE ch=13 d1=0x7f d2=0x00 (v=1.000)",
+            "t=2 cmd=CONTROL_CHANGE ch=13 d1=0x4a d2=0x7f (v=1.000)",
+            "t=3 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x40 (v=0.504)",
+            "t=3 cmd=PITCH_BEND_CHANGE ch=14 d1=0x7f d2=0x7f (v=1.000) pre-NOTE_ON setup",
+            "t=3 cmd=CHANNEL_PRESSURE ch=14 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
+            "t=3 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x7f (v=1.000) pre-NOTE_ON setup",
+            "t=3 cmd=NOTE_ON ch=14 d1=0x54 d2=0x7f (v=1.000)",
+            "t=3 cmd=PITCH_BEND_CHANGE ch=14 d1=0x7f d2=0x7f (v=1.000)",
+            "t=3 cmd=CHANNEL_PRESSURE ch=14 d1=0x7f d2=0x00 (v=1.000)",
+            "t=3 cmd=CONTROL_CHANGE ch=14 d1=0x4a d2=0x7f (v=1.000)",
         },
         proxy
     );
@@ -907,12 +1134,12 @@ TEST(excess_note_off_events_are_ignored, {
 
     assert_out_events<6>(
         {
-            "t=1.000 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
-            "t=2.000 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
-            "t=3.000 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
-            "t=6.000 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x60 (v=0.756)",
-            "t=7.000 cmd=NOTE_OFF ch=13 d1=0x48 d2=0x6f (v=0.874)",
-            "t=8.000 cmd=NOTE_OFF ch=12 d1=0x54 d2=0x7f (v=1.000)",
+            "t=1 cmd=NOTE_ON ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=2 cmd=NOTE_ON ch=13 d1=0x48 d2=0x6f (v=0.874)",
+            "t=3 cmd=NOTE_ON ch=12 d1=0x54 d2=0x7f (v=1.000)",
+            "t=6 cmd=NOTE_OFF ch=14 d1=0x3c d2=0x60 (v=0.756)",
+            "t=7 cmd=NOTE_OFF ch=13 d1=0x48 d2=0x6f (v=0.874)",
+            "t=8 cmd=NOTE_OFF ch=12 d1=0x54 d2=0x7f (v=1.000)",
         },
         proxy
     );
@@ -939,9 +1166,9 @@ TEST(note_off_velocity_can_be_overridden_with_note_on_velocity, {
 
     assert_out_events<3>(
         {
-            "t=1.000 cmd=NOTE_OFF ch=1 d1=0x3c d2=0x10 (v=0.126)",
-            "t=1.000 cmd=NOTE_ON ch=1 d1=0x3e d2=0x20 (v=0.252)",
-            "t=2.000 cmd=NOTE_OFF ch=1 d1=0x3e d2=0x20 (v=0.252)",
+            "t=1 cmd=NOTE_OFF ch=1 d1=0x3c d2=0x10 (v=0.126)",
+            "t=1 cmd=NOTE_ON ch=1 d1=0x3e d2=0x20 (v=0.252)",
+            "t=2 cmd=NOTE_OFF ch=1 d1=0x3e d2=0x20 (v=0.252)",
         },
         proxy
     );
@@ -965,7 +1192,7 @@ TEST(when_a_note_is_released_then_its_channel_can_be_allocated_for_new_notes, {
     proxy.note_on(3.0, 0, 63, 96);
 
     assert_out_events<1>(
-        {"t=3.000 cmd=NOTE_ON ch=2 d1=0x3f d2=0x60 (v=0.756)"},
+        {"t=3 cmd=NOTE_ON ch=2 d1=0x3f d2=0x60 (v=0.756)"},
         proxy
     );
 })
@@ -1003,10 +1230,10 @@ TEST(when_the_target_of_a_cc_is_not_global_then_it_is_sent_only_on_the_channel_o
 
     assert_out_events<4>(
         {
-            "t=1.000 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x6e (v=0.866)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=2 d1=0x10 d2=0x4e (v=0.610)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=3 d1=0x07 d2=0x60 (v=0.756)",
-            "t=4.000 cmd=CHANNEL_PRESSURE ch=4 d1=0x1e d2=0x00 (v=0.236)",
+            "t=1 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x6e (v=0.866)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=2 d1=0x10 d2=0x4e (v=0.610)",
+            "t=3 cmd=CONTROL_CHANGE ch=3 d1=0x07 d2=0x60 (v=0.756)",
+            "t=4 cmd=CHANNEL_PRESSURE ch=4 d1=0x1e d2=0x00 (v=0.236)",
         },
         proxy
     );
@@ -1038,9 +1265,9 @@ TEST(multiple_rules_can_share_the_same_controller_as_input, {
 
     assert_out_events<3>(
         {
-            "t=1.000 cmd=PITCH_BEND_CHANGE ch=1 d1=0x7f d2=0x7f (v=1.000)",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=0 d1=0x7f d2=0x00 (v=1.000)",
-            "t=1.000 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x7f (v=1.000)",
+            "t=1 cmd=PITCH_BEND_CHANGE ch=1 d1=0x7f d2=0x7f (v=1.000)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=0 d1=0x7f d2=0x00 (v=1.000)",
+            "t=1 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x7f (v=1.000)",
         },
         proxy
     );
@@ -1084,10 +1311,10 @@ TEST(target_of_a_cc_may_be_below_the_anchor, {
 
     assert_out_events<4>(
         {
-            "t=1.000 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x6e (v=0.866)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=2 d1=0x10 d2=0x4e (v=0.610)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=3 d1=0x07 d2=0x60 (v=0.756)",
-            "t=4.000 cmd=CHANNEL_PRESSURE ch=4 d1=0x1e d2=0x00 (v=0.236)",
+            "t=1 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x6e (v=0.866)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=2 d1=0x10 d2=0x4e (v=0.610)",
+            "t=3 cmd=CONTROL_CHANGE ch=3 d1=0x07 d2=0x60 (v=0.756)",
+            "t=4 cmd=CHANNEL_PRESSURE ch=4 d1=0x1e d2=0x00 (v=0.236)",
         },
         proxy
     );
@@ -1131,10 +1358,10 @@ TEST(target_of_a_cc_may_be_above_the_anchor, {
 
     assert_out_events<4>(
         {
-            "t=1.000 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x6e (v=0.866)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=2 d1=0x10 d2=0x4e (v=0.610)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=3 d1=0x07 d2=0x60 (v=0.756)",
-            "t=4.000 cmd=CHANNEL_PRESSURE ch=4 d1=0x1e d2=0x00 (v=0.236)",
+            "t=1 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x6e (v=0.866)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=2 d1=0x10 d2=0x4e (v=0.610)",
+            "t=3 cmd=CONTROL_CHANGE ch=3 d1=0x07 d2=0x60 (v=0.756)",
+            "t=4 cmd=CHANNEL_PRESSURE ch=4 d1=0x1e d2=0x00 (v=0.236)",
         },
         proxy
     );
@@ -1255,20 +1482,20 @@ TEST(when_reset_is_set_to_init_value_and_cc_target_changes_then_cc_is_reset_for_
 
     assert_out_events<7>(
         {
-            "t=0.000 cmd=PITCH_BEND_CHANGE ch=3 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x19 d2=0x00 (v=0.200)",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=3 d1=0x19 d2=0x00 (v=0.200) pre-NOTE_ON setup",
-            "t=0.000 cmd=NOTE_ON ch=3 d1=0x48 d2=0x7f (v=1.000)",
-            "t=0.000 cmd=PITCH_BEND_CHANGE ch=3 d1=0x00 d2=0x40 (v=0.500)",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=3 d1=0x19 d2=0x00 (v=0.200)",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000)",
+            "t=0 cmd=PITCH_BEND_CHANGE ch=3 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
+            "t=0 cmd=CHANNEL_PRESSURE ch=2 d1=0x19 d2=0x00 (v=0.197)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=3 d1=0x19 d2=0x00 (v=0.197) pre-NOTE_ON setup",
+            "t=0 cmd=NOTE_ON ch=3 d1=0x48 d2=0x7f (v=1.000)",
+            "t=0 cmd=PITCH_BEND_CHANGE ch=3 d1=0x00 d2=0x40 (v=0.500)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=3 d1=0x19 d2=0x00 (v=0.197)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000)",
         },
         proxy
     );
 })
 
 
-TEST(when_reset_is_set_to_last_value_and_cc_target_changes_then_cc_is_reset_for_previous_note, {
+TEST(when_reset_is_set_to_last_value_and_cc_target_changes_then_previous_note_is_not_reset_to_the_value_that_it_already_has, {
     Proxy proxy;
 
     turn_off_reset_for_all_rules(proxy);
@@ -1294,15 +1521,58 @@ TEST(when_reset_is_set_to_last_value_and_cc_target_changes_then_cc_is_reset_for_
     proxy.note_on(0.0, 0, 72, 127);     /* channel=3, newest */
     proxy.channel_pressure(1.0, 0, 96);
 
-    assert_out_events<7>(
+    assert_out_events<6>(
+        {
+            "t=0 cmd=PITCH_BEND_CHANGE ch=3 d1=0x7f d2=0x7f (v=1.000) pre-NOTE_ON setup",
+            "t=0 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
+            "t=0 cmd=NOTE_ON ch=3 d1=0x48 d2=0x7f (v=1.000)",
+            "t=0 cmd=PITCH_BEND_CHANGE ch=3 d1=0x7f d2=0x7f (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=3 d1=0x60 d2=0x00 (v=0.756)",
+        },
+        proxy
+    );
+})
+
+
+TEST(when_a_channel_already_has_the_reset_value_then_it_is_not_reset_again_in_later_blocks, {
+    Proxy proxy;
+
+    turn_off_reset_for_all_rules(proxy);
+
+    proxy.rules[0].in_cc.set_value(Proxy::ControllerId::CHANNEL_PRESSURE);
+    proxy.rules[0].out_cc.set_value(Proxy::ControllerId::CHANNEL_PRESSURE);
+    proxy.rules[0].target.set_value(Proxy::Target::TRG_NEWEST);
+    proxy.rules[0].init_value.set_ratio(0.2);
+    proxy.rules[0].reset.set_value(Proxy::Reset::RST_INIT);
+
+    proxy.begin_processing();
+    proxy.note_on(0.0, 0, 48, 127);     /* channel=1 */
+    proxy.channel_pressure(1.0, 0, 127);
+
+    proxy.begin_processing();
+    proxy.note_on(0.0, 0, 60, 127);     /* channel=2 */
+
+    assert_out_events<4>(
+        {
+            "t=0 cmd=CHANNEL_PRESSURE ch=1 d1=0x19 d2=0x00 (v=0.197)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=2 d1=0x19 d2=0x00 (v=0.197) pre-NOTE_ON setup",
+            "t=0 cmd=NOTE_ON ch=2 d1=0x3c d2=0x7f (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=2 d1=0x19 d2=0x00 (v=0.197)",
+        },
+        proxy
+    );
+
+    proxy.begin_processing();
+    proxy.note_on(0.0, 0, 72, 127);     /* channel=3 */
+    proxy.note_off(1.0, 0, 72, 64);
+
+    assert_out_events<4>(
         {
-            "t=0.000 cmd=PITCH_BEND_CHANGE ch=3 d1=0x7f d2=0x7f (v=1.000) pre-NOTE_ON setup",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x7f d2=0x00 (v=1.000)",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
-            "t=0.000 cmd=NOTE_ON ch=3 d1=0x48 d2=0x7f (v=1.000)",
-            "t=0.000 cmd=PITCH_BEND_CHANGE ch=3 d1=0x7f d2=0x7f (v=1.000)",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000)",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=3 d1=0x60 d2=0x00 (v=0.756)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=3 d1=0x19 d2=0x00 (v=0.197) pre-NOTE_ON setup",
+            "t=0 cmd=NOTE_ON ch=3 d1=0x48 d2=0x7f (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=3 d1=0x19 d2=0x00 (v=0.197)",
+            "t=1 cmd=NOTE_OFF ch=3 d1=0x48 d2=0x40 (v=0.504)",
         },
         proxy
     );
@@ -1328,8 +1598,8 @@ TEST(when_the_in_cc_of_a_rule_is_midi_learn_then_it_is_replaced_with_the_first_c
 
     assert_out_events<2>(
         {
-            "t=0.000 cmd=PITCH_BEND_CHANGE ch=1 d1=0x60 d2=0x60 (v=0.756)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x60 (v=0.756)",
+            "t=0 cmd=PITCH_BEND_CHANGE ch=1 d1=0x60 d2=0x60 (v=0.756)",
+            "t=0 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x60 (v=0.756)",
         },
         proxy
     );
@@ -1362,7 +1632,7 @@ TEST(cc_can_be_inverted, {
     proxy.channel_pressure(0.0, 0, 96);
 
     assert_out_events<1>(
-        {"t=0.000 cmd=CHANNEL_PRESSURE ch=0 d1=0x1f d2=0x00 (v=0.244)"},
+        {"t=0 cmd=CHANNEL_PRESSURE ch=0 d1=0x1f d2=0x00 (v=0.244)"},
         proxy
     );
 })
@@ -1386,7 +1656,7 @@ TEST(cc_can_be_distorted, {
     proxy.channel_pressure(0.0, 0, 10);
 
     assert_out_events<1>(
-        {"t=0.000 cmd=CHANNEL_PRESSURE ch=0 d1=0x00 d2=0x00 (v=0.000)"},
+        {"t=0 cmd=CHANNEL_PRESSURE ch=0 d1=0x00 d2=0x00 (v=0.000)"},
         proxy
     );
 })
@@ -1409,8 +1679,8 @@ TEST(cc_midpoint_can_be_shifted, {
 
     assert_out_events<2>(
         {
-            "t=0.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x30 (v=0.375)",
-            "t=1.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x70 (v=0.875)",
+            "t=0 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x30 (v=0.375)",
+            "t=1 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x70 (v=0.875)",
         },
         proxy
     );
@@ -1452,10 +1722,10 @@ TEST(distortions_are_applied_for_initial_value_on_reset, {
 
     assert_out_events<4>(
         {
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=1 d1=0x00 d2=0x00 (v=0.000)",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x00 d2=0x00 (v=0.000) pre-NOTE_ON setup",
-            "t=1.000 cmd=NOTE_ON ch=2 d1=0x3c d2=0x7f (v=1.000)",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x00 d2=0x00 (v=0.000)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=1 d1=0x00 d2=0x00 (v=0.000)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=2 d1=0x00 d2=0x00 (v=0.000) pre-NOTE_ON setup",
+            "t=1 cmd=NOTE_ON ch=2 d1=0x3c d2=0x7f (v=1.000)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=2 d1=0x00 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -1468,7 +1738,7 @@ TEST(distortions_are_applied_for_initial_value_on_reset, {
     proxy.resume();
 
     assert_out_events<1>(
-        {"t=0.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x00 (v=0.000)"},
+        {"t=0 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x00 (v=0.000)"},
         proxy
     );
 })
@@ -1507,12 +1777,11 @@ TEST(distortions_are_applied_for_last_value_on_reset, {
     proxy.begin_processing();
     proxy.note_on(1.0, 0, 60, 127);     /* channel=2, newest */
 
-    assert_out_events<4>(
+    assert_out_events<3>(
         {
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=1 d1=0x00 d2=0x00 (v=0.000)",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x00 d2=0x00 (v=0.000) pre-NOTE_ON setup",
-            "t=1.000 cmd=NOTE_ON ch=2 d1=0x3c d2=0x7f (v=1.000)",
-            "t=1.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x00 d2=0x00 (v=0.000)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=2 d1=0x00 d2=0x00 (v=0.000) pre-NOTE_ON setup",
+            "t=1 cmd=NOTE_ON ch=2 d1=0x3c d2=0x7f (v=1.000)",
+            "t=1 cmd=CHANNEL_PRESSURE ch=2 d1=0x00 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -1526,7 +1795,7 @@ TEST(distortions_are_applied_for_last_value_on_reset, {
     proxy.resume();
 
     assert_out_events<1>(
-        {"t=0.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x00 (v=0.000)"},
+        {"t=0 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x00 (v=0.000)"},
         proxy
     );
 })
@@ -1559,9 +1828,9 @@ TEST(when_rule_target_is_all_below_anchor_then_new_note_runs_with_latest_ctl_and
 
     assert_out_events<3>(
         {
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=4 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
-            "t=0.000 cmd=NOTE_ON ch=4 d1=0x18 d2=0x7f (v=1.000)",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=4 d1=0x7f d2=0x00 (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=4 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
+            "t=0 cmd=NOTE_ON ch=4 d1=0x18 d2=0x7f (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=4 d1=0x7f d2=0x00 (v=1.000)",
         },
         proxy
     );
@@ -1595,9 +1864,9 @@ TEST(when_rule_target_is_all_above_anchor_then_new_note_runs_with_latest_ctl_and
 
     assert_out_events<3>(
         {
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=4 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
-            "t=0.000 cmd=NOTE_ON ch=4 d1=0x54 d2=0x7f (v=1.000)",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=4 d1=0x7f d2=0x00 (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=4 d1=0x7f d2=0x00 (v=1.000) pre-NOTE_ON setup",
+            "t=0 cmd=NOTE_ON ch=4 d1=0x54 d2=0x7f (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=4 d1=0x7f d2=0x00 (v=1.000)",
         },
         proxy
     );
@@ -1631,8 +1900,8 @@ TEST(when_rule_target_is_all_below_anchor_then_cc_is_sent_to_all_notes_below_anc
 
     assert_out_events<2>(
         {
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000)",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x7f d2=0x00 (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=2 d1=0x7f d2=0x00 (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000)",
         },
         proxy
     );
@@ -1666,11 +1935,53 @@ TEST(when_rule_target_is_all_above_anchor_then_cc_is_sent_to_all_notes_below_anc
 
     assert_out_events<2>(
         {
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000)",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x7f d2=0x00 (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=2 d1=0x7f d2=0x00 (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000)",
+        },
+        proxy
+    );
+})
+
+
+TEST(when_rule_target_is_all_below_anchor_then_released_notes_no_longer_receive_cc, {
+    Proxy proxy;
+
+    proxy.anchor.set_value(60);
+
+    turn_off_reset_for_all_rules(proxy);
+
+    proxy.rules[1].in_cc.set_value(Proxy::ControllerId::CHANNEL_PRESSURE);
+    proxy.rules[1].out_cc.set_value(Proxy::ControllerId::CHANNEL_PRESSURE);
+    proxy.rules[1].target.set_value(Proxy::Target::TRG_ALL_BELOW_ANCHOR);
+
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, 48, 127);     /* channel=1, below anchor */
+    proxy.note_on(1.0, 0, 36, 127);     /* channel=2, below anchor */
+    proxy.note_on(2.0, 0, 40, 127);     /* channel=3, below anchor */
+    proxy.note_on(3.0, 0, 72, 127);     /* channel=4 */
+    proxy.note_off(4.0, 0, 36, 64);
+
+    proxy.begin_processing();
+
+    proxy.channel_pressure(0.0, 0, 127);
+
+    assert_out_events<2>(
+        {
+            "t=0 cmd=CHANNEL_PRESSURE ch=1 d1=0x7f d2=0x00 (v=1.000)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=3 d1=0x7f d2=0x00 (v=1.000)",
         },
         proxy
     );
+
+    proxy.note_off(0.0, 0, 48, 64);
+    proxy.note_off(0.0, 0, 40, 64);
+
+    proxy.begin_processing();
+
+    proxy.channel_pressure(0.0, 0, 96);
+
+    assert_out_events<0>({}, proxy);
 })
 
 
@@ -1696,7 +2007,7 @@ TEST(when_reset_is_set_to_last_value_and_target_is_all_below_anchor_then_new_not
     proxy.note_on(0.0, 0, 72, 127);
 
     assert_out_events<1>(
-        {"t=0.000 cmd=NOTE_ON ch=1 d1=0x48 d2=0x7f (v=1.000)"}, proxy
+        {"t=0 cmd=NOTE_ON ch=1 d1=0x48 d2=0x7f (v=1.000)"}, proxy
     );
 })
 
@@ -1723,7 +2034,7 @@ TEST(when_reset_is_set_to_init_value_value_and_target_is_all_above_anchor_then_n
     proxy.note_on(0.0, 0, 48, 127);
 
     assert_out_events<1>(
-        {"t=0.000 cmd=NOTE_ON ch=1 d1=0x30 d2=0x7f (v=1.000)"}, proxy
+        {"t=0 cmd=NOTE_ON ch=1 d1=0x30 d2=0x7f (v=1.000)"}, proxy
     );
 })
 
@@ -1751,8 +2062,8 @@ TEST(when_note_off_affects_rule_targets_then_affected_notes_are_reset, {
 
     assert_out_events<2>(
         {
-            "t=0.000 cmd=NOTE_OFF ch=1 d1=0x30 d2=0x40 (v=0.504)",
-            "t=0.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x7f d2=0x00 (v=1.000)",
+            "t=0 cmd=NOTE_OFF ch=1 d1=0x30 d2=0x40 (v=0.504)",
+            "t=0 cmd=CHANNEL_PRESSURE ch=2 d1=0x7f d2=0x00 (v=1.000)",
         },
         proxy
     );
@@ -1784,17 +2095,17 @@ TEST(oldest_released_channel_is_reused_first, {
 
     assert_out_events<9>(
         {
-            "t=0.000 cmd=NOTE_ON ch=1 d1=0x30 d2=0x7f (v=1.000)",
-            "t=1.000 cmd=NOTE_ON ch=2 d1=0x3c d2=0x7f (v=1.000)",
-            "t=2.000 cmd=NOTE_ON ch=3 d1=0x48 d2=0x7f (v=1.000)",
+            "t=0 cmd=NOTE_ON ch=1 d1=0x30 d2=0x7f (v=1.000)",
+            "t=1 cmd=NOTE_ON ch=2 d1=0x3c d2=0x7f (v=1.000)",
+            "t=2 cmd=NOTE_ON ch=3 d1=0x48 d2=0x7f (v=1.000)",
 
-            "t=3.000 cmd=NOTE_OFF ch=2 d1=0x3c d2=0x40 (v=0.504)",
-            "t=4.000 cmd=NOTE_OFF ch=1 d1=0x30 d2=0x40 (v=0.504)",
-            "t=5.000 cmd=NOTE_OFF ch=3 d1=0x48 d2=0x40 (v=0.504)",
+            "t=3 cmd=NOTE_OFF ch=2 d1=0x3c d2=0x40 (v=0.504)",
+            "t=4 cmd=NOTE_OFF ch=1 d1=0x30 d2=0x40 (v=0.504)",
+            "t=5 cmd=NOTE_OFF ch=3 d1=0x48 d2=0x40 (v=0.504)",
 
-            "t=6.000 cmd=NOTE_ON ch=2 d1=0x32 d2=0x7f (v=1.000)",
-            "t=7.000 cmd=NOTE_ON ch=1 d1=0x3e d2=0x7f (v=1.000)",
-            "t=8.000 cmd=NOTE_ON ch=3 d1=0x4a d2=0x7f (v=1.000)",
+            "t=6 cmd=NOTE_ON ch=2 d1=0x32 d2=0x7f (v=1.000)",
+            "t=7 cmd=NOTE_ON ch=1 d1=0x3e d2=0x7f (v=1.000)",
+            "t=8 cmd=NOTE_ON ch=3 d1=0x4a d2=0x7f (v=1.000)",
         },
         proxy
     );
@@ -1830,7 +2141,7 @@ TEST(when_no_notes_are_active_when_mapped_cc_events_occur_then_drops_cc_events,
 
     assert_out_events<1>(
         {
-            "t=5.000 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x60 (v=0.756)",
+            "t=5 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x60 (v=0.756)",
         },
         proxy
     );
@@ -1859,14 +2170,14 @@ TEST(can_transpose_notes_above_and_below_the_anchor_differently, {
 
     assert_out_events<8>(
         {
-            "t=0.000 cmd=NOTE_ON ch=1 d1=0x00 d2=0x7f (v=1.000)",
-            "t=1.000 cmd=NOTE_ON ch=2 d1=0x24 d2=0x7f (v=1.000)",
-            "t=2.000 cmd=NOTE_ON ch=3 d1=0x48 d2=0x7f (v=1.000)",
-            "t=3.000 cmd=NOTE_ON ch=4 d1=0x7f d2=0x7f (v=1.000)",
-            "t=4.000 cmd=NOTE_OFF ch=1 d1=0x00 d2=0x40 (v=0.504)",
-            "t=5.000 cmd=NOTE_OFF ch=2 d1=0x24 d2=0x40 (v=0.504)",
-            "t=6.000 cmd=NOTE_OFF ch=3 d1=0x48 d2=0x40 (v=0.504)",
-            "t=7.000 cmd=NOTE_OFF ch=4 d1=0x7f d2=0x40 (v=0.504)",
+            "t=0 cmd=NOTE_ON ch=1 d1=0x00 d2=0x7f (v=1.000)",
+            "t=1 cmd=NOTE_ON ch=2 d1=0x24 d2=0x7f (v=1.000)",
+            "t=2 cmd=NOTE_ON ch=3 d1=0x48 d2=0x7f (v=1.000)",
+            "t=3 cmd=NOTE_ON ch=4 d1=0x7f d2=0x7f (v=1.000)",
+            "t=4 cmd=NOTE_OFF ch=1 d1=0x00 d2=0x40 (v=0.504)",
+            "t=5 cmd=NOTE_OFF ch=2 d1=0x24 d2=0x40 (v=0.504)",
+            "t=6 cmd=NOTE_OFF ch=3 d1=0x48 d2=0x40 (v=0.504)",
+            "t=7 cmd=NOTE_OFF ch=4 d1=0x7f d2=0x40 (v=0.504)",
         },
         proxy
     );
@@ -1889,9 +2200,9 @@ void assert_changing_transposition_settings_triggers_reset(
 
     assert_out_events<3>(
         {
-            "t=0.000 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=CONTROL_CHANGE ch=1 d1=0x40 d2=0x00 (v=0.000)",
-            "t=0.000 cmd=NOTE_OFF ch=1 d1=0x3c d2=0x40 (v=0.504)",
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
+            "t=0 cmd=CONTROL_CHANGE ch=1 d1=0x40 d2=0x00 (v=0.000)",
+            "t=0 cmd=NOTE_OFF ch=1 d1=0x3c d2=0x40 (v=0.504)",
         },
         proxy
     );
@@ -1916,41 +2227,282 @@ TEST(changing_transposition_settings_triggers_reset, {
     assert_changing_transposition_settings_triggers_reset(
         proxy, proxy.transpose_above_anchor, 60
     );
+    assert_changing_transposition_settings_triggers_reset(
+        proxy, proxy.lower_split_point, 36
+    );
+    assert_changing_transposition_settings_triggers_reset(
+        proxy, proxy.upper_split_point, 84
+    );
+    assert_changing_transposition_settings_triggers_reset(
+        proxy, proxy.transpose_below_lower_split, 36
+    );
+    assert_changing_transposition_settings_triggers_reset(
+        proxy, proxy.transpose_above_upper_split, 60
+    );
+    assert_changing_transposition_settings_triggers_reset(
+        proxy, proxy.separate_split_channels, Proxy::Toggle::ON
+    );
 })
 
 
-TEST(when_sustain_pedal_is_ignored_then_events_for_sustained_notes_are_swallowed_after_note_off, {
+TEST(can_transpose_each_split_differently, {
     Proxy proxy;
 
-    proxy.sustain_pedal_handling.set_value(Proxy::Toggle::OFF);
+    turn_off_reset_for_all_rules(proxy);
 
-    proxy.rules[0].in_cc.set_value(Proxy::ControllerId::PITCH_WHEEL);
-    proxy.rules[0].out_cc.set_value(Proxy::ControllerId::PITCH_WHEEL);
-    proxy.rules[0].target.set_value(Proxy::Target::TRG_HIGHEST);
+    proxy.lower_split_point.set_value(36);
+    proxy.anchor.set_value(60);
+    proxy.upper_split_point.set_value(84);
+    proxy.transpose_below_lower_split.set_value(36);
+    proxy.transpose_below_anchor.set_value(47);
+    proxy.transpose_above_anchor.set_value(49);
+    proxy.transpose_above_upper_split.set_value(60);
 
-    proxy.rules[1].in_cc.set_value(Proxy::ControllerId::CHANNEL_PRESSURE);
-    proxy.rules[1].out_cc.set_value(Proxy::ControllerId::CHANNEL_PRESSURE);
-    proxy.rules[1].target.set_value(Proxy::Target::TRG_NEWEST);
+    proxy.begin_processing();
 
-    proxy.rules[2].in_cc.set_value(Proxy::ControllerId::MODULATION_WHEEL);
-    proxy.rules[2].out_cc.set_value(Proxy::ControllerId::SOUND_5);
-    proxy.rules[2].target.set_value(Proxy::Target::TRG_OLDEST);
+    proxy.note_on(0.0, 1, 35, 127);     /* split 1 */
+    proxy.note_on(1.0, 1, 36, 127);     /* split 2 */
+    proxy.note_on(2.0, 1, 59, 127);     /* split 2 */
+    proxy.note_on(3.0, 1, 60, 127);     /* split 3 */
+    proxy.note_on(4.0, 1, 84, 127);     /* split 3 */
+    proxy.note_on(5.0, 1, 85, 127);     /* split 4 */
+    proxy.note_off(6.0, 1, 35, 64);
+    proxy.note_off(7.0, 1, 85, 64);
 
-    proxy.rules[3].in_cc.set_value(Proxy::ControllerId::VOLUME);
-    proxy.rules[3].out_cc.set_value(Proxy::ControllerId::VOLUME);
-    proxy.rules[3].target.set_value(Proxy::Target::TRG_LOWEST);
+    assert_out_events<8>(
+        {
+            "t=0 cmd=NOTE_ON ch=1 d1=0x17 d2=0x7f (v=1.000)",
+            "t=1 cmd=NOTE_ON ch=2 d1=0x23 d2=0x7f (v=1.000)",
+            "t=2 cmd=NOTE_ON ch=3 d1=0x3a d2=0x7f (v=1.000)",
+            "t=3 cmd=NOTE_ON ch=4 d1=0x3d d2=0x7f (v=1.000)",
+            "t=4 cmd=NOTE_ON ch=5 d1=0x55 d2=0x7f (v=1.000)",
+            "t=5 cmd=NOTE_ON ch=6 d1=0x61 d2=0x7f (v=1.000)",
+            "t=6 cmd=NOTE_OFF ch=1 d1=0x17 d2=0x40 (v=0.504)",
+            "t=7 cmd=NOTE_OFF ch=6 d1=0x61 d2=0x40 (v=0.504)",
+        },
+        proxy
+    );
+})
 
-    proxy.note_on(0.1, 0, 60, 127);     /* channel=1, oldest */
-    proxy.note_on(0.2, 0, 67, 127);     /* channel=2, highest */
-    proxy.note_on(0.3, 0, 48, 127);     /* channel=3, lowest */
-    proxy.note_on(0.4, 0, 64, 127);     /* channel=4, newest */
 
-    proxy.control_change(0.5, 5, Proxy::ControllerId::SUSTAIN_PEDAL, 127);
+TEST(split_points_never_cross_the_anchor, {
+    Proxy proxy;
 
-    proxy.note_off(0.6, 5, 60, 127);
-    proxy.note_off(0.7, 5, 67, 127);
-    proxy.note_off(0.8, 5, 48, 127);
-    proxy.note_off(0.9, 5, 64, 127);
+    turn_off_reset_for_all_rules(proxy);
+
+    proxy.lower_split_point.set_value(100);
+    proxy.anchor.set_value(60);
+    proxy.upper_split_point.set_value(20);
+    proxy.transpose_below_lower_split.set_value(36);
+    proxy.transpose_below_anchor.set_value(47);
+    proxy.transpose_above_anchor.set_value(49);
+    proxy.transpose_above_upper_split.set_value(60);
+
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 1, 59, 127);     /* split 1 */
+    proxy.note_on(1.0, 1, 60, 127);     /* split 4 */
+
+    assert_out_events<2>(
+        {
+            "t=0 cmd=NOTE_ON ch=1 d1=0x2f d2=0x7f (v=1.000)",
+            "t=1 cmd=NOTE_ON ch=2 d1=0x48 d2=0x7f (v=1.000)",
+        },
+        proxy
+    );
+})
+
+
+TEST(rules_can_be_restricted_to_a_single_split, {
+    Proxy proxy;
+
+    turn_off_reset_for_all_rules(proxy);
+
+    proxy.lower_split_point.set_value(48);
+    proxy.anchor.set_value(60);
+    proxy.upper_split_point.set_value(72);
+
+    proxy.rules[0].in_cc.set_value(Proxy::ControllerId::PITCH_WHEEL);
+    proxy.rules[0].out_cc.set_value(Proxy::ControllerId::PITCH_WHEEL);
+    proxy.rules[0].target.set_value(Proxy::Target::TRG_NEWEST);
+    proxy.rules[0].split_scope.set_value(Proxy::SplitScope::SCP_SPLIT_2);
+
+    proxy.rules[1].in_cc.set_value(Proxy::ControllerId::CHANNEL_PRESSURE);
+    proxy.rules[1].out_cc.set_value(Proxy::ControllerId::CHANNEL_PRESSURE);
+    proxy.rules[1].target.set_value(Proxy::Target::TRG_LOWEST);
+    proxy.rules[1].split_scope.set_value(Proxy::SplitScope::SCP_SPLIT_4);
+
+    proxy.rules[2].in_cc.set_value(Proxy::ControllerId::MODULATION_WHEEL);
+    proxy.rules[2].out_cc.set_value(Proxy::ControllerId::SOUND_5);
+    proxy.rules[2].target.set_value(Proxy::Target::TRG_ALL_BELOW_ANCHOR);
+    proxy.rules[2].split_scope.set_value(Proxy::SplitScope::SCP_SPLIT_2);
+
+    proxy.rules[3].in_cc.set_value(Proxy::ControllerId::VOLUME);
+    proxy.rules[3].out_cc.set_value(Proxy::ControllerId::VOLUME);
+    proxy.rules[3].target.set_value(Proxy::Target::TRG_NEWEST_ABOVE_ANCHOR);
+    proxy.rules[3].split_scope.set_value(Proxy::SplitScope::SCP_SPLIT_1);
+
+    proxy.begin_processing();
+
+    proxy.note_on(0.1, 0, 40, 127);     /* channel=1, split 1 */
+    proxy.note_on(0.2, 0, 50, 127);     /* channel=2, split 2 */
+    proxy.note_on(0.3, 0, 65, 127);     /* channel=3, split 3 */
+    proxy.note_on(0.4, 0, 90, 127);     /* channel=4, split 4 */
+    proxy.note_on(0.5, 0, 80, 127);     /* channel=5, split 4, lowest */
+    proxy.note_on(0.6, 0, 55, 127);     /* channel=6, split 2, newest */
+    proxy.note_on(0.7, 0, 70, 127);     /* channel=7, split 3, newest */
+    proxy.begin_processing();
+
+    proxy.pitch_wheel_change(1.0, 6, 10000);
+    proxy.channel_pressure(2.0, 7, 30);
+    proxy.control_change(3.0, 5, Proxy::ControllerId::MODULATION_WHEEL, 110);
+    proxy.control_change(4.0, 8, Proxy::ControllerId::VOLUME, 96);
+
+    assert_out_events<4>(
+        {
+            "t=1 cmd=PITCH_BEND_CHANGE ch=6 d1=0x10 d2=0x4e (v=0.610)",
+            "t=2 cmd=CHANNEL_PRESSURE ch=5 d1=0x1e d2=0x00 (v=0.236)",
+            "t=3 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x6e (v=0.866)",
+            "t=3 cmd=CONTROL_CHANGE ch=6 d1=0x4a d2=0x6e (v=0.866)",
+        },
+        proxy
+    );
+})
+
+
+TEST(when_a_rule_is_restricted_to_a_split_then_only_notes_in_that_split_are_reset, {
+    Proxy proxy;
+
+    turn_off_reset_for_all_rules(proxy);
+    proxy.send_mcm.set_value(Proxy::Toggle::OFF);
+
+    proxy.anchor.set_value(60);
+
+    proxy.rules[0].in_cc.set_value(Proxy::ControllerId::PITCH_WHEEL);
+    proxy.rules[0].out_cc.set_value(Proxy::ControllerId::PITCH_WHEEL);
+    proxy.rules[0].init_value.set_value(8192);
+    proxy.rules[0].target.set_value(Proxy::Target::TRG_NEWEST);
+    proxy.rules[0].reset.set_value(Proxy::Reset::RST_INIT);
+    proxy.rules[0].split_scope.set_value(Proxy::SplitScope::SCP_SPLIT_3);
+
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, 64, 127);
+    proxy.pitch_wheel_change(1.0, 0, 10000);
+    proxy.begin_processing();
+
+    proxy.note_on(2.0, 0, 48, 127);
+    proxy.note_on(3.0, 0, 67, 127);
+
+    assert_out_events<5>(
+        {
+            "t=2 cmd=NOTE_ON ch=2 d1=0x30 d2=0x7f (v=1.000)",
+            "t=3 cmd=PITCH_BEND_CHANGE ch=1 d1=0x00 d2=0x40 (v=0.500)",
+            "t=3 cmd=PITCH_BEND_CHANGE ch=3 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
+            "t=3 cmd=NOTE_ON ch=3 d1=0x43 d2=0x7f (v=1.000)",
+            "t=3 cmd=PITCH_BEND_CHANGE ch=3 d1=0x00 d2=0x40 (v=0.500)",
+        },
+        proxy
+    );
+})
+
+
+TEST(each_split_may_have_its_own_channels, {
+    Proxy proxy;
+
+    turn_off_reset_for_all_rules(proxy);
+
+    proxy.channels.set_value(4);
+    proxy.anchor.set_value(60);
+    proxy.separate_split_channels.set_value(Proxy::Toggle::ON);
+    proxy.excess_note_handling.set_value(Proxy::ExcessNoteHandling::ENH_STEAL_OLDEST);
+
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, 70, 127);
+    proxy.note_on(1.0, 0, 40, 127);
+    proxy.note_on(2.0, 0, 41, 127);
+    proxy.note_on(3.0, 0, 42, 127);
+    proxy.note_on(4.0, 0, 71, 127);
+    proxy.note_off(5.0, 0, 70, 64);
+    proxy.note_on(6.0, 0, 72, 127);
+    proxy.note_on(7.0, 0, 73, 127);
+
+    assert_out_events<10>(
+        {
+            "t=0 cmd=NOTE_ON ch=3 d1=0x46 d2=0x7f (v=1.000)",
+            "t=1 cmd=NOTE_ON ch=1 d1=0x28 d2=0x7f (v=1.000)",
+            "t=2 cmd=NOTE_ON ch=2 d1=0x29 d2=0x7f (v=1.000)",
+            "t=3 cmd=NOTE_OFF ch=1 d1=0x28 d2=0x40 (v=0.504)",
+            "t=3 cmd=NOTE_ON ch=1 d1=0x2a d2=0x7f (v=1.000)",
+            "t=4 cmd=NOTE_ON ch=4 d1=0x47 d2=0x7f (v=1.000)",
+            "t=5 cmd=NOTE_OFF ch=3 d1=0x46 d2=0x40 (v=0.504)",
+            "t=6 cmd=NOTE_ON ch=3 d1=0x48 d2=0x7f (v=1.000)",
+            "t=7 cmd=NOTE_OFF ch=4 d1=0x47 d2=0x40 (v=0.504)",
+            "t=7 cmd=NOTE_ON ch=4 d1=0x49 d2=0x7f (v=1.000)",
+        },
+        proxy
+    );
+})
+
+
+TEST(when_a_split_gets_no_channels_of_its_own_then_its_notes_are_dropped, {
+    Proxy proxy;
+
+    turn_off_reset_for_all_rules(proxy);
+
+    proxy.channels.set_value(1);
+    proxy.anchor.set_value(60);
+    proxy.separate_split_channels.set_value(Proxy::Toggle::ON);
+
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, 70, 127);
+    proxy.note_on(1.0, 0, 40, 127);
+
+    assert_out_events<1>(
+        {"t=1 cmd=NOTE_ON ch=1 d1=0x28 d2=0x7f (v=1.000)"},
+        proxy
+    );
+
+    proxy.begin_processing();
+
+    assert_eq(1, (int)proxy.get_voice_stats().dropped_notes);
+})
+
+
+TEST(when_sustain_pedal_is_ignored_then_events_for_sustained_notes_are_swallowed_after_note_off, {
+    Proxy proxy;
+
+    proxy.sustain_pedal_handling.set_value(Proxy::Toggle::OFF);
+
+    proxy.rules[0].in_cc.set_value(Proxy::ControllerId::PITCH_WHEEL);
+    proxy.rules[0].out_cc.set_value(Proxy::ControllerId::PITCH_WHEEL);
+    proxy.rules[0].target.set_value(Proxy::Target::TRG_HIGHEST);
+
+    proxy.rules[1].in_cc.set_value(Proxy::ControllerId::CHANNEL_PRESSURE);
+    proxy.rules[1].out_cc.set_value(Proxy::ControllerId::CHANNEL_PRESSURE);
+    proxy.rules[1].target.set_value(Proxy::Target::TRG_NEWEST);
+
+    proxy.rules[2].in_cc.set_value(Proxy::ControllerId::MODULATION_WHEEL);
+    proxy.rules[2].out_cc.set_value(Proxy::ControllerId::SOUND_5);
+    proxy.rules[2].target.set_value(Proxy::Target::TRG_OLDEST);
+
+    proxy.rules[3].in_cc.set_value(Proxy::ControllerId::VOLUME);
+    proxy.rules[3].out_cc.set_value(Proxy::ControllerId::VOLUME);
+    proxy.rules[3].target.set_value(Proxy::Target::TRG_LOWEST);
+
+    proxy.note_on(0.1, 0, 60, 127);     /* channel=1, oldest */
+    proxy.note_on(0.2, 0, 67, 127);     /* channel=2, highest */
+    proxy.note_on(0.3, 0, 48, 127);     /* channel=3, lowest */
+    proxy.note_on(0.4, 0, 64, 127);     /* channel=4, newest */
+
+    proxy.control_change(0.5, 5, Proxy::ControllerId::SUSTAIN_PEDAL, 127);
+
+    proxy.note_off(0.6, 5, 60, 127);
+    proxy.note_off(0.7, 5, 67, 127);
+    proxy.note_off(0.8, 5, 48, 127);
+    proxy.note_off(0.9, 5, 64, 127);
 
     proxy.begin_processing();
 
@@ -1962,7 +2514,7 @@ TEST(when_sustain_pedal_is_ignored_then_events_for_sustained_notes_are_swallowed
 
     assert_out_events<1>(
         {
-            "t=1.000 cmd=CONTROL_CHANGE ch=0 d1=0x0b d2=0x7b (v=0.969)",
+            "t=1 cmd=CONTROL_CHANGE ch=0 d1=0x0b d2=0x7b (v=0.969)",
         },
         proxy
     );
@@ -2025,18 +2577,18 @@ TEST(when_sustain_pedal_is_handled_then_events_for_sustained_notes_are_kept_bein
 
     assert_out_events<12>(
         {
-            "t=1.000 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x7f (v=1.000)",
-            "t=6.000 cmd=CONTROL_CHANGE ch=0 d1=0x0b d2=0x7b (v=0.969)",
-            "t=7.000 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x6e (v=0.866)",
-            "t=8.000 cmd=PITCH_BEND_CHANGE ch=2 d1=0x10 d2=0x4e (v=0.610)",
-            "t=9.000 cmd=CONTROL_CHANGE ch=3 d1=0x07 d2=0x60 (v=0.756)",
-            "t=10.000 cmd=CHANNEL_PRESSURE ch=4 d1=0x1e d2=0x00 (v=0.236)",
-            "t=11.000 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
-            "t=11.000 cmd=NOTE_OFF ch=4 d1=0x30 d2=0x40 (v=0.504)",
-            "t=11.000 cmd=NOTE_OFF ch=3 d1=0x20 d2=0x40 (v=0.504)",
-            "t=11.000 cmd=NOTE_OFF ch=2 d1=0x33 d2=0x40 (v=0.504)",
-            "t=11.000 cmd=NOTE_OFF ch=1 d1=0x2c d2=0x40 (v=0.504)",
-            "t=12.000 cmd=CONTROL_CHANGE ch=0 d1=0x0b d2=0x00 (v=0.000)",
+            "t=1 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x7f (v=1.000)",
+            "t=6 cmd=CONTROL_CHANGE ch=0 d1=0x0b d2=0x7b (v=0.969)",
+            "t=7 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x6e (v=0.866)",
+            "t=8 cmd=PITCH_BEND_CHANGE ch=2 d1=0x10 d2=0x4e (v=0.610)",
+            "t=9 cmd=CONTROL_CHANGE ch=3 d1=0x07 d2=0x60 (v=0.756)",
+            "t=10 cmd=CHANNEL_PRESSURE ch=4 d1=0x1e d2=0x00 (v=0.236)",
+            "t=11 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
+            "t=11 cmd=NOTE_OFF ch=4 d1=0x30 d2=0x40 (v=0.504)",
+            "t=11 cmd=NOTE_OFF ch=3 d1=0x20 d2=0x40 (v=0.504)",
+            "t=11 cmd=NOTE_OFF ch=2 d1=0x33 d2=0x40 (v=0.504)",
+            "t=11 cmd=NOTE_OFF ch=1 d1=0x2c d2=0x40 (v=0.504)",
+            "t=12 cmd=CONTROL_CHANGE ch=0 d1=0x0b d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -2069,9 +2621,9 @@ TEST(suspending_and_resuming_turns_off_the_sustain_pedal_and_clears_deferred_not
 
     assert_out_events<3>(
         {
-            "t=1.000 cmd=NOTE_ON ch=1 d1=0x2c d2=0x60 (v=0.756)",
-            "t=2.000 cmd=NOTE_OFF ch=1 d1=0x2c d2=0x3c (v=0.472)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
+            "t=1 cmd=NOTE_ON ch=1 d1=0x2c d2=0x60 (v=0.756)",
+            "t=2 cmd=NOTE_OFF ch=1 d1=0x2c d2=0x3c (v=0.472)",
+            "t=3 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -2103,9 +2655,9 @@ TEST(zone_config_change_turns_off_the_sustain_pedal_and_clears_deferred_note_off
 
     assert_out_events<3>(
         {
-            "t=1.000 cmd=NOTE_ON ch=1 d1=0x2c d2=0x60 (v=0.756)",
-            "t=2.000 cmd=NOTE_OFF ch=1 d1=0x2c d2=0x3c (v=0.472)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
+            "t=1 cmd=NOTE_ON ch=1 d1=0x2c d2=0x60 (v=0.756)",
+            "t=2 cmd=NOTE_OFF ch=1 d1=0x2c d2=0x3c (v=0.472)",
+            "t=3 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -2141,10 +2693,10 @@ TEST(sustain_pedal_may_be_both_interpreted_and_transformed_at_the_same_time, {
 
     assert_out_events<4>(
         {
-            "t=1.000 cmd=CONTROL_CHANGE ch=2 d1=0x40 d2=0x7f (v=1.000)",
-            "t=4.000 cmd=CONTROL_CHANGE ch=2 d1=0x40 d2=0x00 (v=0.000)",
-            "t=4.000 cmd=NOTE_OFF ch=2 d1=0x30 d2=0x40 (v=0.504)",
-            "t=4.000 cmd=NOTE_OFF ch=1 d1=0x2c d2=0x40 (v=0.504)",
+            "t=1 cmd=CONTROL_CHANGE ch=2 d1=0x40 d2=0x7f (v=1.000)",
+            "t=4 cmd=CONTROL_CHANGE ch=2 d1=0x40 d2=0x00 (v=0.000)",
+            "t=4 cmd=NOTE_OFF ch=2 d1=0x30 d2=0x40 (v=0.504)",
+            "t=4 cmd=NOTE_OFF ch=1 d1=0x2c d2=0x40 (v=0.504)",
         },
         proxy
     );
@@ -2174,9 +2726,9 @@ TEST(when_a_sustained_note_is_retriggered_then_its_note_off_is_no_longer_deferre
 
     assert_out_events<3>(
         {
-            "t=3.000 cmd=NOTE_OFF ch=1 d1=0x2c d2=0x40 (v=0.504)",
-            "t=3.000 cmd=NOTE_ON ch=1 d1=0x2c d2=0x7f (v=1.000)",
-            "t=4.000 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
+            "t=3 cmd=NOTE_OFF ch=1 d1=0x2c d2=0x40 (v=0.504)",
+            "t=3 cmd=NOTE_ON ch=1 d1=0x2c d2=0x7f (v=1.000)",
+            "t=4 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -2206,9 +2758,9 @@ TEST(when_a_sustained_note_is_stolen_then_its_note_off_is_no_longer_deferred, {
 
     assert_out_events<3>(
         {
-            "t=3.000 cmd=NOTE_OFF ch=1 d1=0x30 d2=0x40 (v=0.504)",
-            "t=3.000 cmd=NOTE_ON ch=1 d1=0x2c d2=0x7f (v=1.000)",
-            "t=4.000 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
+            "t=3 cmd=NOTE_OFF ch=1 d1=0x30 d2=0x40 (v=0.504)",
+            "t=3 cmd=NOTE_ON ch=1 d1=0x2c d2=0x7f (v=1.000)",
+            "t=4 cmd=CONTROL_CHANGE ch=0 d1=0x40 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -2264,18 +2816,18 @@ TEST(when_a_rule_has_fallback_to_global_and_no_notes_are_playing_then_its_cc_is_
 
     assert_out_events<12>(
         {
-            "t=1.000 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x6e (v=0.866)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=2 d1=0x10 d2=0x4e (v=0.610)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=3 d1=0x07 d2=0x60 (v=0.756)",
-            "t=4.000 cmd=CHANNEL_PRESSURE ch=4 d1=0x1e d2=0x00 (v=0.236)",
-            "t=5.000 cmd=NOTE_OFF ch=1 d1=0x3c d2=0x7f (v=1.000)",
-            "t=6.000 cmd=NOTE_OFF ch=2 d1=0x43 d2=0x7f (v=1.000)",
-            "t=7.000 cmd=NOTE_OFF ch=3 d1=0x30 d2=0x7f (v=1.000)",
-            "t=8.000 cmd=NOTE_OFF ch=4 d1=0x40 d2=0x7f (v=1.000)",
-            "t=9.000 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x30 (v=0.378)",
-            "t=10.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x68 d2=0x07 (v=0.061)",
-            "t=11.000 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x20 (v=0.252)",
-            "t=12.000 cmd=CHANNEL_PRESSURE ch=0 d1=0x00 d2=0x00 (v=0.000)",
+            "t=1 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x6e (v=0.866)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=2 d1=0x10 d2=0x4e (v=0.610)",
+            "t=3 cmd=CONTROL_CHANGE ch=3 d1=0x07 d2=0x60 (v=0.756)",
+            "t=4 cmd=CHANNEL_PRESSURE ch=4 d1=0x1e d2=0x00 (v=0.236)",
+            "t=5 cmd=NOTE_OFF ch=1 d1=0x3c d2=0x7f (v=1.000)",
+            "t=6 cmd=NOTE_OFF ch=2 d1=0x43 d2=0x7f (v=1.000)",
+            "t=7 cmd=NOTE_OFF ch=3 d1=0x30 d2=0x7f (v=1.000)",
+            "t=8 cmd=NOTE_OFF ch=4 d1=0x40 d2=0x7f (v=1.000)",
+            "t=9 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x30 (v=0.378)",
+            "t=10 cmd=PITCH_BEND_CHANGE ch=0 d1=0x68 d2=0x07 (v=0.061)",
+            "t=11 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x20 (v=0.252)",
+            "t=12 cmd=CHANNEL_PRESSURE ch=0 d1=0x00 d2=0x00 (v=0.000)",
         },
         proxy
     );
@@ -2323,41 +2875,526 @@ TEST(when_a_rule_has_fallback_to_global_and_no_notes_are_playing_then_its_cc_is_
     proxy.note_on(5.0, 0, 60, 127);
     proxy.note_on(6.0, 0, 67, 127);
 
-    assert_out_events<32>(
-        {
-            "t=1.000 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x6e (v=0.866)",
-            "t=2.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x10 d2=0x4e (v=0.610)",
-            "t=3.000 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x60 (v=0.756)",
-            "t=4.000 cmd=CHANNEL_PRESSURE ch=0 d1=0x1e d2=0x00 (v=0.236)",
-            "t=5.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
-            "t=5.000 cmd=PITCH_BEND_CHANGE ch=1 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
-            "t=5.000 cmd=CHANNEL_PRESSURE ch=0 d1=0x1e d2=0x00 (v=0.236) pre-NOTE_ON setup",
-            "t=5.000 cmd=CHANNEL_PRESSURE ch=1 d1=0x1e d2=0x00 (v=0.236) pre-NOTE_ON setup",
-            "t=5.000 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x00 (v=0.000) pre-NOTE_ON setup",
-            "t=5.000 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x00 (v=0.000) pre-NOTE_ON setup",
-            "t=5.000 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x60 (v=0.756) pre-NOTE_ON setup",
-            "t=5.000 cmd=CONTROL_CHANGE ch=1 d1=0x07 d2=0x60 (v=0.756) pre-NOTE_ON setup",
-            "t=5.000 cmd=NOTE_ON ch=1 d1=0x3c d2=0x7f (v=1.000)",
-            "t=5.000 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x40 (v=0.500)",
-            "t=5.000 cmd=PITCH_BEND_CHANGE ch=1 d1=0x00 d2=0x40 (v=0.500)",
-            "t=5.000 cmd=CHANNEL_PRESSURE ch=0 d1=0x1e d2=0x00 (v=0.236)",
-            "t=5.000 cmd=CHANNEL_PRESSURE ch=1 d1=0x1e d2=0x00 (v=0.236)",
-            "t=5.000 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x00 (v=0.000)",
-            "t=5.000 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x00 (v=0.000)",
-            "t=5.000 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x60 (v=0.756)",
-            "t=5.000 cmd=CONTROL_CHANGE ch=1 d1=0x07 d2=0x60 (v=0.756)",
-            "t=6.000 cmd=PITCH_BEND_CHANGE ch=1 d1=0x00 d2=0x40 (v=0.500)",
-            "t=6.000 cmd=PITCH_BEND_CHANGE ch=2 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
-            "t=6.000 cmd=CHANNEL_PRESSURE ch=1 d1=0x1e d2=0x00 (v=0.236)",
-            "t=6.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x1e d2=0x00 (v=0.236) pre-NOTE_ON setup",
-            "t=6.000 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x00 (v=0.000) pre-NOTE_ON setup",
-            "t=6.000 cmd=CONTROL_CHANGE ch=2 d1=0x07 d2=0x60 (v=0.756) pre-NOTE_ON setup",
-            "t=6.000 cmd=NOTE_ON ch=2 d1=0x43 d2=0x7f (v=1.000)",
-            "t=6.000 cmd=PITCH_BEND_CHANGE ch=2 d1=0x00 d2=0x40 (v=0.500)",
-            "t=6.000 cmd=CHANNEL_PRESSURE ch=2 d1=0x1e d2=0x00 (v=0.236)",
-            "t=6.000 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x00 (v=0.000)",
-            "t=6.000 cmd=CONTROL_CHANGE ch=2 d1=0x07 d2=0x60 (v=0.756)",
+    assert_out_events<24>(
+        {
+            "t=1 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x6e (v=0.866)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=0 d1=0x10 d2=0x4e (v=0.610)",
+            "t=3 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x60 (v=0.756)",
+            "t=4 cmd=CHANNEL_PRESSURE ch=0 d1=0x1e d2=0x00 (v=0.236)",
+            "t=5 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
+            "t=5 cmd=PITCH_BEND_CHANGE ch=1 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
+            "t=5 cmd=CHANNEL_PRESSURE ch=1 d1=0x1e d2=0x00 (v=0.236) pre-NOTE_ON setup",
+            "t=5 cmd=CONTROL_CHANGE ch=0 d1=0x4a d2=0x00 (v=0.000) pre-NOTE_ON setup",
+            "t=5 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x00 (v=0.000) pre-NOTE_ON setup",
+            "t=5 cmd=CONTROL_CHANGE ch=1 d1=0x07 d2=0x60 (v=0.756) pre-NOTE_ON setup",
+            "t=5 cmd=NOTE_ON ch=1 d1=0x3c d2=0x7f (v=1.000)",
+            "t=5 cmd=PITCH_BEND_CHANGE ch=1 d1=0x00 d2=0x40 (v=0.500)",
+            "t=5 cmd=CHANNEL_PRESSURE ch=1 d1=0x1e d2=0x00 (v=0.236)",
+            "t=5 cmd=CONTROL_CHANGE ch=1 d1=0x4a d2=0x00 (v=0.000)",
+            "t=5 cmd=CONTROL_CHANGE ch=1 d1=0x07 d2=0x60 (v=0.756)",
+            "t=6 cmd=PITCH_BEND_CHANGE ch=2 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
+            "t=6 cmd=CHANNEL_PRESSURE ch=2 d1=0x1e d2=0x00 (v=0.236) pre-NOTE_ON setup",
+            "t=6 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x00 (v=0.000) pre-NOTE_ON setup",
+            "t=6 cmd=CONTROL_CHANGE ch=2 d1=0x07 d2=0x60 (v=0.756) pre-NOTE_ON setup",
+            "t=6 cmd=NOTE_ON ch=2 d1=0x43 d2=0x7f (v=1.000)",
+            "t=6 cmd=PITCH_BEND_CHANGE ch=2 d1=0x00 d2=0x40 (v=0.500)",
+            "t=6 cmd=CHANNEL_PRESSURE ch=2 d1=0x1e d2=0x00 (v=0.236)",
+            "t=6 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x00 (v=0.000)",
+            "t=6 cmd=CONTROL_CHANGE ch=2 d1=0x07 d2=0x60 (v=0.756)",
+        },
+        proxy
+    );
+})
+
+
+void assert_channel_state(
+        Proxy::VoiceStats const& voice_stats,
+        Midi::Channel const channel,
+        Proxy::VoiceStats::ChannelState const expected_state,
+        Midi::Note const expected_note = 0
+) {
+    assert_eq(
+        (int)expected_state,
+        (int)voice_stats.channel_states[channel],
+        "channel=%d",
+        (int)channel
+    );
+    assert_eq(
+        (int)expected_note,
+        (int)voice_stats.notes[channel],
+        "channel=%d",
+        (int)channel
+    );
+}
+
+
+void set_up_rate_limited_mod_wheel_rule(
+        Proxy& proxy,
+        Proxy::RateLimit const rate_limit,
+        unsigned int const deadband
+) {
+    /* 1 sample = 1 ms, 100 Hz = 10 samples, gesture end = 40 samples */
+    proxy.set_sample_rate(1000.0);
+
+    turn_off_reset_for_all_rules(proxy);
+
+    proxy.rules[3].in_cc.set_value(Proxy::ControllerId::MODULATION_WHEEL);
+    proxy.rules[3].out_cc.set_value(Proxy::ControllerId::MODULATION_WHEEL);
+    proxy.rules[3].target.set_value(Proxy::Target::TRG_GLOBAL);
+    proxy.rules[3].rate_limit.set_value(rate_limit);
+    proxy.rules[3].deadband.set_value(deadband);
+
+    proxy.begin_processing();
+}
+
+
+TEST(rate_limited_rule_holds_back_fast_updates_and_sends_the_final_value_when_due, {
+    Proxy proxy;
+
+    set_up_rate_limited_mod_wheel_rule(proxy, Proxy::RateLimit::RL_100_HZ, 0);
+
+    proxy.control_change(0.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 10);
+    proxy.control_change(3.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 20);
+    proxy.control_change(6.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 30);
+    proxy.control_change(12.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 40);
+    proxy.control_change(15.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 50);
+    proxy.control_change(30.0, 1, Proxy::ControllerId::VOLUME, 100);
+    proxy.end_processing(100);
+
+    assert_out_events<4>(
+        {
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x0a (v=0.079)",
+            "t=12 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x28 (v=0.315)",
+            "t=22 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x32 (v=0.394)",
+            "t=30 cmd=CONTROL_CHANGE ch=0 d1=0x07 d2=0x64 (v=0.787)",
+        },
+        proxy
+    );
+})
+
+
+TEST(rate_limit_interval_is_measured_across_block_boundaries, {
+    Proxy proxy;
+
+    set_up_rate_limited_mod_wheel_rule(proxy, Proxy::RateLimit::RL_100_HZ, 0);
+
+    proxy.control_change(0.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 10);
+    proxy.control_change(10.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 20);
+    proxy.control_change(19.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 30);
+    proxy.end_processing(20);
+
+    assert_out_events<2>(
+        {
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x0a (v=0.079)",
+            "t=10 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x14 (v=0.157)",
+        },
+        proxy
+    );
+
+    proxy.begin_processing();
+    proxy.end_processing(20);
+
+    assert_out_events<1>(
+        {
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x1e (v=0.236)",
+        },
+        proxy
+    );
+
+    proxy.begin_processing();
+    proxy.control_change(5.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 40);
+    proxy.control_change(8.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 50);
+    proxy.end_processing(20);
+
+    assert_out_events<2>(
+        {
+            "t=5 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x28 (v=0.315)",
+            "t=15 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x32 (v=0.394)",
+        },
+        proxy
+    );
+})
+
+
+TEST(rate_limited_rule_does_not_repeat_the_value_that_was_sent_last, {
+    Proxy proxy;
+
+    set_up_rate_limited_mod_wheel_rule(proxy, Proxy::RateLimit::RL_100_HZ, 0);
+
+    proxy.control_change(0.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 10);
+    proxy.control_change(5.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 20);
+    proxy.control_change(8.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 10);
+    proxy.control_change(50.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 10);
+    proxy.end_processing(100);
+
+    assert_out_events<1>(
+        {
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x0a (v=0.079)",
+        },
+        proxy
+    );
+})
+
+
+TEST(changes_within_the_deadband_are_held_back_until_the_end_of_the_gesture, {
+    Proxy proxy;
+
+    set_up_rate_limited_mod_wheel_rule(proxy, Proxy::RateLimit::RL_OFF, 4);
+
+    proxy.control_change(0.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 64);
+    proxy.control_change(5.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 66);
+    proxy.control_change(10.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 67);
+    proxy.control_change(20.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 70);
+    proxy.control_change(30.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 71);
+    proxy.control_change(50.0, 1, Proxy::ControllerId::MODULATION_WHEEL, 72);
+    proxy.end_processing(100);
+
+    assert_out_events<3>(
+        {
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x40 (v=0.504)",
+            "t=20 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x46 (v=0.551)",
+            "t=90 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x48 (v=0.567)",
+        },
+        proxy
+    );
+})
+
+
+TEST(pitch_bend_deadband_is_measured_in_14_bit_steps, {
+    Proxy proxy;
+
+    proxy.set_sample_rate(1000.0);
+    turn_off_reset_for_all_rules(proxy);
+    proxy.rules[0].target.set_value(Proxy::Target::TRG_GLOBAL);
+    proxy.rules[0].deadband.set_value(1);
+    proxy.begin_processing();
+
+    proxy.pitch_wheel_change(0.0, 1, 8192);
+    proxy.pitch_wheel_change(1.0, 1, 8192 + 127);
+    proxy.pitch_wheel_change(2.0, 1, 8192 + 128);
+    proxy.end_processing(100);
+
+    assert_out_events<2>(
+        {
+            "t=0 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x40 (v=0.500)",
+            "t=2 cmd=PITCH_BEND_CHANGE ch=0 d1=0x00 d2=0x41 (v=0.508)",
         },
         proxy
     );
 })
+
+
+TEST(when_a_target_is_reset_then_its_held_back_value_is_dropped, {
+    Proxy proxy;
+
+    proxy.set_sample_rate(1000.0);
+    proxy.rules[0].rate_limit.set_value(Proxy::RateLimit::RL_100_HZ);
+    proxy.rules[0].reset.set_value(Proxy::Reset::RST_INIT);
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, 60, 127);
+    proxy.begin_processing();
+
+    proxy.pitch_wheel_change(1.0, 0, 10000);
+    proxy.pitch_wheel_change(2.0, 0, 12000);
+    proxy.note_on(5.0, 0, 64, 127);
+    proxy.end_processing(100);
+
+    assert_out_events<9>(
+        {
+            "t=1 cmd=PITCH_BEND_CHANGE ch=1 d1=0x10 d2=0x4e (v=0.610)",
+            "t=5 cmd=PITCH_BEND_CHANGE ch=1 d1=0x00 d2=0x40 (v=0.500)",
+            "t=5 cmd=PITCH_BEND_CHANGE ch=2 d1=0x00 d2=0x40 (v=0.500) pre-NOTE_ON setup",
+            "t=5 cmd=CHANNEL_PRESSURE ch=2 d1=0x00 d2=0x00 (v=0.000) pre-NOTE_ON setup",
+            "t=5 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x40 (v=0.504) pre-NOTE_ON setup",
+            "t=5 cmd=NOTE_ON ch=2 d1=0x40 d2=0x7f (v=1.000)",
+            "t=5 cmd=PITCH_BEND_CHANGE ch=2 d1=0x00 d2=0x40 (v=0.500)",
+            "t=5 cmd=CHANNEL_PRESSURE ch=2 d1=0x00 d2=0x00 (v=0.000)",
+            "t=5 cmd=CONTROL_CHANGE ch=2 d1=0x4a d2=0x40 (v=0.504)",
+        },
+        proxy
+    );
+})
+
+
+TEST(rate_limit_reduces_the_number_of_events_of_dense_controller_streams, {
+    Proxy proxy;
+
+    set_up_rate_limited_mod_wheel_rule(proxy, Proxy::RateLimit::RL_100_HZ, 0);
+
+    for (int i = 0; i != 100; ++i) {
+        proxy.control_change(
+            (double)i, 1, Proxy::ControllerId::MODULATION_WHEEL, (Midi::Byte)i
+        );
+    }
+
+    proxy.end_processing(100);
+
+    assert_eq(10, (int)proxy.out_events.size());
+    assert_eq(
+        "t=90 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x5a (v=0.709)",
+        proxy.out_events.back().to_string().c_str()
+    );
+
+    proxy.begin_processing();
+    proxy.end_processing(100);
+
+    assert_out_events<1>(
+        {
+            "t=0 cmd=CONTROL_CHANGE ch=0 d1=0x01 d2=0x63 (v=0.780)",
+        },
+        proxy
+    );
+})
+
+
+TEST(voice_stats_are_published_at_the_beginning_of_the_next_block, {
+    Proxy proxy;
+    Proxy::VoiceStats voice_stats;
+
+    proxy.zone_type.set_value(Proxy::ZoneType::ZT_UPPER);
+    proxy.channels.set_value(3);
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, 48, 127);
+    proxy.note_on(1.0, 0, 60, 127);
+
+    voice_stats = proxy.get_voice_stats();
+    assert_eq(0, (int)voice_stats.active_voices);
+    assert_eq(0, (int)proxy.get_active_voices_count());
+
+    proxy.begin_processing();
+
+    voice_stats = proxy.get_voice_stats();
+    assert_eq(2, (int)voice_stats.active_voices);
+    assert_eq(2, (int)proxy.get_active_voices_count());
+    assert_eq(3, (int)voice_stats.channel_count);
+    assert_channel_state(voice_stats, 15, Proxy::VoiceStats::ChannelState::CS_MANAGER);
+    assert_channel_state(voice_stats, 14, Proxy::VoiceStats::ChannelState::CS_ACTIVE, 48);
+    assert_channel_state(voice_stats, 13, Proxy::VoiceStats::ChannelState::CS_ACTIVE, 60);
+    assert_channel_state(voice_stats, 12, Proxy::VoiceStats::ChannelState::CS_FREE);
+    assert_channel_state(voice_stats, 11, Proxy::VoiceStats::ChannelState::CS_UNUSED);
+    assert_channel_state(voice_stats, 0, Proxy::VoiceStats::ChannelState::CS_UNUSED);
+
+    proxy.note_off(2.0, 0, 48, 64);
+    proxy.begin_processing();
+
+    voice_stats = proxy.get_voice_stats();
+    assert_eq(1, (int)voice_stats.active_voices);
+    assert_eq(2, (int)voice_stats.peak_voices);
+    assert_channel_state(voice_stats, 14, Proxy::VoiceStats::ChannelState::CS_FREE);
+    assert_channel_state(voice_stats, 13, Proxy::VoiceStats::ChannelState::CS_ACTIVE, 60);
+})
+
+
+TEST(voice_steals_are_counted_by_excess_note_handling_policy, {
+    constexpr Proxy::ExcessNoteHandling policies[] = {
+        Proxy::ExcessNoteHandling::ENH_STEAL_LOWEST,
+        Proxy::ExcessNoteHandling::ENH_STEAL_HIGHEST,
+        Proxy::ExcessNoteHandling::ENH_STEAL_OLDEST,
+        Proxy::ExcessNoteHandling::ENH_STEAL_NEWEST,
+    };
+
+    Proxy proxy;
+    Midi::Note note = 40;
+
+    proxy.channels.set_value(2);
+    proxy.begin_processing();
+
+    for (size_t i = 0; i != 4; ++i) {
+        proxy.excess_note_handling.set_value(policies[i]);
+
+        for (size_t j = 0; j != i + 3; ++j) {
+            proxy.note_on(0.0, 0, note++, 127);
+        }
+    }
+
+    proxy.excess_note_handling.set_value(Proxy::ExcessNoteHandling::ENH_IGNORE);
+    proxy.note_on(1.0, 0, note++, 127);
+    proxy.note_on(1.0, 0, note++, 127);
+
+    proxy.begin_processing();
+
+    Proxy::VoiceStats const voice_stats = proxy.get_voice_stats();
+
+    assert_eq(0, (int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_IGNORE]);
+    assert_eq(1, (int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_STEAL_LOWEST]);
+    assert_eq(4, (int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_STEAL_HIGHEST]);
+    assert_eq(5, (int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_STEAL_OLDEST]);
+    assert_eq(6, (int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_STEAL_NEWEST]);
+    assert_eq(2, (int)voice_stats.dropped_notes);
+    assert_eq(0, (int)voice_stats.retriggered_notes);
+    assert_eq(2, (int)voice_stats.active_voices);
+    assert_eq(2, (int)voice_stats.peak_voices);
+})
+
+
+TEST(retriggered_and_ignored_repeated_notes_are_counted_separately, {
+    Proxy proxy;
+
+    proxy.excess_note_handling.set_value(Proxy::ExcessNoteHandling::ENH_STEAL_OLDEST);
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, 60, 127);
+    proxy.note_on(1.0, 0, 60, 100);
+    proxy.note_on(2.0, 0, 60, 90);
+
+    proxy.excess_note_handling.set_value(Proxy::ExcessNoteHandling::ENH_IGNORE);
+    proxy.note_on(3.0, 0, 60, 80);
+
+    proxy.begin_processing();
+
+    Proxy::VoiceStats const voice_stats = proxy.get_voice_stats();
+
+    assert_eq(2, (int)voice_stats.retriggered_notes);
+    assert_eq(1, (int)voice_stats.dropped_notes);
+    assert_eq(0, (int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_STEAL_OLDEST]);
+    assert_eq(1, (int)voice_stats.active_voices);
+    assert_eq(1, (int)voice_stats.peak_voices);
+    assert_channel_state(voice_stats, 1, Proxy::VoiceStats::ChannelState::CS_ACTIVE, 60);
+})
+
+
+TEST(channels_held_by_the_sustain_pedal_are_reported_as_sustained, {
+    Proxy proxy;
+    Proxy::VoiceStats voice_stats;
+
+    proxy.sustain_pedal_handling.set_value(Proxy::Toggle::ON);
+    proxy.channels.set_value(4);
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, 60, 127);
+    proxy.note_on(0.0, 0, 64, 127);
+    proxy.note_on(0.0, 0, 67, 127);
+    proxy.control_change(1.0, 0, Proxy::ControllerId::SUSTAIN_PEDAL, 127);
+    proxy.note_off(2.0, 0, 60, 64);
+    proxy.note_off(2.0, 0, 64, 64);
+
+    proxy.begin_processing();
+
+    voice_stats = proxy.get_voice_stats();
+    assert_eq(2, (int)voice_stats.deferred_note_offs);
+    assert_eq(3, (int)voice_stats.active_voices);
+    assert_channel_state(voice_stats, 1, Proxy::VoiceStats::ChannelState::CS_SUSTAINED, 60);
+    assert_channel_state(voice_stats, 2, Proxy::VoiceStats::ChannelState::CS_SUSTAINED, 64);
+    assert_channel_state(voice_stats, 3, Proxy::VoiceStats::ChannelState::CS_ACTIVE, 67);
+    assert_channel_state(voice_stats, 4, Proxy::VoiceStats::ChannelState::CS_FREE);
+
+    proxy.control_change(3.0, 0, Proxy::ControllerId::SUSTAIN_PEDAL, 0);
+    proxy.begin_processing();
+
+    voice_stats = proxy.get_voice_stats();
+    assert_eq(2, (int)voice_stats.deferred_note_offs);
+    assert_eq(1, (int)voice_stats.active_voices);
+    assert_eq(3, (int)voice_stats.peak_voices);
+    assert_channel_state(voice_stats, 1, Proxy::VoiceStats::ChannelState::CS_FREE);
+    assert_channel_state(voice_stats, 2, Proxy::VoiceStats::ChannelState::CS_FREE);
+    assert_channel_state(voice_stats, 3, Proxy::VoiceStats::ChannelState::CS_ACTIVE, 67);
+})
+
+
+TEST(zone_config_change_rebuilds_channel_map_but_keeps_session_counters, {
+    Proxy proxy;
+    Proxy::VoiceStats voice_stats;
+
+    proxy.channels.set_value(1);
+    proxy.begin_processing();
+
+    proxy.note_on(0.0, 0, 60, 127);
+    proxy.note_on(0.0, 0, 62, 127);
+
+    proxy.channels.set_value(5);
+    proxy.begin_processing();
+
+    voice_stats = proxy.get_voice_stats();
+    assert_eq(5, (int)voice_stats.channel_count);
+    assert_eq(0, (int)voice_stats.active_voices);
+    assert_eq(1, (int)voice_stats.peak_voices);
+    assert_eq(1, (int)voice_stats.steals[Proxy::ExcessNoteHandling::ENH_STEAL_OLDEST]);
+    assert_channel_state(voice_stats, 0, Proxy::VoiceStats::ChannelState::CS_MANAGER);
+
+    for (Midi::Channel channel = 1; channel != 6; ++channel) {
+        assert_channel_state(voice_stats, channel, Proxy::VoiceStats::ChannelState::CS_FREE);
+    }
+
+    assert_channel_state(voice_stats, 6, Proxy::VoiceStats::ChannelState::CS_UNUSED);
+})
+
+
+TEST(reset_with_all_channels_busy_fits_into_the_measured_fan_out, {
+    Proxy proxy;
+
+    proxy.channels.set_value(15);
+    proxy.anchor.set_value(127);
+    proxy.send_mcm.set_value(Proxy::Toggle::ON);
+
+    for (size_t i = 0; i != Proxy::RULES; ++i) {
+        proxy.rules[i].in_cc.set_value(Proxy::ControllerId::MODULATION_WHEEL);
+        proxy.rules[i].out_cc.set_value(Proxy::ControllerId::GENERAL_1 + (Proxy::ControllerId)i);
+        proxy.rules[i].target.set_value(Proxy::Target::TRG_HIGHEST);
+        proxy.rules[i].reset.set_value(Proxy::Reset::RST_LAST);
+    }
+
+    proxy.resume();
+    proxy.begin_processing();
+
+    for (Midi::Note note = 60; note != 75; ++note) {
+        proxy.note_on(0.0, 0, note, 100);
+    }
+
+    proxy.control_change(0.0, 0, Proxy::ControllerId::MODULATION_WHEEL, 99);
+    proxy.begin_processing();
+    proxy.resume();
+
+    assert_lt(128, (int)proxy.out_events.size());
+    assert_lte((int)proxy.out_events.size(), (int)Proxy::OUT_EVENTS_FAN_OUT_MAX);
+})
+
+
+TEST(out_events_capacity_follows_max_block_size_and_keeps_pending_events, {
+    Proxy proxy;
+
+    proxy.begin_processing();
+    proxy.note_on(0.0, 0, 60, 100);
+
+    size_t const pending = proxy.out_events.size();
+
+    assert_lt(0, (int)pending);
+
+    proxy.reserve_out_events(4096);
+    assert_eq(
+        (int)Proxy::get_out_events_capacity(4096), (int)proxy.out_events.capacity()
+    );
+
+    proxy.reserve_out_events(64);
+    assert_eq(
+        (int)Proxy::get_out_events_capacity(64), (int)proxy.out_events.capacity()
+    );
+    assert_eq((int)pending, (int)proxy.out_events.size());
+    assert_eq(
+        (int)Proxy::get_out_events_capacity(Proxy::MAX_BLOCK_SIZE),
+        (int)Proxy::get_out_events_capacity(Proxy::MAX_BLOCK_SIZE * 4)
+    );
+})
+
+
+TEST(when_out_events_buffer_is_full_then_excess_events_are_dropped_and_counted, {
+    Proxy proxy;
+
+    proxy.reserve_out_events(1);
+    proxy.begin_processing();
+
+    size_t const capacity = proxy.out_events.capacity();
+
+    for (size_t i = 0; i != capacity; ++i) {
+        proxy.note_on(0.0, 0, 60, 100);
+        proxy.note_off(0.0, 0, 60, 64);
+    }
+
+    assert_eq((int)capacity, (int)proxy.out_events.size());
+    assert_eq((int)capacity, (int)proxy.out_events.capacity());
+    assert_lt(0, (int)proxy.get_dropped_events_count());
+
+    proxy.count_dropped_events(3);
+    assert_lt(3, (int)proxy.get_dropped_events_count());
+})
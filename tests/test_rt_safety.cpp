@@ -0,0 +1,332 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstdlib>
+#include <cstring>
+
+#include <unistd.h>
+
+#include "test.cpp"
+
+#include "rt_safety.cpp"
+
+#include "proxy.cpp"
+#include "plugin/fst/plugin.cpp"
+
+
+using namespace MpeEmulator;
+
+
+constexpr VstInt32 BLOCK_SIZE = 128;
+constexpr int BLOCKS = 4000;
+constexpr int WORKLOAD_BLOCKS = 64;
+constexpr int MAX_EVENTS_PER_BLOCK = 8;
+
+
+/*
+A few bars of an MPE performance on a single channel controller, recorded as
+raw MIDI bytes, along with GUI and host activity between the blocks: a note
+with pitch bend and aftertouch, a chord with CC 1 and the sustain pedal, and
+an unfinished note which gets released on the next loop.
+*/
+struct RecordedEvent
+{
+    int block;
+    VstInt32 delta_frames;
+    Midi::Byte bytes[3];
+};
+
+
+RecordedEvent const RECORDED_EVENTS[] = {
+    {0, 0, {0x90, 60, 100}},
+    {2, 17, {0xe0, 0x00, 0x48}},
+    {3, 64, {0xd0, 80, 0}},
+    {4, 12, {0xe0, 0x00, 0x50}},
+    {6, 90, {0x80, 60, 64}},
+    {8, 0, {0x90, 64, 90}},
+    {8, 3, {0x90, 67, 92}},
+    {8, 5, {0x90, 71, 88}},
+    {9, 40, {0xb0, 1, 30}},
+    {10, 40, {0xb0, 1, 60}},
+    {11, 40, {0xb0, 1, 90}},
+    {12, 0, {0xb0, 64, 127}},
+    {14, 10, {0x80, 64, 0}},
+    {14, 11, {0x80, 67, 0}},
+    {14, 12, {0x80, 71, 0}},
+    {16, 0, {0xb0, 64, 0}},
+    {20, 100, {0x90, 72, 127}},
+    {21, 0, {0xa0, 72, 50}},
+    {22, 0, {0xa0, 72, 100}},
+    {40, 0, {0xe0, 0x00, 0x40}},
+    {63, 127, {0x80, 72, 0}},
+};
+
+
+enum HostActivity {
+    HA_NONE = 0,
+    HA_SET_PARAM = 1,
+    HA_CHANGE_PROGRAM = 2,
+};
+
+
+HostActivity host_activity_before_block(int const block)
+{
+    int const workload_block = block % WORKLOAD_BLOCKS;
+
+    if (workload_block == 30) {
+        return HostActivity::HA_SET_PARAM;
+    }
+
+    if (workload_block == 50 && block % (4 * WORKLOAD_BLOCKS) == 50) {
+        return HostActivity::HA_CHANGE_PROGRAM;
+    }
+
+    return HostActivity::HA_NONE;
+}
+
+
+VstIntPtr VSTCALLBACK host_callback(
+        AEffect* effect,
+        VstInt32 op_code,
+        VstInt32 index,
+        VstIntPtr ivalue,
+        void* pointer,
+        float fvalue
+) {
+    return 0;
+}
+
+
+struct VstEventsBuffer
+{
+    int numEvents;
+    VstIntPtr _pad;
+    VstEvent* events[MAX_EVENTS_PER_BLOCK];
+};
+
+
+void collect_block_events(
+        int const block,
+        VstMidiEvent* const midi_events,
+        VstEventsBuffer& events
+) {
+    int const workload_block = block % WORKLOAD_BLOCKS;
+
+    events.numEvents = 0;
+    events._pad = 0;
+
+    for (RecordedEvent const& recorded_event : RECORDED_EVENTS) {
+        if (recorded_event.block != workload_block) {
+            continue;
+        }
+
+        VstMidiEvent& midi_event = midi_events[events.numEvents];
+
+        memset(&midi_event, 0, sizeof(VstMidiEvent));
+
+        midi_event.type = kVstMidiType;
+        midi_event.byteSize = sizeof(VstMidiEvent);
+        midi_event.deltaFrames = recorded_event.delta_frames;
+
+        for (size_t i = 0; i != 3; ++i) {
+            midi_event.midiData[i] = (char)recorded_event.bytes[i];
+        }
+
+        events.events[events.numEvents] = (VstEvent*)&midi_event;
+        ++events.numEvents;
+    }
+}
+
+
+void assert_no_violations()
+{
+    assert_eq(
+        0,
+        (int)RealTimeSafety::get_total_violations(),
+        "allocations=%d, deallocations=%d, blocking calls=%d, last violation: %s()",
+        (int)RealTimeSafety::get_violations(RealTimeSafety::Violation::V_ALLOCATION),
+        (int)RealTimeSafety::get_violations(RealTimeSafety::Violation::V_DEALLOCATION),
+        (int)RealTimeSafety::get_violations(RealTimeSafety::Violation::V_BLOCKING_CALL),
+        RealTimeSafety::get_last_violation()
+    );
+}
+
+
+TEST(violations_are_counted_only_inside_real_time_scope, {
+    void* volatile ptr;
+
+    RealTimeSafety::reset();
+
+    ptr = malloc(64);
+    free(ptr);
+    usleep(1);
+
+    assert_eq(0, (int)RealTimeSafety::get_total_violations());
+    assert_false(RealTimeSafety::is_in_scope());
+
+    {
+        MPE_EMULATOR_RT_SCOPE();
+
+        assert_true(RealTimeSafety::is_in_scope());
+
+        ptr = malloc(64);
+        free(ptr);
+        usleep(1);
+    }
+
+    assert_false(RealTimeSafety::is_in_scope());
+    assert_eq(1, (int)RealTimeSafety::get_violations(RealTimeSafety::Violation::V_ALLOCATION));
+    assert_eq(1, (int)RealTimeSafety::get_violations(RealTimeSafety::Violation::V_DEALLOCATION));
+    assert_eq(1, (int)RealTimeSafety::get_violations(RealTimeSafety::Violation::V_BLOCKING_CALL));
+    assert_eq("usleep", RealTimeSafety::get_last_violation());
+
+    RealTimeSafety::reset();
+
+    assert_eq(0, (int)RealTimeSafety::get_total_violations());
+    assert_eq("", RealTimeSafety::get_last_violation());
+})
+
+
+TEST(operator_new_and_delete_are_checked, {
+    RealTimeSafety::reset();
+
+    {
+        MPE_EMULATOR_RT_SCOPE();
+
+        std::string* volatile string = new std::string(256, 'x');
+
+        delete string;
+    }
+
+    assert_lte(2, (int)RealTimeSafety::get_violations(RealTimeSafety::Violation::V_ALLOCATION));
+    assert_lte(2, (int)RealTimeSafety::get_violations(RealTimeSafety::Violation::V_DEALLOCATION));
+
+    RealTimeSafety::reset();
+})
+
+
+TEST(exemption_suspends_checks_until_the_end_of_its_block, {
+    void* volatile ptr;
+
+    RealTimeSafety::reset();
+
+    {
+        MPE_EMULATOR_RT_SCOPE();
+
+        {
+            MPE_EMULATOR_RT_EXEMPT();
+
+            assert_false(RealTimeSafety::is_in_scope());
+
+            ptr = malloc(64);
+            free(ptr);
+        }
+
+        assert_true(RealTimeSafety::is_in_scope());
+    }
+
+    assert_eq(0, (int)RealTimeSafety::get_total_violations());
+})
+
+
+TEST(proxy_processes_recorded_workload_without_violations, {
+    Proxy proxy;
+
+    proxy.resume();
+
+    RealTimeSafety::reset();
+
+    for (int block = 0; block != BLOCKS; ++block) {
+        if (host_activity_before_block(block) == HostActivity::HA_SET_PARAM) {
+            proxy.push_message(
+                Proxy::MessageType::SET_PARAM,
+                Proxy::ParamId::Z1R1DL,
+                (double)(block % 7) / 7.0
+            );
+        }
+
+        MPE_EMULATOR_RT_SCOPE();
+
+        proxy.begin_processing();
+
+        int const workload_block = block % WORKLOAD_BLOCKS;
+
+        for (RecordedEvent const& recorded_event : RECORDED_EVENTS) {
+            if (recorded_event.block == workload_block) {
+                Midi::EventDispatcher<Proxy>::dispatch_event(
+                    proxy,
+                    (double)recorded_event.delta_frames,
+                    recorded_event.bytes,
+                    3
+                );
+            }
+        }
+    }
+
+    assert_no_violations();
+})
+
+
+TEST(fst_plugin_processes_recorded_workload_without_violations, {
+    float left[BLOCK_SIZE];
+    float right[BLOCK_SIZE];
+    float* outputs[] = {left, right};
+    VstMidiEvent midi_events[MAX_EVENTS_PER_BLOCK];
+    VstEventsBuffer events;
+    char program_name[kVstMaxProgNameLen];
+
+    AEffect* const effect = FstPlugin::create_instance(&host_callback, NULL);
+
+    effect->dispatcher(effect, effOpen, 0, 0, NULL, 0.0f);
+    effect->dispatcher(effect, effSetSampleRate, 0, 0, NULL, 48000.0f);
+    effect->dispatcher(effect, effSetBlockSize, 0, BLOCK_SIZE, NULL, 0.0f);
+    effect->dispatcher(effect, effMainsChanged, 0, 1, NULL, 0.0f);
+
+    RealTimeSafety::reset();
+
+    for (int block = 0; block != BLOCKS; ++block) {
+        switch (host_activity_before_block(block)) {
+            case HostActivity::HA_SET_PARAM:
+                effect->setParameter(effect, block % 4, (float)(block % 7) / 7.0f);
+                break;
+
+            case HostActivity::HA_CHANGE_PROGRAM:
+                effect->dispatcher(
+                    effect, effSetProgram, 0, (block / WORKLOAD_BLOCKS) % 3, NULL, 0.0f
+                );
+                break;
+
+            default:
+                break;
+        }
+
+        effect->dispatcher(effect, effGetProgramName, 0, 0, program_name, 0.0f);
+
+        collect_block_events(block, midi_events, events);
+        effect->dispatcher(effect, effProcessEvents, 0, 0, &events, 0.0f);
+        effect->processReplacing(effect, NULL, outputs, BLOCK_SIZE);
+    }
+
+    assert_no_violations();
+
+    effect->dispatcher(effect, effMainsChanged, 0, 0, NULL, 0.0f);
+    effect->dispatcher(effect, effClose, 0, 0, NULL, 0.0f);
+
+    delete effect;
+})
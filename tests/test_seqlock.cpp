@@ -0,0 +1,90 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2023, 2024  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <thread>
+
+#include "test.cpp"
+
+#include "seqlock.cpp"
+
+
+using namespace MpeEmulator;
+
+
+TEST(seqlock_is_lock_free, {
+    SeqLock<double> seqlock;
+
+    assert_true(seqlock.is_lock_free());
+})
+
+
+TEST(seqlock_returns_the_most_recently_stored_item, {
+    SeqLock<double> seqlock;
+
+    assert_eq(0.0, seqlock.load());
+
+    seqlock.store(0.123);
+    assert_eq(0.123, seqlock.load());
+
+    seqlock.store(1.0 / 3.0);
+    assert_eq(1.0 / 3.0, seqlock.load());
+})
+
+
+TEST(seqlock_never_returns_a_torn_item, {
+    constexpr int count = 200000;
+
+    /* The two halves of each stored double are different from all others. */
+    auto const make_item = [](int const i) -> double {
+        return (double)(((uint64_t)i << 32) | (uint64_t)i);
+    };
+
+    SeqLock<double> seqlock;
+    std::atomic<bool> is_done(false);
+
+    seqlock.store(make_item(0));
+
+    std::thread writer(
+        [&seqlock, &is_done, &make_item]() {
+            for (int i = 1; i != count; ++i) {
+                seqlock.store(make_item(i));
+            }
+
+            is_done.store(true);
+        }
+    );
+
+    int torn = 0;
+    double previous = 0.0;
+
+    while (!is_done.load()) {
+        uint64_t const item = (uint64_t)seqlock.load();
+
+        torn += (item >> 32) != (item & 0xffffffff) ? 1 : 0;
+        torn += (double)item < previous ? 1 : 0;
+        previous = (double)item;
+
+        std::this_thread::yield();
+    }
+
+    writer.join();
+
+    assert_eq(0, torn);
+    assert_eq(make_item(count - 1), seqlock.load());
+})
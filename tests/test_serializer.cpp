@@ -374,3 +374,30 @@ TEST(trailing_zeros_and_params_with_default_values_are_omitted_from_serialized_s
 
     assert_eq(settings, Serializer::serialize(proxy));
 })
+
+
+TEST(serialized_params_follow_changes_and_match_fixed_point_formatting, {
+    constexpr double ratios[] = {0.5, 0.123456789012345, 1.0 / 3.0, 0.0001, 0.5};
+    Proxy proxy;
+
+    proxy.push_message(Proxy::MessageType::CLEAR, Proxy::ParamId::INVALID_PARAM_ID, 0.0);
+    proxy.process_messages();
+
+    for (double const ratio : ratios) {
+        constexpr size_t buffer_size = 64;
+        char buffer[buffer_size];
+        int const length = snprintf(buffer, buffer_size, "Z1ANC = %.15f", ratio);
+        std::string expected = "[mpeemulator]";
+
+        Serializer::trim_excess_zeros_from_end_after_snprintf(buffer, length, buffer_size);
+        expected += Serializer::LINE_END;
+        expected += buffer;
+        expected += Serializer::LINE_END;
+
+        proxy.push_message(Proxy::MessageType::SET_PARAM, Proxy::ParamId::Z1ANC, ratio);
+        proxy.process_messages();
+
+        assert_eq(expected, Serializer::serialize(proxy));
+        assert_eq(expected, Serializer::serialize(proxy));
+    }
+})
@@ -16,7 +16,10 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <chrono>
+#include <cstdio>
 #include <string>
+#include <thread>
 
 #include "test.cpp"
 
@@ -153,3 +156,140 @@ TEST(queue_can_be_filled_and_emptied_multiple_times, {
 
     }
 })
+
+
+TEST(bulk_push_and_pop_are_limited_by_free_space_and_available_items, {
+    SPSCQueue<std::string> q(5);
+    std::string const items[] = {"a", "b", "c", "d"};
+    std::string popped[4];
+
+    assert_eq(4, q.push_bulk(items, 4));
+    assert_eq(1, q.push_bulk(items, 4));
+    assert_eq(0, q.push_bulk(items, 4));
+    assert_eq(5, q.length());
+
+    assert_eq(3, q.pop_bulk(popped, 3));
+    assert_eq("a", popped[0]);
+    assert_eq("b", popped[1]);
+    assert_eq("c", popped[2]);
+    assert_eq(2, q.length());
+
+    assert_eq(3, q.push_bulk(items + 1, 3));
+    assert_eq(4, q.pop_bulk(popped, 4));
+    assert_eq("d", popped[0]);
+    assert_eq("a", popped[1]);
+    assert_eq("b", popped[2]);
+    assert_eq("c", popped[3]);
+
+    assert_eq(1, q.pop_bulk(popped, 4));
+    assert_eq("d", popped[0]);
+    assert_eq(0, q.pop_bulk(popped, 4));
+    assert_true(q.is_empty());
+})
+
+
+template<bool is_bulk>
+void produce(SPSCQueue<unsigned int>& q, unsigned int const count)
+{
+    constexpr unsigned int batch_size = 64;
+
+    unsigned int batch[batch_size];
+    unsigned int next = 0;
+
+    while (next != count) {
+        if (is_bulk) {
+            unsigned int const size = std::min(batch_size, count - next);
+
+            for (unsigned int i = 0; i != size; ++i) {
+                batch[i] = next + i;
+            }
+
+            unsigned int const pushed = (unsigned int)q.push_bulk(batch, size);
+
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+
+            next += pushed;
+        } else if (q.push(next)) {
+            ++next;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+
+template<bool is_bulk>
+unsigned int consume(SPSCQueue<unsigned int>& q, unsigned int const count)
+{
+    constexpr unsigned int batch_size = 64;
+
+    unsigned int batch[batch_size];
+    unsigned int expected = 0;
+    unsigned int out_of_order = 0;
+
+    while (expected != count) {
+        if (is_bulk) {
+            unsigned int const size = (unsigned int)q.pop_bulk(batch, batch_size);
+
+            if (size == 0) {
+                std::this_thread::yield();
+            }
+
+            for (unsigned int i = 0; i != size; ++i, ++expected) {
+                out_of_order += batch[i] != expected ? 1 : 0;
+            }
+        } else if (q.pop(batch[0])) {
+            out_of_order += batch[0] != expected ? 1 : 0;
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    return out_of_order;
+}
+
+
+template<bool is_bulk>
+void test_two_thread_throughput(char const* const name)
+{
+    constexpr unsigned int count = 1 << 20;
+
+    SPSCQueue<unsigned int> q(1024);
+    unsigned int out_of_order = 0;
+
+    std::chrono::steady_clock::time_point const begin = (
+        std::chrono::steady_clock::now()
+    );
+
+    std::thread consumer(
+        [&q, &out_of_order]() {
+            out_of_order = consume<is_bulk>(q, count);
+        }
+    );
+
+    produce<is_bulk>(q, count);
+    consumer.join();
+
+    double const elapsed_s = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - begin
+    ).count();
+
+    assert_eq(0, out_of_order);
+    assert_true(q.is_empty());
+
+    fprintf(
+        stderr,
+        "    %s: %.1f million items/s\n",
+        name,
+        (double)count / elapsed_s / 1000000.0
+    );
+}
+
+
+TEST(two_thread_throughput, {
+    test_two_thread_throughput<false>("single item push and pop");
+    test_two_thread_throughput<true>("bulk push and pop");
+})
@@ -78,3 +78,30 @@ TEST(options, {
     assert_neq(NULL, Strings::get_options(Proxy::ParamId::Z1ENH, count));
     assert_lt(0, count);
 })
+
+
+TEST(display_strings_of_discrete_params_come_from_the_option_tables, {
+    Proxy proxy;
+
+    assert_eq(
+        (void const*)Strings::DISTORTIONS[1],
+        (void const*)Strings::param_ratio_to_display_str(
+            proxy, Proxy::ParamId::Z1R1DT, 1.0 / 3.0
+        )
+    );
+    assert_eq(
+        "", Strings::param_ratio_to_display_str(proxy, Proxy::ParamId::INVALID_PARAM_ID, 0.5)
+    );
+})
+
+
+TEST(display_strings_of_continuous_params_follow_value_changes, {
+    Proxy proxy;
+
+    assert_eq("25.00%", Strings::param_ratio_to_display_str(proxy, Proxy::ParamId::Z1R1DL, 0.25));
+    assert_eq("25.00%", Strings::param_ratio_to_display_str(proxy, Proxy::ParamId::Z1R1DL, 0.25));
+    assert_eq("75.00%", Strings::param_ratio_to_display_str(proxy, Proxy::ParamId::Z1R1DL, 0.75));
+    assert_eq("0.00%", Strings::param_ratio_to_display_str(proxy, Proxy::ParamId::Z1R1DL, -0.0));
+    assert_eq("10.00%", Strings::param_ratio_to_display_str(proxy, Proxy::ParamId::Z1R2DL, 0.1));
+    assert_eq("0.00%", Strings::param_ratio_to_display_str(proxy, Proxy::ParamId::Z1R1DL, 0.0));
+})
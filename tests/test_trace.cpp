@@ -0,0 +1,169 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2025  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+
+#define MPE_EMULATOR_TRACE_LOG trace-test.bin
+
+#include "test.cpp"
+
+#include "trace.cpp"
+
+
+using namespace MpeEmulator;
+
+
+std::string const TRACE_FILE = (
+    std::filesystem::temp_directory_path() / "mpe-emulator-test-trace.bin"
+).string();
+
+
+std::string decode_trace() noexcept
+{
+    FILE* const input = fopen(TRACE_FILE.c_str(), "rb");
+    FILE* const output = tmpfile();
+    std::string text;
+    char buffer[256];
+
+    if (input == NULL || output == NULL) {
+        return "ERROR";
+    }
+
+    if (!Trace::decode(input, output)) {
+        text = "ERROR";
+    }
+
+    fclose(input);
+    rewind(output);
+
+    while (fgets(buffer, sizeof(buffer), output) != NULL) {
+        text += buffer;
+    }
+
+    fclose(output);
+    std::filesystem::remove(TRACE_FILE);
+
+    return text;
+}
+
+
+size_t count(std::string const& text, std::string const& needle) noexcept
+{
+    size_t result = 0;
+
+    for (
+            size_t pos = text.find(needle);
+            pos != std::string::npos;
+            pos = text.find(needle, pos + needle.length())
+    ) {
+        ++result;
+    }
+
+    return result;
+}
+
+
+void record_events(size_t const number_of_events) noexcept
+{
+    for (size_t i = 0; i != number_of_events; ++i) {
+        MPE_EMULATOR_TRACE("worker event", i);
+    }
+}
+
+
+TEST(when_not_running_then_events_are_not_recorded, {
+    MPE_EMULATOR_TRACE("before start");
+
+    assert_true(Trace::start(TRACE_FILE.c_str()));
+    Trace::stop();
+
+    MPE_EMULATOR_TRACE("after stop");
+
+    std::string const text = decode_trace();
+
+    assert_eq("", text);
+})
+
+
+TEST(events_are_decoded_with_their_call_site_and_arguments, {
+    assert_true(Trace::start(TRACE_FILE.c_str()));
+    MPE_EMULATOR_TRACE("no args");
+    MPE_EMULATOR_TRACE("some args", 1, 2.5, -3.25f, true);
+    Trace::stop();
+
+    std::string const text = decode_trace();
+
+    assert_eq(2, count(text, "test_trace.cpp:"));
+    assert_eq(2, count(text, " test_events_are_decoded_with_their_call_site_and_arguments():"));
+    assert_eq(1, count(text, "\tno args\n"));
+    assert_eq(1, count(text, "\tsome args\t1\t2.5\t-3.25\t1\n"));
+    assert_lt((int)text.find("no args"), (int)text.find("some args"));
+})
+
+
+TEST(events_from_multiple_threads_are_collected, {
+    constexpr size_t number_of_events = 1000;
+
+    assert_true(Trace::start(TRACE_FILE.c_str()));
+
+    std::thread worker_1(record_events, number_of_events);
+    std::thread worker_2(record_events, number_of_events);
+
+    worker_1.join();
+    worker_2.join();
+
+    Trace::stop();
+
+    std::string const text = decode_trace();
+
+    assert_eq((int)(2 * number_of_events), (int)count(text, "\tworker event\t"));
+    assert_eq(2, count(text, "\tworker event\t999\n"));
+    assert_eq(0, count(text, "Dropped"));
+})
+
+
+TEST(start_and_stop_calls_are_counted, {
+    assert_true(Trace::start(TRACE_FILE.c_str()));
+    assert_true(Trace::start("/nonexistent-directory/trace.bin"));
+    MPE_EMULATOR_TRACE("first");
+    Trace::stop();
+    MPE_EMULATOR_TRACE("second");
+    Trace::stop();
+    MPE_EMULATOR_TRACE("third");
+    Trace::stop();
+
+    std::string const text = decode_trace();
+
+    assert_eq(1, count(text, "\tfirst\n"));
+    assert_eq(1, count(text, "\tsecond\n"));
+    assert_eq(0, count(text, "\tthird\n"));
+})
+
+
+TEST(decoding_fails_for_files_which_are_not_traces, {
+    FILE* const file = fopen(TRACE_FILE.c_str(), "wb");
+
+    fprintf(file, "not a trace\n");
+    fclose(file);
+
+    assert_eq("ERROR", decode_trace());
+})
@@ -0,0 +1,86 @@
+/*
+ * This file is part of MPE Emulator.
+ * Copyright (C) 2023, 2024  Attila M. Magyar
+ *
+ * MPE Emulator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * MPE Emulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+
+#include "test.cpp"
+
+#include "triple_buffer.cpp"
+
+
+using namespace MpeEmulator;
+
+
+TEST(triple_buffer_is_lock_free, {
+    TripleBuffer<std::string> buffer;
+
+    assert_true(buffer.is_lock_free());
+})
+
+
+TEST(when_nothing_is_published_then_front_is_unchanged, {
+    TripleBuffer<std::string> buffer;
+
+    assert_false(buffer.consume());
+    assert_eq("", buffer.get_front());
+
+    buffer.get_back() = "unpublished";
+
+    assert_false(buffer.consume());
+    assert_eq("", buffer.get_front());
+})
+
+
+TEST(published_item_can_be_consumed_only_once, {
+    TripleBuffer<std::string> buffer;
+
+    buffer.get_back() = "a";
+    buffer.publish();
+
+    assert_true(buffer.consume());
+    assert_eq("a", buffer.get_front());
+
+    assert_false(buffer.consume());
+    assert_eq("a", buffer.get_front());
+})
+
+
+TEST(reader_gets_the_latest_published_item, {
+    TripleBuffer<std::string> buffer;
+
+    buffer.get_back() = "a";
+    buffer.publish();
+    buffer.get_back() = "b";
+    buffer.publish();
+    buffer.get_back() = "c";
+    buffer.publish();
+    buffer.get_back() = "unpublished";
+
+    assert_true(buffer.consume());
+    assert_eq("c", buffer.get_front());
+
+    buffer.get_back() = "d";
+
+    assert_false(buffer.consume());
+    assert_eq("c", buffer.get_front());
+
+    buffer.publish();
+
+    assert_true(buffer.consume());
+    assert_eq("d", buffer.get_front());
+})